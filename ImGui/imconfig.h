@@ -48,6 +48,7 @@
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_DISABLE_WORKER_THREADS                      // Don't create worker threads (std::thread) to sort large tables submitted with DataTable() or to write the .ini file (io.IniSavingThreaded). Both then happen on the calling thread.
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 // May be convenient for some users to only explicitly include vanilla imgui.h and have extra stuff included.
@@ -57,6 +58,11 @@
 //---- Pack colors to BGRA8 instead of RGBA8 (to avoid converting from one to another)
 //#define IMGUI_USE_BGRA_PACKED_COLOR
 
+//---- Use a different hash function for ImHashData()/ImHashStr(), which are used to compute every window and widget ID.
+// Default is a byte-at-a-time CRC32. Changing it changes IDs, so ID-keyed .ini data (tables, docking layouts) saved with another hash will be lost.
+//#define IMGUI_USE_HASH_CRC32C                             // CRC32C: hardware instructions when compiling with SSE4.2 (e.g. -msse4.2), table lookup otherwise (same output)
+//#define IMGUI_USE_HASH_WORD                               // Word-at-a-time multiplicative hash: consume 8 bytes per step on any CPU
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
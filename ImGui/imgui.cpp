@@ -1010,8 +1010,12 @@ CODE
 #include "imgui_internal.h"
 
 // System includes
-#include <stdio.h>      // vsnprintf, sscanf, printf
+#include <stdio.h>      // vsnprintf, sscanf, printf, rename
 #include <stdint.h>     // intptr_t
+#include <atomic>       // std::atomic (ImTieredAllocator)
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+#include <thread>       // std::thread (.ini saving)
+#endif
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -1164,6 +1168,7 @@ static void             ErrorCheckEndFrameSanityChecks();
 static void             UpdateDebugToolItemPicker();
 static void             UpdateDebugToolStackQueries();
 static void             UpdateDebugToolFlashStyleColor();
+static void             DebugAllocReportSteadyState(ImGuiContext* ctx, size_t size);
 
 // Inputs
 static void             UpdateKeyboardInputs();
@@ -1240,6 +1245,197 @@ static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
 
+// ImTieredAllocator: see comments in imgui_internal.h
+// Each block is preceded by a 16 bytes header storing its size class (or IM_TIERED_ALLOCATOR_LARGE) and requested size.
+// Free blocks of a class are linked through their first bytes. Pages and frame overflow blocks are linked through their header.
+#define IM_TIERED_ALLOCATOR_HEADER_SIZE     16
+#define IM_TIERED_ALLOCATOR_LARGE           ((ImU32)-1)
+
+struct ImTieredAllocatorLock
+{
+    std::atomic<int>    Locked;
+    ImTieredAllocatorLock() : Locked(0) {}
+};
+
+struct ImTieredAllocatorLockScope
+{
+    ImTieredAllocatorLock* Lock;
+    ImTieredAllocatorLockScope(ImTieredAllocatorLock* lock) : Lock(lock) { while (Lock->Locked.exchange(1, std::memory_order_acquire) != 0) {} }
+    ~ImTieredAllocatorLockScope()                                         { Lock->Locked.store(0, std::memory_order_release); }
+};
+
+static inline int ImTieredAllocatorGetClass(size_t size)
+{
+    int class_n = 0;
+    for (size_t class_size = 16; class_size < size; class_size <<= 1)
+        class_n++;
+    return class_n;
+}
+
+ImTieredAllocator::ImTieredAllocator(ImGuiMemAllocFunc backend_alloc_func, ImGuiMemFreeFunc backend_free_func, void* backend_user_data)
+{
+    memset(Classes, 0, sizeof(Classes));
+    Pages = NULL;
+    PagesBytes = LargeBytes = 0;
+    FrameArena = NULL;
+    FrameArenaSize = FrameArenaUsed = 0;
+    FrameOverflow = NULL;
+    FrameOverflowBytes = 0;
+    memset(&FrameStats, 0, sizeof(FrameStats));
+    memset(&LastFrameStats, 0, sizeof(LastFrameStats));
+    BackendAllocFunc = backend_alloc_func ? backend_alloc_func : MallocWrapper;
+    BackendFreeFunc = backend_free_func ? backend_free_func : FreeWrapper;
+    BackendUserData = backend_user_data;
+    Lock = IM_PLACEMENT_NEW(BackendAllocFunc(sizeof(ImTieredAllocatorLock), BackendUserData)) ImTieredAllocatorLock();
+}
+
+ImTieredAllocator::~ImTieredAllocator()
+{
+    while (FrameOverflow != NULL)
+    {
+        void* next_block = *(void**)FrameOverflow;
+        BackendFreeFunc(FrameOverflow, BackendUserData);
+        FrameOverflow = next_block;
+    }
+    while (Pages != NULL)
+    {
+        void* next_page = *(void**)Pages;
+        BackendFreeFunc(Pages, BackendUserData);
+        Pages = next_page;
+    }
+    if (FrameArena != NULL)
+        BackendFreeFunc(FrameArena, BackendUserData);
+    Lock->~ImTieredAllocatorLock();
+    BackendFreeFunc(Lock, BackendUserData);
+}
+
+void* ImTieredAllocator::Alloc(size_t size)
+{
+    ImTieredAllocatorLockScope lock(Lock);
+    FrameStats.AllocCount++;
+    FrameStats.AllocBytes += size;
+
+    char* block;
+    if (size > IM_TIERED_ALLOCATOR_MAX_POOLED_SIZE)
+    {
+        block = (char*)BackendAllocFunc(size + IM_TIERED_ALLOCATOR_HEADER_SIZE, BackendUserData);
+        FrameStats.BackendAllocCount++;
+        if (block == NULL)
+            return NULL;
+        *(ImU32*)block = IM_TIERED_ALLOCATOR_LARGE;
+        LargeBytes += size;
+    }
+    else
+    {
+        const int class_n = ImTieredAllocatorGetClass(size);
+        ImTieredAllocatorClass* pool = &Classes[class_n];
+        if (pool->FreeList == NULL)
+        {
+            // Carve a new page into blocks. The first IM_TIERED_ALLOCATOR_HEADER_SIZE bytes link pages together.
+            char* page = (char*)BackendAllocFunc(IM_TIERED_ALLOCATOR_PAGE_SIZE, BackendUserData);
+            FrameStats.BackendAllocCount++;
+            if (page == NULL)
+                return NULL;
+            *(void**)page = Pages;
+            Pages = page;
+            PagesBytes += IM_TIERED_ALLOCATOR_PAGE_SIZE;
+            const size_t block_size = IM_TIERED_ALLOCATOR_HEADER_SIZE + ((size_t)16 << class_n);
+            for (size_t offset = IM_TIERED_ALLOCATOR_HEADER_SIZE; offset + block_size <= IM_TIERED_ALLOCATOR_PAGE_SIZE; offset += block_size)
+            {
+                char* free_block = page + offset;
+                *(ImU32*)free_block = (ImU32)class_n;
+                *(void**)(free_block + IM_TIERED_ALLOCATOR_HEADER_SIZE) = pool->FreeList;
+                pool->FreeList = free_block;
+                pool->BlocksCount++;
+            }
+        }
+        block = (char*)pool->FreeList;
+        pool->FreeList = *(void**)(block + IM_TIERED_ALLOCATOR_HEADER_SIZE);
+        pool->BlocksUsed++;
+    }
+    *(size_t*)(block + 8) = size;
+    return block + IM_TIERED_ALLOCATOR_HEADER_SIZE;
+}
+
+void ImTieredAllocator::Free(void* ptr)
+{
+    if (ptr == NULL)
+        return;
+    ImTieredAllocatorLockScope lock(Lock);
+    FrameStats.FreeCount++;
+
+    char* block = (char*)ptr - IM_TIERED_ALLOCATOR_HEADER_SIZE;
+    const ImU32 class_n = *(ImU32*)block;
+    if (class_n == IM_TIERED_ALLOCATOR_LARGE)
+    {
+        LargeBytes -= *(size_t*)(block + 8);
+        BackendFreeFunc(block, BackendUserData);
+        return;
+    }
+    IM_ASSERT(class_n < IM_TIERED_ALLOCATOR_CLASSES_COUNT && "Corrupted block or pointer not allocated by this allocator!");
+    ImTieredAllocatorClass* pool = &Classes[class_n];
+    *(void**)ptr = pool->FreeList;
+    pool->FreeList = block;
+    pool->BlocksUsed--;
+}
+
+void* ImTieredAllocator::AllocFrame(size_t size)
+{
+    size = IM_MEMALIGN(size, 16);
+    FrameStats.FrameBytes += size;
+    if (FrameArenaUsed + size <= FrameArenaSize)
+    {
+        void* ptr = FrameArena + FrameArenaUsed;
+        FrameArenaUsed += size;
+        return ptr;
+    }
+
+    // Arena is full: use a temporary block until next NewFrame()
+    char* block = (char*)BackendAllocFunc(size + IM_TIERED_ALLOCATOR_HEADER_SIZE, BackendUserData);
+    {
+        ImTieredAllocatorLockScope lock(Lock); // Alloc() may update the same counter from a worker thread
+        FrameStats.BackendAllocCount++;
+    }
+    if (block == NULL)
+        return NULL;
+    *(void**)block = FrameOverflow;
+    FrameOverflow = block;
+    FrameOverflowBytes += size;
+    return block + IM_TIERED_ALLOCATOR_HEADER_SIZE;
+}
+
+void ImTieredAllocator::NewFrame()
+{
+    ImTieredAllocatorLockScope lock(Lock);
+    LastFrameStats = FrameStats;
+    memset(&FrameStats, 0, sizeof(FrameStats));
+
+    // Grow arena to fit everything allocated during last frame
+    if (FrameOverflow != NULL)
+    {
+        while (FrameOverflow != NULL)
+        {
+            void* next_block = *(void**)FrameOverflow;
+            BackendFreeFunc(FrameOverflow, BackendUserData);
+            FrameOverflow = next_block;
+        }
+        const size_t new_size = ImMax(FrameArenaSize * 2, FrameArenaUsed + FrameOverflowBytes);
+        if (FrameArena != NULL)
+            BackendFreeFunc(FrameArena, BackendUserData);
+        FrameArena = (char*)BackendAllocFunc(new_size, BackendUserData);
+        FrameArenaSize = FrameArena ? new_size : 0;
+        FrameOverflowBytes = 0;
+        FrameStats.BackendAllocCount++;
+    }
+    FrameArenaUsed = 0;
+}
+
+ImTieredAllocatorStats ImTieredAllocator::GetFrameStats()
+{
+    ImTieredAllocatorLockScope lock(Lock);
+    return FrameStats;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
 //-----------------------------------------------------------------------------
@@ -1349,6 +1545,7 @@ ImGuiIO::ImGuiIO()
     DeltaTime = 1.0f / 60.0f;
     IniSavingRate = 5.0f;
     IniFilename = "imgui.ini"; // Important: "imgui.ini" is relative to current working dir, most apps will want to lock this to an absolute path (e.g. same path as executables).
+    IniSavingThreaded = false;
     LogFilename = "imgui_log.txt";
 #ifndef IMGUI_DISABLE_OBSOLETE_KEYIO
     for (int i = 0; i < ImGuiKey_COUNT; i++)
@@ -1382,14 +1579,18 @@ ImGuiIO::ImGuiIO()
     ConfigMacOSXBehaviors = false;
 #endif
     ConfigInputTrickleEventQueue = true;
+    ConfigInputCoalesceMouseEvents = false;
     ConfigInputTextCursorBlink = true;
     ConfigInputTextEnterKeepActive = false;
     ConfigDragClickToInputText = false;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemorySteadyState = false;
     ConfigDebugBeginReturnValueOnce = false;
     ConfigDebugBeginReturnValueLoop = false;
+    ConfigDebugSteadyStateWarmupFrames = 0;
+    ConfigDebugSteadyStateAssert = false;
 
     // Inputs Behaviors
     MouseDoubleClickTime = 0.30f;
@@ -1652,6 +1853,19 @@ void ImGuiIO::AddMousePosEvent(float x, float y)
     if (latest_pos.x == pos.x && latest_pos.y == pos.y)
         return;
 
+    // Coalesce with the previous event if it is a move from the same source (nothing may be queued in between)
+    if (ConfigInputCoalesceMouseEvents && g.InputEventsQueue.Size > 0)
+    {
+        ImGuiInputEvent* last_event = &g.InputEventsQueue.back();
+        if (last_event->Type == ImGuiInputEventType_MousePos && last_event->MousePos.MouseSource == g.InputEventsNextMouseSource)
+        {
+            last_event->MousePos.PosX = pos.x;
+            last_event->MousePos.PosY = pos.y;
+            g.InputEventsMergedMousePos++;
+            return;
+        }
+    }
+
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MousePos;
     e.Source = ImGuiInputSource_Mouse;
@@ -1720,6 +1934,19 @@ void ImGuiIO::AddMouseWheelEvent(float wheel_x, float wheel_y)
     if (!AppAcceptingEvents || (wheel_x == 0.0f && wheel_y == 0.0f))
         return;
 
+    // Coalesce with the previous event if it is a wheel event from the same source: deltas add up
+    if (ConfigInputCoalesceMouseEvents && g.InputEventsQueue.Size > 0)
+    {
+        ImGuiInputEvent* last_event = &g.InputEventsQueue.back();
+        if (last_event->Type == ImGuiInputEventType_MouseWheel && last_event->MouseWheel.MouseSource == g.InputEventsNextMouseSource)
+        {
+            last_event->MouseWheel.WheelX += wheel_x;
+            last_event->MouseWheel.WheelY += wheel_y;
+            g.InputEventsMergedMouseWheel++;
+            return;
+        }
+    }
+
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MouseWheel;
     e.Source = ImGuiInputSource_Mouse;
@@ -1898,6 +2125,49 @@ ImVec2 ImTriangleClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& c,
     return proj_ca;
 }
 
+// Min/max over a contiguous float array, ignoring NaN values. Outputs FLT_MAX/-FLT_MAX if there are no valid values.
+void ImMinMaxF(const float* data, int count, float* out_min, float* out_max)
+{
+    float v_min = FLT_MAX;
+    float v_max = -FLT_MAX;
+    int i = 0;
+#ifdef IMGUI_ENABLE_SSE
+    // MINPS/MAXPS return their second operand when either is NaN, so passing the accumulator second skips NaN values.
+    if (count >= 8)
+    {
+        __m128 min_a = _mm_set1_ps(FLT_MAX), min_b = min_a;
+        __m128 max_a = _mm_set1_ps(-FLT_MAX), max_b = max_a;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128 va = _mm_loadu_ps(data + i);
+            const __m128 vb = _mm_loadu_ps(data + i + 4);
+            min_a = _mm_min_ps(va, min_a);
+            min_b = _mm_min_ps(vb, min_b);
+            max_a = _mm_max_ps(va, max_a);
+            max_b = _mm_max_ps(vb, max_b);
+        }
+        float mins[4], maxs[4];
+        _mm_storeu_ps(mins, _mm_min_ps(min_a, min_b));
+        _mm_storeu_ps(maxs, _mm_max_ps(max_a, max_b));
+        for (int n = 0; n < 4; n++)
+        {
+            v_min = ImMin(v_min, mins[n]);
+            v_max = ImMax(v_max, maxs[n]);
+        }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        const float v = data[i];
+        if (v != v) // Ignore NaN values
+            continue;
+        v_min = ImMin(v_min, v);
+        v_max = ImMax(v_max, v);
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (String, Format, Hash functions)
 //-----------------------------------------------------------------------------
@@ -2140,17 +2410,113 @@ static const ImU32 GCrc32LookupTable[256] =
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
 };
 
+#ifdef IMGUI_USE_HASH_CRC32C
+// CRC32C (Castagnoli polynomial) lookup table, used when SSE4.2 instructions are not available.
+// Both paths output the same values, so IDs don't depend on compiler flags.
+static const ImU32 GCrc32cLookupTable[256] =
+{
+    0x00000000,0xF26B8303,0xE13B70F7,0x1350F3F4,0xC79A971F,0x35F1141C,0x26A1E7E8,0xD4CA64EB,0x8AD958CF,0x78B2DBCC,0x6BE22838,0x9989AB3B,0x4D43CFD0,0xBF284CD3,0xAC78BF27,0x5E133C24,
+    0x105EC76F,0xE235446C,0xF165B798,0x030E349B,0xD7C45070,0x25AFD373,0x36FF2087,0xC494A384,0x9A879FA0,0x68EC1CA3,0x7BBCEF57,0x89D76C54,0x5D1D08BF,0xAF768BBC,0xBC267848,0x4E4DFB4B,
+    0x20BD8EDE,0xD2D60DDD,0xC186FE29,0x33ED7D2A,0xE72719C1,0x154C9AC2,0x061C6936,0xF477EA35,0xAA64D611,0x580F5512,0x4B5FA6E6,0xB93425E5,0x6DFE410E,0x9F95C20D,0x8CC531F9,0x7EAEB2FA,
+    0x30E349B1,0xC288CAB2,0xD1D83946,0x23B3BA45,0xF779DEAE,0x05125DAD,0x1642AE59,0xE4292D5A,0xBA3A117E,0x4851927D,0x5B016189,0xA96AE28A,0x7DA08661,0x8FCB0562,0x9C9BF696,0x6EF07595,
+    0x417B1DBC,0xB3109EBF,0xA0406D4B,0x522BEE48,0x86E18AA3,0x748A09A0,0x67DAFA54,0x95B17957,0xCBA24573,0x39C9C670,0x2A993584,0xD8F2B687,0x0C38D26C,0xFE53516F,0xED03A29B,0x1F682198,
+    0x5125DAD3,0xA34E59D0,0xB01EAA24,0x42752927,0x96BF4DCC,0x64D4CECF,0x77843D3B,0x85EFBE38,0xDBFC821C,0x2997011F,0x3AC7F2EB,0xC8AC71E8,0x1C661503,0xEE0D9600,0xFD5D65F4,0x0F36E6F7,
+    0x61C69362,0x93AD1061,0x80FDE395,0x72966096,0xA65C047D,0x5437877E,0x4767748A,0xB50CF789,0xEB1FCBAD,0x197448AE,0x0A24BB5A,0xF84F3859,0x2C855CB2,0xDEEEDFB1,0xCDBE2C45,0x3FD5AF46,
+    0x7198540D,0x83F3D70E,0x90A324FA,0x62C8A7F9,0xB602C312,0x44694011,0x5739B3E5,0xA55230E6,0xFB410CC2,0x092A8FC1,0x1A7A7C35,0xE811FF36,0x3CDB9BDD,0xCEB018DE,0xDDE0EB2A,0x2F8B6829,
+    0x82F63B78,0x709DB87B,0x63CD4B8F,0x91A6C88C,0x456CAC67,0xB7072F64,0xA457DC90,0x563C5F93,0x082F63B7,0xFA44E0B4,0xE9141340,0x1B7F9043,0xCFB5F4A8,0x3DDE77AB,0x2E8E845F,0xDCE5075C,
+    0x92A8FC17,0x60C37F14,0x73938CE0,0x81F80FE3,0x55326B08,0xA759E80B,0xB4091BFF,0x466298FC,0x1871A4D8,0xEA1A27DB,0xF94AD42F,0x0B21572C,0xDFEB33C7,0x2D80B0C4,0x3ED04330,0xCCBBC033,
+    0xA24BB5A6,0x502036A5,0x4370C551,0xB11B4652,0x65D122B9,0x97BAA1BA,0x84EA524E,0x7681D14D,0x2892ED69,0xDAF96E6A,0xC9A99D9E,0x3BC21E9D,0xEF087A76,0x1D63F975,0x0E330A81,0xFC588982,
+    0xB21572C9,0x407EF1CA,0x532E023E,0xA145813D,0x758FE5D6,0x87E466D5,0x94B49521,0x66DF1622,0x38CC2A06,0xCAA7A905,0xD9F75AF1,0x2B9CD9F2,0xFF56BD19,0x0D3D3E1A,0x1E6DCDEE,0xEC064EED,
+    0xC38D26C4,0x31E6A5C7,0x22B65633,0xD0DDD530,0x0417B1DB,0xF67C32D8,0xE52CC12C,0x1747422F,0x49547E0B,0xBB3FFD08,0xA86F0EFC,0x5A048DFF,0x8ECEE914,0x7CA56A17,0x6FF599E3,0x9D9E1AE0,
+    0xD3D3E1AB,0x21B862A8,0x32E8915C,0xC083125F,0x144976B4,0xE622F5B7,0xF5720643,0x07198540,0x590AB964,0xAB613A67,0xB831C993,0x4A5A4A90,0x9E902E7B,0x6CFBAD78,0x7FAB5E8C,0x8DC0DD8F,
+    0xE330A81A,0x115B2B19,0x020BD8ED,0xF0605BEE,0x24AA3F05,0xD6C1BC06,0xC5914FF2,0x37FACCF1,0x69E9F0D5,0x9B8273D6,0x88D28022,0x7AB90321,0xAE7367CA,0x5C18E4C9,0x4F48173D,0xBD23943E,
+    0xF36E6F75,0x0105EC76,0x12551F82,0xE03E9C81,0x34F4F86A,0xC69F7B69,0xD5CF889D,0x27A40B9E,0x79B737BA,0x8BDCB4B9,0x988C474D,0x6AE7C44E,0xBE2DA0A5,0x4C4623A6,0x5F16D052,0xAD7D5351,
+};
+#endif
+
+// Helper for ImHashStr() when using a non-default hash: the hash gets reset to the seed value at every "###",
+// so hashing from the last "###" is equivalent to hashing the whole string and resetting along the way.
+#ifdef IMGUI_USE_HASH_WORD
+static inline ImU64 ImHashWordStep(ImU64 h, ImU64 v)
+{
+    h = (h ^ v) * 0x9E3779B97F4A7C15ULL;
+    return ((h << 27) | (h >> 37)) * 5 + 0x52DCE729;
+}
+#endif
+
+#if defined(IMGUI_USE_HASH_CRC32C) || defined(IMGUI_USE_HASH_WORD)
+static inline const char* ImHashStrFindIdStart(const char* data, const char* data_end)
+{
+    const char* id_start = data;
+    for (const char* p = data; (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL; p++)
+        if (p + 2 < data_end && p[1] == '#' && p[2] == '#')
+            id_start = p;
+    return id_start;
+}
+#endif
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// Hash function can be selected in imconfig.h:
+// - Default: byte-at-a-time CRC32. Table lookups pretty much randomly access 1KB.
+// - IMGUI_USE_HASH_CRC32C: CRC32C, 8 bytes per instruction with SSE4.2 (-msse4.2), byte-at-a-time table lookup otherwise.
+// - IMGUI_USE_HASH_WORD: multiplicative hash consuming 8 bytes per step, with a final avalanche. Fastest without SSE4.2.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 {
-    ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#if defined(IMGUI_USE_HASH_CRC32C)
+    ImU32 crc = ~seed;
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE4_2__) || defined(__AVX__))
+#if defined(__x86_64__) || defined(_M_X64)
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = (ImU32)_mm_crc32_u64(crc, v);
+    }
+#endif
+    for (; data_size >= 4; data_size -= 4, data += 4)
+    {
+        ImU32 v;
+        memcpy(&v, data, 4);
+        crc = _mm_crc32_u32(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+#else
+    const ImU32* crc32c_lut = GCrc32cLookupTable;
+    while (data_size-- != 0)
+        crc = (crc >> 8) ^ crc32c_lut[(crc & 0xFF) ^ *data++];
+#endif
+    return ~crc;
+#elif defined(IMGUI_USE_HASH_WORD)
+    ImU64 h = (ImU64)seed ^ ((ImU64)data_size * 0x9E3779B97F4A7C15ULL);
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        h = ImHashWordStep(h, v);
+    }
+    if (data_size > 0)
+    {
+        ImU64 v = 0;
+        memcpy(&v, data, data_size);
+        h = ImHashWordStep(h, v);
+    }
+    // Final avalanche (MurmurHash3 fmix64)
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return (ImGuiID)(h ^ (h >> 32));
+#else
+    ImU32 crc = ~seed;
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data_size-- != 0)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
     return ~crc;
+#endif
 }
 
 // Zero-terminated string hash, with support for ### to reset back to seed value
@@ -2158,9 +2524,26 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// - Non-default hash functions (see ImHashData) locate the last ### first, then hash the remaining data in one go.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
 {
+#if defined(IMGUI_USE_HASH_CRC32C) || defined(IMGUI_USE_HASH_WORD)
+    const char* id_start = data_p;
+    const char* data_end;
+    if (data_size != 0)
+    {
+        data_end = data_p + data_size;
+        id_start = ImHashStrFindIdStart(data_p, data_end);
+    }
+    else
+    {
+        // Short labels are the common case: a single pass is faster than strlen() + memchr()
+        for (data_end = data_p; *data_end; data_end++)
+            if (data_end[0] == '#' && data_end[1] == '#' && data_end[2] == '#')
+                id_start = data_end;
+    }
+    return ImHashData(id_start, (size_t)(data_end - id_start), seed);
+#else
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
@@ -2185,6 +2568,7 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
         }
     }
     return ~crc;
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -2223,6 +2607,21 @@ bool    ImFileClose(ImFileHandle f)     { return fclose(f) == 0; }
 ImU64   ImFileGetSize(ImFileHandle f)   { long off = 0, sz = 0; return ((off = ftell(f)) != -1 && !fseek(f, 0, SEEK_END) && (sz = ftell(f)) != -1 && !fseek(f, off, SEEK_SET)) ? (ImU64)sz : (ImU64)-1; }
 ImU64   ImFileRead(void* data, ImU64 sz, ImU64 count, ImFileHandle f)           { return fread(data, (size_t)sz, (size_t)count, f); }
 ImU64   ImFileWrite(const void* data, ImU64 sz, ImU64 count, ImFileHandle f)    { return fwrite(data, (size_t)sz, (size_t)count, f); }
+
+// rename() atomically replaces an existing file on POSIX systems, MoveFileExW() is the closest equivalent on Windows.
+// Doesn't allocate, so it may be used from worker threads.
+bool    ImFileRename(const char* src_filename, const char* dst_filename)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__)
+    wchar_t src_wbuf[1024];
+    wchar_t dst_wbuf[1024];
+    if (::MultiByteToWideChar(CP_UTF8, 0, src_filename, -1, src_wbuf, IM_ARRAYSIZE(src_wbuf)) == 0 || ::MultiByteToWideChar(CP_UTF8, 0, dst_filename, -1, dst_wbuf, IM_ARRAYSIZE(dst_wbuf)) == 0)
+        return false;
+    return ::MoveFileExW(src_wbuf, dst_wbuf, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return rename(src_filename, dst_filename) == 0;
+#endif
+}
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 
 // Helper: Load file content into memory
@@ -2328,12 +2727,66 @@ int ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char*
     return wanted;
 }
 
+// Count leading bytes which can be processed as single-byte characters without UTF-8 decoding.
+// Stops at the first zero or >= 0x80 byte, so callers can bulk-process pure-ASCII runs and only use ImTextCharFromUtf8() on multi-byte sequences.
+int ImTextCountLeadingAscii(const char* in_text, const char* in_text_end)
+{
+    IM_ASSERT(in_text_end != NULL);
+    const char* p = in_text;
+#ifdef IMGUI_ENABLE_SSE2
+    // Bytes in the 0x01..0x7F range are the only ones greater than zero when compared as signed values.
+#ifdef __AVX2__
+    const __m256i zero_256 = _mm256_setzero_si256();
+    while (in_text_end - p >= 32)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(const void*)p);
+        if ((unsigned int)_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, zero_256)) != 0xFFFFFFFFu)
+            break;
+        p += 32;
+    }
+#endif
+    const __m128i zero_128 = _mm_setzero_si128();
+    while (in_text_end - p >= 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)p);
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(v, zero_128)) != 0xFFFF)
+            break;
+        p += 16;
+    }
+#else
+    // Word-at-a-time: (w - 0x01..) sets the high bit of zero bytes, w sets the high bit of non-ASCII bytes.
+    const ImU64 lo_bits = 0x0101010101010101ULL;
+    const ImU64 hi_bits = 0x8080808080808080ULL;
+    while (in_text_end - p >= 8)
+    {
+        ImU64 w;
+        memcpy(&w, p, 8);
+        if (((w - lo_bits) | w) & hi_bits)
+            break;
+        p += 8;
+    }
+#endif
+    while (p < in_text_end && (signed char)*p > 0)
+        p++;
+    return (int)(p - in_text);
+}
+
 int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_text_remaining)
 {
     ImWchar* buf_out = buf;
     ImWchar* buf_end = buf + buf_size;
     while (buf_out < buf_end - 1 && (!in_text_end || in_text < in_text_end) && *in_text)
     {
+        // Fast path: widen a whole run of ASCII characters at once (isolated ASCII characters e.g. in CJK text go through the regular path)
+        if (in_text_end != NULL && in_text + 1 < in_text_end && ((unsigned char)in_text[0] | (unsigned char)in_text[1]) < 0x80)
+        {
+            const int run_len = ImMin(ImTextCountLeadingAscii(in_text, in_text_end), (int)(buf_end - 1 - buf_out));
+            for (int n = 0; n < run_len; n++)
+                buf_out[n] = (ImWchar)in_text[n];
+            buf_out += run_len;
+            in_text += run_len;
+            continue;
+        }
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         *buf_out++ = (ImWchar)c;
@@ -2349,6 +2802,14 @@ int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
     int char_count = 0;
     while ((!in_text_end || in_text < in_text_end) && *in_text)
     {
+        // Fast path: skip a whole run of ASCII characters at once (isolated ASCII characters e.g. in CJK text go through the regular path)
+        if (in_text_end != NULL && in_text + 1 < in_text_end && ((unsigned char)in_text[0] | (unsigned char)in_text[1]) < 0x80)
+        {
+            const int run_len = ImTextCountLeadingAscii(in_text, in_text_end);
+            char_count += run_len;
+            in_text += run_len;
+            continue;
+        }
         unsigned int c;
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         char_count++;
@@ -2585,6 +3046,98 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+// Hashed mode: HashIndex is an open-addressing table with linear probing, indexing into Data.
+// There is no removal API so we never need tombstones. Load factor is kept <= 0.5.
+static inline int StorageHashSlot(ImGuiID key, int mask)
+{
+    ImU32 h = key * 0x9E3779B1u; // Keys are usually hashes already, but user storages may use sequential integers.
+    return (int)((h ^ (h >> 16)) & (ImU32)mask);
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageHashFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->HashIndex.Size == 0)
+        return NULL;
+    const int mask = storage->HashIndex.Size - 1;
+    for (int slot = StorageHashSlot(key, mask); ; slot = (slot + 1) & mask)
+    {
+        const int idx = storage->HashIndex.Data[slot];
+        if (idx == -1)
+            return NULL;
+        if (storage->Data.Data[idx].key == key)
+            return &storage->Data.Data[idx];
+    }
+}
+
+static void StorageHashRebuild(ImGuiStorage* storage, int table_size)
+{
+    IM_ASSERT(ImIsPowerOfTwo(table_size) && table_size >= storage->Data.Size * 2);
+    storage->HashIndex.resize(table_size);
+    memset(storage->HashIndex.Data, 0xFF, (size_t)storage->HashIndex.size_in_bytes());
+    const int mask = table_size - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        int slot = StorageHashSlot(storage->Data.Data[n].key, mask);
+        while (storage->HashIndex.Data[slot] != -1)
+            slot = (slot + 1) & mask;
+        storage->HashIndex.Data[slot] = n;
+    }
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageHashGetOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& default_pair)
+{
+    if ((storage->Data.Size + 1) * 2 > storage->HashIndex.Size)
+        StorageHashRebuild(storage, ImMax(storage->HashIndex.Size * 2, 16));
+    const int mask = storage->HashIndex.Size - 1;
+    int slot = StorageHashSlot(default_pair.key, mask);
+    for (int idx; (idx = storage->HashIndex.Data[slot]) != -1; slot = (slot + 1) & mask)
+        if (storage->Data.Data[idx].key == default_pair.key)
+            return &storage->Data.Data[idx];
+    storage->HashIndex.Data[slot] = storage->Data.Size;
+    storage->Data.push_back(default_pair);
+    return &storage->Data.back();
+}
+
+// Find pair, or insert it (at its sorted position in sorted mode, at the end in hashed mode).
+static ImGuiStorage::ImGuiStoragePair* StorageGetOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& default_pair)
+{
+    if (storage->UseHashIndex)
+        return StorageHashGetOrInsert(storage, default_pair);
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(storage->Data, default_pair.key);
+    if (it == storage->Data.end() || it->key != default_pair.key)
+        it = storage->Data.insert(it, default_pair);
+    return it;
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->UseHashIndex)
+        return StorageHashFind(storage, key);
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStorage::ImGuiStoragePair>&>(storage->Data), key);
+    if (it == storage->Data.end() || it->key != key)
+        return NULL;
+    return it;
+}
+
+void ImGuiStorage::SetUseHashIndex(bool enabled)
+{
+    if (UseHashIndex == enabled)
+        return;
+    UseHashIndex = enabled;
+    if (enabled && Data.Size > 0) // Otherwise the index is created on first insertion
+    {
+        int table_size = 16;
+        while (table_size < Data.Size * 2)
+            table_size <<= 1;
+        StorageHashRebuild(this, table_size);
+    }
+    else
+    {
+        HashIndex.clear();
+        BuildSortByKey();
+    }
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -2599,14 +3152,23 @@ void ImGuiStorage::BuildSortByKey()
         }
     };
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairComparerByID);
+    if (UseHashIndex && Data.Size == 0)
+    {
+        HashIndex.resize(0);
+    }
+    else if (UseHashIndex)
+    {
+        int table_size = ImMax(HashIndex.Size, 16);
+        while (table_size < Data.Size * 2)
+            table_size <<= 1;
+        StorageHashRebuild(this, table_size);
+    }
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2616,27 +3178,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &StorageGetOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2646,28 +3201,17 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &StorageGetOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &StorageGetOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_i = val;
+    StorageGetOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2677,20 +3221,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_f = val;
+    StorageGetOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_p = val;
+    StorageGetOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2945,10 +3481,78 @@ static void ImGuiListClipper_SeekCursorForItem(ImGuiListClipper* clipper, int it
     // StartPosY starts from ItemsFrozen hence the subtraction
     // Perform the add and multiply with double to allow seeking through larger ranges
     ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    if (ImGuiListClipperHeights* heights = data->Heights)
+    {
+        float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + heights->GetItemOffset(item_n) - heights->GetItemOffset(data->ItemsFrozen));
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
+        return;
+    }
     float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
 }
 
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    // Rebuild the tree in O(N) whenever the number of items changes
+    IM_ASSERT(items_count >= 0);
+    if (items_count == Heights.Size && Tree.Size == items_count + 1)
+        return;
+    const int old_count = Heights.Size;
+    const float default_height = (DefaultHeight > 0.0f) ? DefaultHeight : ImGui::GetTextLineHeightWithSpacing();
+    Heights.resize(items_count);
+    for (int n = old_count; n < items_count; n++)
+        Heights[n] = default_height;
+    Tree.resize(items_count + 1);
+    Tree[0] = 0.0;
+    for (int i = 1; i <= items_count; i++)
+        Tree[i] = Heights[i - 1];
+    for (int i = 1; i <= items_count; i++)
+    {
+        const int parent = i + (i & -i);
+        if (parent <= items_count)
+            Tree[parent] += Tree[i];
+    }
+}
+
+void ImGuiListClipperHeights::SetItemHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size && Tree.Size == Heights.Size + 1);
+    const double delta = (double)height - Heights[item_n];
+    if (delta == 0.0)
+        return;
+    Heights[item_n] = height;
+    for (int i = item_n + 1; i <= Heights.Size; i += (i & -i))
+        Tree[i] += delta;
+}
+
+double ImGuiListClipperHeights::GetItemOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Heights.Size && Tree.Size == Heights.Size + 1);
+    double offset = 0.0;
+    for (int i = item_n; i > 0; i -= (i & -i))
+        offset += Tree[i];
+    return offset;
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    // Descend the tree to find the largest 'n' where GetItemOffset(n) <= offset
+    const int count = Heights.Size;
+    if (count == 0 || offset <= 0.0)
+        return 0;
+    int n = 0;
+    int step = 1;
+    while (step * 2 <= count)
+        step *= 2;
+    for (; step > 0; step >>= 1)
+        if (n + step <= count && Tree[n + step] <= offset)
+        {
+            n += step;
+            offset -= Tree[n];
+        }
+    return ImMin(n, count - 1);
+}
+
 ImGuiListClipper::ImGuiListClipper()
 {
     memset(this, 0, sizeof(*this));
@@ -2987,6 +3591,20 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     TempData = data;
 }
 
+void ImGuiListClipper::BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(heights != NULL && items_count >= 0 && items_count < INT_MAX);
+    if (Ctx == NULL)
+        Ctx = ImGui::GetCurrentContext();
+    if (heights->DefaultHeight <= 0.0f)
+        heights->DefaultHeight = Ctx->FontSize + Ctx->Style.ItemSpacing.y;
+    heights->Resize(items_count);
+
+    // ItemsHeight is only used as a hint for table row background when seeking
+    Begin(items_count, heights->DefaultHeight);
+    ((ImGuiListClipperData*)TempData)->Heights = heights;
+}
+
 void ImGuiListClipper::End()
 {
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
@@ -3030,6 +3648,18 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
 
+    // Variable height: measure the item submitted by the previous step
+    ImGuiListClipperHeights* heights = data->Heights;
+    if (heights && data->MeasureItem >= 0)
+    {
+        float item_height = window->DC.CursorPos.y - data->MeasureStartPosY;
+        if (ImIsFloatAboveGuaranteedIntegerPrecision(window->DC.CursorPos.y))
+            item_height = window->DC.PrevLineSize.y + g.Style.ItemSpacing.y;
+        if (item_height > 0.0f)
+            heights->SetItemHeight(data->MeasureItem, item_height);
+        data->MeasureItem = -1;
+    }
+
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping())
         return false;
@@ -3111,8 +3741,18 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         // - Very important: when a starting position is after our maximum item, we set Min to (ItemsCount - 1). This allows us to handle most forms of wrapping.
         // - Due to how Selectable extra padding they tend to be "unaligned" with exact unit in the item list,
         //   which with the flooring/ceiling tend to lead to 2 items instead of one being submitted.
+        // - With variable height, positions are looked up in the tree of item heights.
+        const double heights_base = heights ? heights->GetItemOffset(data->ItemsFrozen) - window->DC.CursorPos.y - data->LossynessOffset : 0.0;
         for (ImGuiListClipperRange& range : data->Ranges)
-            if (range.PosToIndexConvert)
+            if (range.PosToIndexConvert && heights)
+            {
+                int m1 = heights->FindItemAtOffset(heights_base + range.Min);
+                int m2 = heights->FindItemAtOffset(heights_base + range.Max) + 1;
+                range.Min = ImClamp(m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
+                range.Max = ImClamp(m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
+                range.PosToIndexConvert = false;
+            }
+            else if (range.PosToIndexConvert)
             {
                 int m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
                 int m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
@@ -3124,8 +3764,27 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     }
 
     // Step 0+ (if item height is given in advance) or 1+: Display the next range in line.
+    // With variable height, items are returned one at a time so each of them can be measured on the next step:
+    // the rest of the range is queued as the next step.
     while (data->StepNo < data->Ranges.Size)
     {
+        if (heights)
+        {
+            const int item_n = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
+            const int item_end = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
+            data->StepNo++;
+            if (item_n >= item_end)
+                continue;
+            if (item_n + 1 < item_end)
+                data->Ranges.insert(data->Ranges.Data + data->StepNo, ImGuiListClipperRange::FromIndices(item_n + 1, item_end));
+            if (item_n > already_submitted)
+                ImGuiListClipper_SeekCursorForItem(clipper, item_n);
+            clipper->DisplayStart = item_n;
+            clipper->DisplayEnd = item_n + 1;
+            data->MeasureItem = item_n;
+            data->MeasureStartPosY = window->DC.CursorPos.y;
+            return true;
+        }
         clipper->DisplayStart = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
         if (clipper->DisplayStart > already_submitted) //-V1051
@@ -3432,6 +4091,197 @@ const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
     return text_display_end;
 }
 
+// Text layout cache
+// - Lookups hash (font, size, wrap width, text), which is cheaper than measuring and word-wrapping the text again.
+// - Glyph advances pointer is part of the key so a rebuilt font atlas doesn't reuse stale measurements.
+ImGuiTextLayoutCacheEntry* ImGui::TextLayoutCacheGet(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextLayoutCache* cache = &g.TextLayoutCache;
+    const int text_len = (int)(text_end - text);
+    if (cache->MaxEntries <= 0 || (wrap_width <= 0.0f && text_len < cache->MinTextLen))
+        return NULL;
+
+    const void* key_font[2] = { font, font->IndexAdvanceX.Data };
+    const float key_sizes[2] = { font_size, ImMax(wrap_width, 0.0f) };
+    ImGuiID key = ImHashData(key_font, sizeof(key_font), 0);
+    key = ImHashData(key_sizes, sizeof(key_sizes), key);
+    key = ImHashData(text, (size_t)text_len, key);
+
+    const int entry_idx = cache->Map.GetInt(key, -1);
+    if (entry_idx != -1)
+    {
+        ImGuiTextLayoutCacheEntry* entry = &cache->Entries[entry_idx];
+        if (entry->Font == font && entry->FontAdvances == font->IndexAdvanceX.Data && entry->FontSize == key_sizes[0] && entry->WrapWidth == key_sizes[1]
+            && entry->TextLen == text_len && memcmp(cache->TextData.Data + entry->TextOffset, text, (size_t)text_len) == 0)
+        {
+            entry->LastFrameUsed = g.FrameCount;
+            cache->HitsThisFrame++;
+            return entry;
+        }
+    }
+    cache->MissesThisFrame++;
+    if (entry_idx != -1 || cache->GetEntriesCount() >= cache->MaxEntries)
+        return NULL; // Hash collision or cache full: caller will measure without caching.
+
+    ImGuiTextLayoutCacheEntry entry;
+    entry.Key = key;
+    entry.Font = font;
+    entry.FontAdvances = font->IndexAdvanceX.Data;
+    entry.FontSize = key_sizes[0];
+    entry.WrapWidth = key_sizes[1];
+    entry.TextOffset = cache->TextData.Size;
+    entry.TextLen = text_len;
+    cache->TextData.resize(cache->TextData.Size + text_len);
+    memcpy(cache->TextData.Data + entry.TextOffset, text, (size_t)text_len);
+    entry.LastFrameUsed = g.FrameCount;
+    entry.Size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_end, NULL);
+    entry.LinesOffset = -1;
+    entry.LinesCount = 0;
+    if (cache->FreeEntries.Size > 0)
+    {
+        const int free_idx = cache->FreeEntries.back();
+        cache->FreeEntries.pop_back();
+        cache->Map.SetInt(key, free_idx);
+        cache->Entries[free_idx] = entry;
+        return &cache->Entries[free_idx];
+    }
+    cache->Map.SetInt(key, cache->Entries.Size);
+    cache->Entries.push_back(entry);
+    return &cache->Entries.back();
+}
+
+// Store the [begin, end) range of each visual line, following the exact same wrapping logic as ImFont::RenderText().
+// Rendering each line separately without wrapping then outputs the same vertices as rendering the whole text with wrapping.
+void ImGui::TextLayoutCacheBuildLines(ImGuiTextLayoutCacheEntry* entry, ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    if (entry->LinesOffset != -1)
+        return;
+    ImGuiContext& g = *GImGui;
+    ImVector<int>& line_ranges = g.TextLayoutCache.LineRanges;
+    entry->LinesOffset = line_ranges.Size / 2;
+
+    const float scale = font_size / font->FontSize;
+    const char* s = text;
+    const char* line_begin = text;
+    const char* word_wrap_eol = NULL;
+    while (s < text_end)
+    {
+        if (!word_wrap_eol)
+            word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width);
+        if (s >= word_wrap_eol)
+        {
+            line_ranges.push_back((int)(line_begin - text));
+            line_ranges.push_back((int)(s - text));
+            word_wrap_eol = NULL;
+            while (s < text_end && ImCharIsBlankA(*s)) // Wrapping skips upcoming blanks
+                s++;
+            if (s < text_end && *s == '\n')
+                s++;
+            line_begin = s;
+            continue;
+        }
+        const char* prev_s = s;
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+        if (c == '\n')
+        {
+            line_ranges.push_back((int)(line_begin - text));
+            line_ranges.push_back((int)(prev_s - text));
+            line_begin = s;
+        }
+    }
+    if (line_begin < text_end)
+    {
+        line_ranges.push_back((int)(line_begin - text));
+        line_ranges.push_back((int)(text_end - text));
+    }
+    entry->LinesCount = line_ranges.Size / 2 - entry->LinesOffset;
+}
+
+// Called by NewFrame(). Check up to MaxEntries/16 entries, evicting those which haven't been used for MaxAge frames,
+// or haven't been used last frame if the cache is full. Compact once evicted entries hold half of the cache, so the
+// cost of compacting (and sorting the map) is amortized over evictions instead of being paid every frame.
+void ImGui::TextLayoutCacheGarbageCollect()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextLayoutCache* cache = &g.TextLayoutCache;
+    cache->HitsLastFrame = cache->HitsThisFrame;
+    cache->MissesLastFrame = cache->MissesThisFrame;
+    cache->HitsTotal += cache->HitsThisFrame;
+    cache->MissesTotal += cache->MissesThisFrame;
+    cache->HitsThisFrame = cache->MissesThisFrame = 0;
+    if (cache->MaxEntries <= 0 && cache->Entries.Size > 0)
+        cache->Clear();
+    if (cache->Entries.Size == 0)
+        return;
+
+    const bool is_full = cache->GetEntriesCount() >= cache->MaxEntries;
+    const int min_frame_used = is_full ? g.FrameCount - 1 : g.FrameCount - cache->MaxAge;
+    const int sweep_count = ImMin(ImMax(cache->MaxEntries / 16, 64), cache->Entries.Size);
+    for (int n = 0; n < sweep_count; n++)
+    {
+        if (cache->SweepIndex >= cache->Entries.Size)
+            cache->SweepIndex = 0;
+        const int entry_idx = cache->SweepIndex++;
+        ImGuiTextLayoutCacheEntry* entry = &cache->Entries[entry_idx];
+        if (entry->Font == NULL || entry->LastFrameUsed >= min_frame_used)
+            continue;
+        cache->Map.SetInt(entry->Key, -1);
+        cache->GarbageKeys++;
+        cache->GarbageTextLen += entry->TextLen;
+        if (entry->LinesOffset != -1)
+            cache->GarbageLinesCount += entry->LinesCount;
+        entry->Font = NULL;
+        cache->FreeEntries.push_back(entry_idx);
+    }
+    if (cache->GarbageKeys * 2 > cache->Entries.Size || cache->GarbageTextLen * 2 > cache->TextData.Size || cache->GarbageLinesCount * 4 > cache->LineRanges.Size)
+        TextLayoutCacheCompact();
+}
+
+// Remove evicted entries, their map keys, text and lines
+void ImGui::TextLayoutCacheCompact()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextLayoutCache* cache = &g.TextLayoutCache;
+    ImVector<int>& old_line_ranges = cache->LineRangesTemp;
+    old_line_ranges.swap(cache->LineRanges);
+    cache->LineRanges.resize(0);
+    ImVector<char>& old_text_data = cache->TextDataTemp;
+    old_text_data.swap(cache->TextData);
+    cache->TextData.resize(0);
+    cache->Map.Data.resize(0);
+    int dst_n = 0;
+    for (int src_n = 0; src_n < cache->Entries.Size; src_n++)
+    {
+        ImGuiTextLayoutCacheEntry entry = cache->Entries[src_n];
+        if (entry.Font == NULL)
+            continue;
+        if (entry.LinesOffset != -1)
+        {
+            const int lines_offset = cache->LineRanges.Size / 2;
+            cache->LineRanges.resize(cache->LineRanges.Size + entry.LinesCount * 2);
+            memcpy(cache->LineRanges.Data + lines_offset * 2, old_line_ranges.Data + entry.LinesOffset * 2, (size_t)entry.LinesCount * 2 * sizeof(int));
+            entry.LinesOffset = lines_offset;
+        }
+        const int text_offset = cache->TextData.Size;
+        cache->TextData.resize(text_offset + entry.TextLen);
+        memcpy(cache->TextData.Data + text_offset, old_text_data.Data + entry.TextOffset, (size_t)entry.TextLen);
+        entry.TextOffset = text_offset;
+        cache->Entries[dst_n] = entry;
+        cache->Map.Data.push_back(ImGuiStorage::ImGuiStoragePair(entry.Key, dst_n));
+        dst_n++;
+    }
+    cache->Entries.resize(dst_n);
+    cache->Map.BuildSortByKey();
+    cache->FreeEntries.resize(0);
+    cache->SweepIndex = 0;
+    cache->GarbageKeys = cache->GarbageTextLen = cache->GarbageLinesCount = 0;
+}
+
 // Internal ImGui functions to render text
 // RenderText***() functions calls ImDrawList::AddText() calls ImBitmapFont::RenderText()
 void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool hide_text_after_hash)
@@ -3470,7 +4320,28 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
     if (text != text_end)
     {
-        window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        ImGuiTextLayoutCacheEntry* layout = (wrap_width > 0.0f) ? TextLayoutCacheGet(g.Font, g.FontSize, wrap_width, text, text_end) : NULL;
+        if (layout != NULL)
+        {
+            // Use cached word-wrap positions to submit visible lines only
+            TextLayoutCacheBuildLines(layout, g.Font, g.FontSize, wrap_width, text, text_end);
+            const ImU32 col = GetColorU32(ImGuiCol_Text);
+            const ImVec4& clip_rect = window->DrawList->_CmdHeader.ClipRect;
+            const float line_height = g.FontSize;
+            const float line_y0 = IM_TRUNC(pos.y);
+            const int* line_ranges = g.TextLayoutCache.LineRanges.Data + layout->LinesOffset * 2;
+            for (int line_n = ImMax(0, (int)((clip_rect.y - line_y0) / line_height) - 1); line_n < layout->LinesCount; line_n++)
+            {
+                const float line_y = line_y0 + line_n * line_height;
+                if (line_y > clip_rect.w)
+                    break;
+                window->DrawList->AddText(g.Font, g.FontSize, ImVec2(pos.x, line_y), col, text + line_ranges[line_n * 2], text + line_ranges[line_n * 2 + 1]);
+            }
+        }
+        else
+        {
+            window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
+        }
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_end);
     }
@@ -3758,6 +4629,8 @@ void ImGui::Initialize()
         AddSettingsHandler(&ini_handler);
     }
     TableSettingsAddSettingsHandler();
+    g.SettingsWindowsMap.SetUseHashIndex(true);
+    g.SettingsTablesMap.SetUseHashIndex(true);
 
     // Setup default localization table
     LocalizeRegisterEntries(GLocalizationEntriesEnUS, IM_ARRAYSIZE(GLocalizationEntriesEnUS));
@@ -3818,6 +4691,14 @@ void ImGui::Shutdown()
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
     if (g.SettingsLoaded && g.IO.IniFilename != NULL)
         SaveIniSettingsToDisk(g.IO.IniFilename);
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    WaitIniSettingsSaved();
+    if (g.SettingsSaveJob != NULL)
+    {
+        IM_DELETE(g.SettingsSaveJob);
+        g.SettingsSaveJob = NULL;
+    }
+#endif
 
     // Destroy platform windows
     DestroyPlatformWindows();
@@ -3856,6 +4737,9 @@ void ImGui::Shutdown()
     g.ShrinkWidthBuffer.clear();
 
     g.ClipperTempData.clear_destruct();
+    for (void* ptr : g.FrameAllocs)
+        IM_FREE(ptr);
+    g.FrameAllocs.clear();
 
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
@@ -3863,10 +4747,16 @@ void ImGui::Shutdown()
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
+    g.TextLayoutCache.Clear();
     g.InputTextState.ClearFreeMemory();
     g.InputTextDeactivatedState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsTables.clear();
+    g.SettingsWindowsMap.Clear();
+    g.SettingsTablesMap.Clear();
+    g.SettingsWindowsIniCache.clear();
+    g.SettingsWindowsIniCacheTemp.clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -3975,6 +4865,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     ImGuiContext& g = *GImGui;
     g.ItemFlagsStack.clear();
     g.GroupStack.clear();
+    g.TextLayoutCache.Clear();
     TableGcCompactSettings();
 }
 
@@ -4384,11 +5275,27 @@ void* ImGui::MemAlloc(size_t size)
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
+    {
         DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (ctx->IO.ConfigDebugSteadyStateWarmupFrames > 0 && ctx->FrameCount >= ctx->DebugAllocInfo.SteadyStateFrameStart + ctx->IO.ConfigDebugSteadyStateWarmupFrames)
+            DebugAllocReportSteadyState(ctx, size);
+    }
 #endif
     return ptr;
 }
 
+// Transient allocation, valid until next NewFrame(). Don't call MemFree() on it.
+// With ImTieredAllocator installed this is a bump allocation from its frame arena, otherwise we keep track of the allocation and free it in NewFrame().
+void* ImGui::MemAllocFrame(size_t size)
+{
+    if (GImAllocatorAllocFunc == ImTieredAllocator::AllocFunc)
+        return ((ImTieredAllocator*)GImAllocatorUserData)->AllocFrame(size);
+    ImGuiContext& g = *GImGui;
+    void* ptr = IM_ALLOC(size);
+    g.FrameAllocs.push_back(ptr);
+    return ptr;
+}
+
 // IM_FREE() == ImGui::MemFree()
 void ImGui::MemFree(void* ptr)
 {
@@ -4411,10 +5318,12 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
         entry = &info->LastEntriesBuf[info->LastEntriesIdx];
         entry->FrameCount = frame_count;
         entry->AllocCount = entry->FreeCount = 0;
+        entry->AllocBytes = 0;
     }
     if (size != (size_t)-1)
     {
         entry->AllocCount++;
+        entry->AllocBytes += (int)size;
         info->TotalAllocCount++;
         //printf("[%05d] MemAlloc(%d) -> 0x%p\n", frame_count, size, ptr);
     }
@@ -4426,6 +5335,48 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
     }
 }
 
+// Record a heap allocation made after warm-up, tagged with the current DebugAllocPushTag() stack, window and table.
+// This is called from MemAlloc() so it must not allocate itself.
+static void ImGui::DebugAllocReportSteadyState(ImGuiContext* ctx, size_t size)
+{
+    ImGuiDebugAllocInfo* info = &ctx->DebugAllocInfo;
+    info->SteadyStateAllocCount++;
+    info->ReportsIdx = (info->ReportsIdx + 1) % IM_ARRAYSIZE(info->ReportsBuf);
+    ImGuiDebugAllocReport* report = &info->ReportsBuf[info->ReportsIdx];
+    report->FrameCount = ctx->FrameCount;
+    report->Size = (int)size;
+
+    char* p = report->Tags;
+    char* p_end = report->Tags + IM_ARRAYSIZE(report->Tags);
+    p[0] = 0;
+    for (int n = 0; n < info->TagStackSize && p + 1 < p_end; n++)
+        p += ImFormatString(p, p_end - p, "%s%s", (n > 0) ? " > " : "", info->TagStack[n]);
+    if (ctx->CurrentWindow != NULL && p + 1 < p_end)
+        p += ImFormatString(p, p_end - p, "%s%s", (p > report->Tags) ? " > " : "", ctx->CurrentWindow->Name);
+    if (ctx->CurrentTable != NULL && p + 1 < p_end)
+        p += ImFormatString(p, p_end - p, " > table 0x%08X", ctx->CurrentTable->ID);
+    if (report->Tags[0] == 0)
+        ImStrncpy(report->Tags, "(outside of frame)", IM_ARRAYSIZE(report->Tags));
+
+    IM_ASSERT(!ctx->IO.ConfigDebugSteadyStateAssert && "Heap allocation after warm-up! See Metrics/Debugger->Memory allocations for the tag stack.");
+}
+
+void ImGui::DebugAllocPushTag(const char* tag)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
+    if (info->TagStackSize < IM_ARRAYSIZE(info->TagStack))
+        info->TagStack[info->TagStackSize] = tag;
+    info->TagStackSize++; // Deeper tags are not recorded but we keep count so Push/Pop stay balanced
+}
+
+void ImGui::DebugAllocPopTag()
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.DebugAllocInfo.TagStackSize > 0 && "Calling DebugAllocPopTag() too many times!");
+    g.DebugAllocInfo.TagStackSize--;
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -4833,6 +5784,7 @@ void ImGui::NewFrame()
             g.Hooks.erase(&g.Hooks[n]);
 
     CallContextHooks(&g, ImGuiContextHookType_NewFramePre);
+    DebugAllocPushTag("NewFrame");
 
     // Check and assert for various common IO and Configuration mistakes
     g.ConfigFlagsLastFrame = g.ConfigFlagsCurrFrame;
@@ -4849,6 +5801,13 @@ void ImGui::NewFrame()
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
 
+    // Release transient allocations made with MemAllocFrame() during last frame
+    if (GImAllocatorAllocFunc == ImTieredAllocator::AllocFunc)
+        ((ImTieredAllocator*)GImAllocatorUserData)->NewFrame();
+    for (void* ptr : g.FrameAllocs)
+        IM_FREE(ptr);
+    g.FrameAllocs.resize(0);
+
     // Calculate frame-rate for the user, as a purely luxurious feature
     g.FramerateSecPerFrameAccum += g.IO.DeltaTime - g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx];
     g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx] = g.IO.DeltaTime;
@@ -5023,8 +5982,13 @@ void ImGui::NewFrame()
     UpdateMouseWheel();
 
     // Mark all windows as not visible and compact unused memory.
+    // In steady-state mode (or with a negative timer) buffers are kept at their high-water mark, only an explicit GC request compacts them.
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
-    const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
+    float memory_compact_start_time = (float)g.Time - g.IO.ConfigMemoryCompactTimer;
+    if (g.GcCompactAll)
+        memory_compact_start_time = FLT_MAX;
+    else if (g.IO.ConfigMemorySteadyState || g.IO.ConfigMemoryCompactTimer < 0.0f)
+        memory_compact_start_time = -FLT_MAX;
     for (ImGuiWindow* window : g.Windows)
     {
         window->WasActive = window->Active;
@@ -5049,6 +6013,9 @@ void ImGui::NewFrame()
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
 
+    // Garbage collect text layout cache entries which haven't been used recently
+    TextLayoutCacheGarbageCollect();
+
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
         FocusTopMostWindowUnderOne(NULL, NULL, NULL, ImGuiFocusRequestFlags_RestoreFocusedChild);
@@ -5099,6 +6066,7 @@ void ImGui::NewFrame()
         g.DebugBeginReturnValueCullDepth = -1;
 #endif
 
+    DebugAllocPopTag();
     CallContextHooks(&g, ImGuiContextHookType_NewFramePost);
 }
 
@@ -5355,6 +6323,7 @@ void ImGui::EndFrame()
     IM_ASSERT(g.WithinFrameScope && "Forgot to call ImGui::NewFrame()?");
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
+    DebugAllocPushTag("EndFrame");
 
     ErrorCheckEndFrameSanityChecks();
 
@@ -5435,6 +6404,7 @@ void ImGui::EndFrame()
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
     g.IO.InputQueueCharacters.resize(0);
 
+    DebugAllocPopTag();
     CallContextHooks(&g, ImGuiContextHookType_EndFramePost);
 }
 
@@ -5454,6 +6424,7 @@ void ImGui::Render()
 
     g.IO.MetricsRenderWindows = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
+    DebugAllocPushTag("Render");
 
     // Add background ImDrawList (for each active viewport)
     for (ImGuiViewportP* viewport : g.Viewports)
@@ -5504,6 +6475,7 @@ void ImGui::Render()
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
 
+    DebugAllocPopTag();
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
@@ -5523,7 +6495,13 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    if (text_display_end == NULL)
+        text_display_end = text + strlen(text);
+    ImVec2 text_size;
+    if (ImGuiTextLayoutCacheEntry* layout = TextLayoutCacheGet(font, font_size, wrap_width, text, text_display_end))
+        text_size = layout->Size;
+    else
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -5949,6 +6927,11 @@ ImGuiWindow* ImGui::FindWindowByName(const char* name)
     return FindWindowByID(id);
 }
 
+ImGuiID ImGui::GetWindowIDFromName(const char* name)
+{
+    return ImHashStr(name);
+}
+
 static void ApplyWindowSettings(ImGuiWindow* window, ImGuiWindowSettings* settings)
 {
     const ImGuiViewport* main_viewport = ImGui::GetMainViewport();
@@ -6867,6 +7850,13 @@ ImGuiWindow* ImGui::FindBlockingModal(ImGuiWindow* window)
 // - Return false when window is collapsed, so you can early out in your code. You always need to call ImGui::End() even if false is returned.
 // - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
+{
+    IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
+    return Begin(ImHashStr(name), name, p_open, flags);
+}
+
+// Same as above with a precomputed window ID (see GetWindowIDFromName()), skipping the hashing of 'name'.
+bool ImGui::Begin(ImGuiID id, const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
@@ -6875,11 +7865,14 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
 
     // Find or create
-    ImGuiWindow* window = FindWindowByName(name);
+    ImGuiWindow* window = FindWindowByID(id);
     const bool window_just_created = (window == NULL);
     if (window_just_created)
         window = CreateNewWindow(name, flags);
 
+    // Checked on every call, as a mismatched name would otherwise silently reuse another window. Only hash when the name differs from the stored one.
+    IM_ASSERT(window->ID == id && (strcmp(name, window->Name) == 0 || ImHashStr(name) == id) && "Window ID doesn't match name. Use GetWindowIDFromName() to compute it.");
+
     // [DEBUG] Debug break requested by user
     if (g.DebugBreakInWindow == window->ID)
         IM_DEBUG_BREAK();
@@ -14434,6 +15427,8 @@ void ImGui::LogButtons()
 // - LoadIniSettingsFromDisk()
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
+// - SaveIniSettingsToDiskThreaded() [Internal]
+// - WaitIniSettingsSaved() [Internal]
 // - SaveIniSettingsToMemory()
 //-----------------------------------------------------------------------------
 // - CreateNewWindowSettings() [Internal]
@@ -14462,11 +15457,16 @@ void ImGui::UpdateSettings()
         g.SettingsDirtyTimer -= g.IO.DeltaTime;
         if (g.SettingsDirtyTimer <= 0.0f)
         {
-            if (g.IO.IniFilename != NULL)
+            g.SettingsDirtyTimer = 0.0f;
+            if (g.IO.IniFilename != NULL && g.IO.IniSavingThreaded)
+            {
+                if (!SaveIniSettingsToDiskThreaded(g.IO.IniFilename))
+                    g.SettingsDirtyTimer = FLT_MIN; // Previous write still in progress: try again next frame
+            }
+            else if (g.IO.IniFilename != NULL)
                 SaveIniSettingsToDisk(g.IO.IniFilename);
             else
                 g.IO.WantSaveIniSettings = true;  // Let user know they can call SaveIniSettingsToMemory(). user will need to clear io.WantSaveIniSettings themselves.
-            g.SettingsDirtyTimer = 0.0f;
         }
     }
 }
@@ -14603,6 +15603,38 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             handler.ApplyAllFn(&g, &handler);
 }
 
+// Write to a temporary file then rename it over the destination, so a crash or a concurrent reader never sees a partially written file.
+// Called from worker threads: this must not use the context nor allocate.
+static bool SettingsWriteFile(const char* ini_filename, const char* temp_filename, const char* ini_data, size_t ini_data_size)
+{
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    if (ImFileHandle f = ImFileOpen(temp_filename, "wt"))
+    {
+        bool ok = ImFileWrite(ini_data, sizeof(char), ini_data_size, f) == ini_data_size;
+        ok &= ImFileClose(f);
+        if (ok && ImFileRename(temp_filename, ini_filename))
+            return true;
+    }
+    // Fallback to writing in place (the temporary file is left behind and will be overwritten by next save)
+#else
+    IM_UNUSED(temp_filename);
+#endif
+    ImFileHandle f = ImFileOpen(ini_filename, "wt");
+    if (!f)
+        return false;
+    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
+    ImFileClose(f);
+    return true;
+}
+
+static void SettingsMakeTempFilename(ImVector<char>* out, const char* ini_filename)
+{
+    const int len = (int)strlen(ini_filename);
+    out->resize(len + 5);
+    memcpy(out->Data, ini_filename, len);
+    memcpy(out->Data + len, ".tmp", 5);
+}
+
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 {
     ImGuiContext& g = *GImGui;
@@ -14610,15 +15642,87 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
     if (!ini_filename)
         return;
 
+    // Don't let a background write land after this one
+    WaitIniSettingsSaved();
+
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
-    ImFileHandle f = ImFileOpen(ini_filename, "wt");
-    if (!f)
-        return;
-    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
-    ImFileClose(f);
+    ImVector<char> temp_filename;
+    SettingsMakeTempFilename(&temp_filename, ini_filename);
+    SettingsWriteFile(ini_filename, temp_filename.Data, ini_data, ini_data_size);
+}
+
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+
+// Data is owned by the worker thread until Done is set. Buffers are kept from one write to the next.
+struct ImGuiSettingsSaveJob
+{
+    std::thread         Thread;
+    std::atomic<bool>   Done;
+    ImGuiTextBuffer     IniData;
+    ImVector<char>      Filename;
+    ImVector<char>      TempFilename;
+
+    ImGuiSettingsSaveJob() : Done(true) {}
+};
+
+static void SettingsSaveJobRun(ImGuiSettingsSaveJob* job)
+{
+    SettingsWriteFile(job->Filename.Data, job->TempFilename.Data, job->IniData.c_str(), (size_t)job->IniData.size());
+    job->Done.store(true, std::memory_order_release);
+}
+
+bool ImGui::SaveIniSettingsToDiskThreaded(const char* ini_filename)
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+    if (!ini_filename)
+        return true;
+    if (g.SettingsSaveJob == NULL)
+        g.SettingsSaveJob = IM_NEW(ImGuiSettingsSaveJob)();
+    ImGuiSettingsSaveJob* job = g.SettingsSaveJob;
+    if (!job->Done.load(std::memory_order_acquire))
+        return false;
+    if (job->Thread.joinable())
+        job->Thread.join();
+
+    // Serialize on the calling thread (handlers read context data), copy for the worker
+    size_t ini_data_size = 0;
+    const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
+    job->IniData.Buf.resize(0);
+    job->IniData.append(ini_data, ini_data + ini_data_size);
+    const int filename_len = (int)strlen(ini_filename);
+    job->Filename.resize(filename_len + 1);
+    memcpy(job->Filename.Data, ini_filename, filename_len + 1);
+    SettingsMakeTempFilename(&job->TempFilename, ini_filename);
+
+    job->Done.store(false, std::memory_order_relaxed);
+    job->Thread = std::thread(SettingsSaveJobRun, job);
+    return true;
+}
+
+void ImGui::WaitIniSettingsSaved()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.SettingsSaveJob != NULL && g.SettingsSaveJob->Thread.joinable())
+        g.SettingsSaveJob->Thread.join();
 }
 
+#else
+
+// Without worker threads: write synchronously, still under a temporary name then renamed
+bool ImGui::SaveIniSettingsToDiskThreaded(const char* ini_filename)
+{
+    SaveIniSettingsToDisk(ini_filename);
+    return true;
+}
+
+void ImGui::WaitIniSettingsSaved()
+{
+}
+
+#endif // #ifndef IMGUI_DISABLE_WORKER_THREADS
+
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
@@ -14652,19 +15756,23 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
+    g.SettingsWindowsMap.SetInt(settings->ID, g.SettingsWindows.offset_from_ptr(settings));
 
     return settings;
 }
 
 // We don't provide a FindWindowSettingsByName() because Docking system doesn't always hold on names.
 // This is called once per window .ini entry + once per newly instantiated window.
+// The map points to the most recently created entry for an ID: older entries with the same ID were necessarily deleted.
 ImGuiWindowSettings* ImGui::FindWindowSettingsByID(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id && !settings->WantDelete)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsWindowsMap.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(offset);
+    IM_ASSERT(settings->ID == id);
+    return settings->WantDelete ? NULL : settings;
 }
 
 // This is faster if you are holding on a Window already as we don't need to perform a search.
@@ -14699,6 +15807,7 @@ static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandl
     for (ImGuiWindow* window : g.Windows)
         window->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
 }
 
 static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
@@ -14720,15 +15829,31 @@ static void WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
     int x, y;
     int i;
     ImU32 u1;
-    if (sscanf(line, "Pos=%i,%i", &x, &y) == 2)             { settings->Pos = ImVec2ih((short)x, (short)y); }
-    else if (sscanf(line, "Size=%i,%i", &x, &y) == 2)       { settings->Size = ImVec2ih((short)x, (short)y); }
-    else if (sscanf(line, "ViewportId=0x%08X", &u1) == 1)   { settings->ViewportId = u1; }
-    else if (sscanf(line, "ViewportPos=%i,%i", &x, &y) == 2){ settings->ViewportPos = ImVec2ih((short)x, (short)y); }
-    else if (sscanf(line, "Collapsed=%d", &i) == 1)         { settings->Collapsed = (i != 0); }
-    else if (sscanf(line, "IsChild=%d", &i) == 1)           { settings->IsChild = (i != 0); }
-    else if (sscanf(line, "DockId=0x%X,%d", &u1, &i) == 2)  { settings->DockId = u1; settings->DockOrder = (short)i; }
-    else if (sscanf(line, "DockId=0x%X", &u1) == 1)         { settings->DockId = u1; settings->DockOrder = -1; }
-    else if (sscanf(line, "ClassId=0x%X", &u1) == 1)        { settings->ClassId = u1; }
+    // Dispatch on first character so a line is only scanned by the sscanf() that can match it
+    switch (line[0])
+    {
+    case 'P':
+        if (sscanf(line, "Pos=%i,%i", &x, &y) == 2)             { settings->Pos = ImVec2ih((short)x, (short)y); }
+        break;
+    case 'S':
+        if (sscanf(line, "Size=%i,%i", &x, &y) == 2)            { settings->Size = ImVec2ih((short)x, (short)y); }
+        break;
+    case 'V':
+        if (sscanf(line, "ViewportId=0x%08X", &u1) == 1)        { settings->ViewportId = u1; }
+        else if (sscanf(line, "ViewportPos=%i,%i", &x, &y) == 2){ settings->ViewportPos = ImVec2ih((short)x, (short)y); }
+        break;
+    case 'C':
+        if (sscanf(line, "Collapsed=%d", &i) == 1)              { settings->Collapsed = (i != 0); }
+        else if (sscanf(line, "ClassId=0x%X", &u1) == 1)        { settings->ClassId = u1; }
+        break;
+    case 'I':
+        if (sscanf(line, "IsChild=%d", &i) == 1)                { settings->IsChild = (i != 0); }
+        break;
+    case 'D':
+        if (sscanf(line, "DockId=0x%X,%d", &u1, &i) == 2)       { settings->DockId = u1; settings->DockOrder = (short)i; }
+        else if (sscanf(line, "DockId=0x%X", &u1) == 1)         { settings->DockId = u1; settings->DockOrder = -1; }
+        break;
+    }
 }
 
 // Apply to existing windows (if any)
@@ -14744,6 +15869,64 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
+// Fields written by WindowSettingsWriteEntry()
+static ImGuiWindowSettingsIniFields WindowSettingsGetIniFields(const ImGuiWindowSettings* settings)
+{
+    ImGuiWindowSettingsIniFields fields;
+    fields.Pos = settings->Pos;
+    fields.Size = settings->Size;
+    fields.ViewportPos = settings->ViewportPos;
+    fields.ViewportId = settings->ViewportId;
+    fields.DockId = settings->DockId;
+    fields.ClassId = settings->ClassId;
+    fields.DockOrder = settings->DockOrder;
+    fields.Collapsed = settings->Collapsed;
+    fields.IsChild = settings->IsChild;
+    return fields;
+}
+
+static bool WindowSettingsIniFieldsEqual(const ImGuiWindowSettingsIniFields& a, const ImGuiWindowSettingsIniFields& b)
+{
+    return a.Pos.x == b.Pos.x && a.Pos.y == b.Pos.y && a.Size.x == b.Size.x && a.Size.y == b.Size.y
+        && a.ViewportPos.x == b.ViewportPos.x && a.ViewportPos.y == b.ViewportPos.y && a.ViewportId == b.ViewportId
+        && a.DockId == b.DockId && a.ClassId == b.ClassId && a.DockOrder == b.DockOrder && a.Collapsed == b.Collapsed && a.IsChild == b.IsChild;
+}
+
+static void WindowSettingsWriteEntry(ImGuiSettingsHandler* handler, ImGuiWindowSettings* settings, ImGuiTextBuffer* buf)
+{
+    const char* settings_name = settings->GetName();
+    buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
+    if (settings->IsChild)
+    {
+        buf->appendf("IsChild=1\n");
+        buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+    }
+    else
+    {
+        if (settings->ViewportId != 0 && settings->ViewportId != ImGui::IMGUI_VIEWPORT_DEFAULT_ID)
+        {
+            buf->appendf("ViewportPos=%d,%d\n", settings->ViewportPos.x, settings->ViewportPos.y);
+            buf->appendf("ViewportId=0x%08X\n", settings->ViewportId);
+        }
+        if (settings->Pos.x != 0 || settings->Pos.y != 0 || settings->ViewportId == ImGui::IMGUI_VIEWPORT_DEFAULT_ID)
+            buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
+        if (settings->Size.x != 0 || settings->Size.y != 0)
+            buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+        buf->appendf("Collapsed=%d\n", settings->Collapsed);
+        if (settings->DockId != 0)
+        {
+            //buf->appendf("TabId=0x%08X\n", ImHashStr("#TAB", 4, settings->ID)); // window->TabId: this is not read back but writing it makes "debugging" the .ini data easier.
+            if (settings->DockOrder == -1)
+                buf->appendf("DockId=0x%08X\n", settings->DockId);
+            else
+                buf->appendf("DockId=0x%08X,%d\n", settings->DockId, settings->DockOrder);
+            if (settings->ClassId != 0)
+                buf->appendf("ClassId=0x%08X\n", settings->ClassId);
+        }
+    }
+    buf->append("\n");
+}
+
 static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
     // Gather data from windows that were active during this session
@@ -14774,44 +15957,26 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
         settings->WantDelete = false;
     }
 
-    // Write to text buffer
-    buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
+    // Write to text buffer, copying the text of entries which didn't change since last write
+    ImGuiTextBuffer* cache = &g.SettingsWindowsIniCacheTemp;
+    cache->Buf.resize(0);
+    cache->reserve(g.SettingsWindowsIniCache.size() + 64);
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
         if (settings->WantDelete)
             continue;
-        const char* settings_name = settings->GetName();
-        buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
-        if (settings->IsChild)
-        {
-            buf->appendf("IsChild=1\n");
-            buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
-        }
+        const ImGuiWindowSettingsIniFields fields = WindowSettingsGetIniFields(settings);
+        const int offset = cache->size();
+        if (settings->IniSize != 0 && WindowSettingsIniFieldsEqual(settings->IniFields, fields))
+            cache->append(g.SettingsWindowsIniCache.begin() + settings->IniOffset, g.SettingsWindowsIniCache.begin() + settings->IniOffset + settings->IniSize);
         else
-        {
-            if (settings->ViewportId != 0 && settings->ViewportId != ImGui::IMGUI_VIEWPORT_DEFAULT_ID)
-            {
-                buf->appendf("ViewportPos=%d,%d\n", settings->ViewportPos.x, settings->ViewportPos.y);
-                buf->appendf("ViewportId=0x%08X\n", settings->ViewportId);
-            }
-            if (settings->Pos.x != 0 || settings->Pos.y != 0 || settings->ViewportId == ImGui::IMGUI_VIEWPORT_DEFAULT_ID)
-                buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
-            if (settings->Size.x != 0 || settings->Size.y != 0)
-                buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
-            buf->appendf("Collapsed=%d\n", settings->Collapsed);
-            if (settings->DockId != 0)
-            {
-                //buf->appendf("TabId=0x%08X\n", ImHashStr("#TAB", 4, settings->ID)); // window->TabId: this is not read back but writing it makes "debugging" the .ini data easier.
-                if (settings->DockOrder == -1)
-                    buf->appendf("DockId=0x%08X\n", settings->DockId);
-                else
-                    buf->appendf("DockId=0x%08X,%d\n", settings->DockId, settings->DockOrder);
-                if (settings->ClassId != 0)
-                    buf->appendf("ClassId=0x%08X\n", settings->ClassId);
-            }
-        }
-        buf->append("\n");
+            WindowSettingsWriteEntry(handler, settings, cache);
+        settings->IniFields = fields;
+        settings->IniOffset = offset;
+        settings->IniSize = cache->size() - offset;
     }
+    g.SettingsWindowsIniCache.Buf.swap(cache->Buf);
+    buf->append(g.SettingsWindowsIniCache.begin(), g.SettingsWindowsIniCache.end());
 }
 
 
@@ -16003,6 +17168,8 @@ namespace ImGui
     static void             DockNodeTreeSplit(ImGuiContext* ctx, ImGuiDockNode* parent_node, ImGuiAxis split_axis, int split_first_child, float split_ratio, ImGuiDockNode* new_node);
     static void             DockNodeTreeMerge(ImGuiContext* ctx, ImGuiDockNode* parent_node, ImGuiDockNode* merge_lead_child);
     static void             DockNodeTreeUpdatePosSize(ImGuiDockNode* node, ImVec2 pos, ImVec2 size, ImGuiDockNode* only_write_to_single_node = NULL);
+    static void             DockNodeTreeStoreLayoutState(ImGuiDockNode* node);
+    static void             DockNodeMarkLayoutDirty(ImGuiDockNode* node);
     static void             DockNodeTreeUpdateSplitter(ImGuiDockNode* node);
     static ImGuiDockNode*   DockNodeTreeFindVisibleNodeByPos(ImGuiDockNode* node, ImVec2 pos);
     static ImGuiDockNode*   DockNodeTreeFindFallbackLeafNode(ImGuiDockNode* node);
@@ -16158,6 +17325,10 @@ void ImGui::DockContextNewFrameUpdateDocking(ImGuiContext* ctx)
             g.DebugHoveredDockNode = hovered_window->RootWindow->DockNode;
     }
 
+    dc->NodesLayoutCheckedPrev = dc->NodesLayoutChecked;
+    dc->NodesLayoutUpdatedPrev = dc->NodesLayoutUpdated;
+    dc->NodesLayoutChecked = dc->NodesLayoutUpdated = 0;
+
     // Process Docking requests
     for (ImGuiDockRequest& req : dc->Requests)
         if (req.Type == ImGuiDockRequestType_Dock)
@@ -16710,7 +17881,7 @@ ImGuiDockNode::ImGuiDockNode(ImGuiID id)
     State = ImGuiDockNodeState_Unknown;
     LastBgColor = IM_COL32_WHITE;
     HostWindow = VisibleWindow = NULL;
-    CentralNode = OnlyNodeWithWindows = NULL;
+    CentralNode = OnlyNodeWithWindows = FirstNodeWithWindows = NULL;
     CountNodeWithWindows = 0;
     LastFrameAlive = LastFrameActive = LastFrameFocused = -1;
     LastFocusedNodeId = 0;
@@ -16723,6 +17894,7 @@ ImGuiDockNode::ImGuiDockNode(ImGuiID id)
     IsFocused = HasCloseButton = HasWindowMenuButton = HasCentralNodeChild = false;
     IsBgDrawnThisFrame = false;
     WantCloseAll = WantLockSizeOnce = WantMouseMove = WantHiddenTabBarUpdate = WantHiddenTabBarToggle = false;
+    IsLayoutDirty = true;
 }
 
 ImGuiDockNode::~ImGuiDockNode()
@@ -17033,6 +18205,7 @@ static void ImGui::DockNodeUpdateFlagsAndCollapse(ImGuiDockNode* node)
             {
                 DockNodeHideHostWindow(node);
                 node->State = ImGuiDockNodeState_HostWindowHiddenBecauseSingleWindow;
+                DockNodeMarkLayoutDirty(node);
                 DockNodeRemoveWindow(node, window, node->ID); // Will delete the node so it'll be invalid on return
                 return;
             }
@@ -17065,6 +18238,20 @@ static void ImGui::DockNodeUpdateFlagsAndCollapse(ImGuiDockNode* node)
     node->WantHiddenTabBarToggle = false;
 
     DockNodeUpdateVisibleFlag(node);
+
+    // Compare with the layout inputs stored by the last DockNodeTreeUpdatePosSize() pass. A dirty child node also dirties its parent.
+    const ImGuiDockNodeLayoutState& layout = node->LayoutState;
+    bool layout_changed = false;
+    layout_changed |= layout.ParentNode != node->ParentNode || layout.ChildNodes[0] != node->ChildNodes[0] || layout.ChildNodes[1] != node->ChildNodes[1];
+    layout_changed |= layout.Pos != node->Pos || layout.Size != node->Size || layout.SizeRef != node->SizeRef;
+    layout_changed |= layout.WindowMinSize != g.Style.WindowMinSize || layout.SeparatorSize != g.Style.DockingSeparatorSize;
+    layout_changed |= layout.MergedFlags != node->MergedFlags || layout.SplitAxis != node->SplitAxis;
+    layout_changed |= layout.IsVisible != node->IsVisible || layout.WantLockSizeOnce != node->WantLockSizeOnce;
+    layout_changed |= layout.Windows.Size != node->Windows.Size || (node->Windows.Size > 0 && memcmp(layout.Windows.Data, node->Windows.Data, (size_t)node->Windows.size_in_bytes()) != 0);
+    layout_changed |= (node->ChildNodes[0] && node->ChildNodes[0]->IsLayoutDirty) || (node->ChildNodes[1] && node->ChildNodes[1]->IsLayoutDirty);
+    if (layout_changed)
+        node->IsLayoutDirty = true;
+    g.DockContext.NodesLayoutChecked++;
 }
 
 // This is rarely called as DockNodeUpdateForRootNode() generally does it most frames.
@@ -17114,18 +18301,23 @@ static void ImGui::DockNodeUpdateForRootNode(ImGuiDockNode* node)
     // - Setup central node pointers
     // - Find if there's only a single visible window in the hierarchy (in which case we need to display a regular title bar -> FIXME-DOCK: that last part is not done yet!)
     // Cannot merge this with DockNodeUpdateFlagsAndCollapse() because FirstNodeWithWindows is found after window removal and child collapsing
-    ImGuiDockNodeTreeInfo info;
-    DockNodeFindInfo(node, &info);
-    node->CentralNode = info.CentralNode;
-    node->OnlyNodeWithWindows = (info.CountNodesWithWindows == 1) ? info.FirstNodeWithWindows : NULL;
-    node->CountNodeWithWindows = info.CountNodesWithWindows;
-    if (node->LastFocusedNodeId == 0 && info.FirstNodeWithWindows != NULL)
-        node->LastFocusedNodeId = info.FirstNodeWithWindows->ID;
+    // When no node of the hierarchy changed since it was last laid out, last frame's results are still valid.
+    if (node->IsLayoutDirty)
+    {
+        ImGuiDockNodeTreeInfo info;
+        DockNodeFindInfo(node, &info);
+        node->CentralNode = info.CentralNode;
+        node->FirstNodeWithWindows = info.FirstNodeWithWindows;
+        node->CountNodeWithWindows = info.CountNodesWithWindows;
+    }
+    node->OnlyNodeWithWindows = (node->CountNodeWithWindows == 1) ? node->FirstNodeWithWindows : NULL;
+    if (node->LastFocusedNodeId == 0 && node->FirstNodeWithWindows != NULL)
+        node->LastFocusedNodeId = node->FirstNodeWithWindows->ID;
 
     // Copy the window class from of our first window so it can be used for proper dock filtering.
     // When node has mixed windows, prioritize the class with the most constraint (DockingAllowUnclassed = false) as the reference to copy.
     // FIXME-DOCK: We don't recurse properly, this code could be reworked to work from DockNodeUpdateScanRec.
-    if (ImGuiDockNode* first_node_with_windows = info.FirstNodeWithWindows)
+    if (ImGuiDockNode* first_node_with_windows = node->FirstNodeWithWindows)
     {
         node->WindowClass = first_node_with_windows->Windows[0]->WindowClass;
         for (int n = 1; n < first_node_with_windows->Windows.Size; n++)
@@ -17165,9 +18357,10 @@ static void ImGui::DockNodeUpdate(ImGuiDockNode* node)
     node->LastFrameAlive = g.FrameCount;
     node->IsBgDrawnThisFrame = false;
 
-    node->CentralNode = node->OnlyNodeWithWindows = NULL;
     if (node->IsRootNode())
         DockNodeUpdateForRootNode(node);
+    else
+        node->CentralNode = node->OnlyNodeWithWindows = node->FirstNodeWithWindows = NULL;
 
     // Remove tab bar if not needed
     if (node->TabBar && node->IsNoTabBar())
@@ -17725,6 +18918,7 @@ static void ImGui::DockNodeUpdateTabBar(ImGuiDockNode* node, ImGuiWindow* host_w
 
     // Submit actual tabs
     node->VisibleWindow = NULL;
+    const ImGuiWindowDockStyle* applied_dock_style = NULL;
     for (int window_n = 0; window_n < node->Windows.Size; window_n++)
     {
         ImGuiWindow* window = node->Windows[window_n];
@@ -17739,9 +18933,13 @@ static void ImGui::DockNodeUpdateTabBar(ImGuiDockNode* node, ImGuiWindow* host_w
             if (tab_bar->Flags & ImGuiTabBarFlags_NoCloseWithMiddleMouseButton)
                 tab_item_flags |= ImGuiTabItemFlags_NoCloseWithMiddleMouseButton;
 
-            // Apply stored style overrides for the window
-            for (int color_n = 0; color_n < ImGuiWindowDockStyleCol_COUNT; color_n++)
-                g.Style.Colors[GWindowDockStyleColors[color_n]] = ColorConvertU32ToFloat4(window->DockStyle.Colors[color_n]);
+            // Apply stored style overrides for the window (unless same as previous tab)
+            if (applied_dock_style == NULL || memcmp(applied_dock_style->Colors, window->DockStyle.Colors, sizeof(window->DockStyle.Colors)) != 0)
+            {
+                for (int color_n = 0; color_n < ImGuiWindowDockStyleCol_COUNT; color_n++)
+                    g.Style.Colors[GWindowDockStyleColors[color_n]] = ColorConvertU32ToFloat4(window->DockStyle.Colors[color_n]);
+                applied_dock_style = &window->DockStyle;
+            }
 
             // Note that TabItemEx() calls TabBarCalcTabID() so our tab item ID will ignore the current ID stack (rightly so)
             bool tab_open = true;
@@ -18279,6 +19477,7 @@ void ImGui::DockNodeTreeSplit(ImGuiContext* ctx, ImGuiDockNode* parent_node, ImG
     DockNodeMoveWindows(parent_node->ChildNodes[split_inheritor_child_idx], parent_node);
     DockSettingsRenameNodeReferences(parent_node->ID, parent_node->ChildNodes[split_inheritor_child_idx]->ID);
     DockNodeUpdateHasCentralNodeChild(DockNodeGetRootNode(parent_node));
+    DockNodeMarkLayoutDirty(parent_node);
     DockNodeTreeUpdatePosSize(parent_node, parent_node->Pos, parent_node->Size);
 
     // Flags transfer (e.g. this is where we transfer the ImGuiDockNodeFlags_CentralNode property)
@@ -18331,6 +19530,7 @@ void ImGui::DockNodeTreeMerge(ImGuiContext* ctx, ImGuiDockNode* parent_node, ImG
     parent_node->LocalFlags |= (child_1 ? child_1->LocalFlags : 0) & ImGuiDockNodeFlags_LocalFlagsTransferMask_;
     parent_node->LocalFlagsInWindows = (child_0 ? child_0->LocalFlagsInWindows : 0) | (child_1 ? child_1->LocalFlagsInWindows : 0); // FIXME: Would be more consistent to update from actual windows
     parent_node->UpdateMergedFlags();
+    DockNodeMarkLayoutDirty(parent_node); // Node pointers may be recycled: don't rely on the stored child pointers
 
     if (child_0)
     {
@@ -18344,6 +19544,29 @@ void ImGui::DockNodeTreeMerge(ImGuiContext* ctx, ImGuiDockNode* parent_node, ImG
     }
 }
 
+// Store the layout inputs that DockNodeUpdateFlagsAndCollapse() compares on the next frame
+static void DockNodeStoreLayoutState(ImGuiDockNode* node)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDockNodeLayoutState& layout = node->LayoutState;
+    layout.ParentNode = node->ParentNode;
+    layout.ChildNodes[0] = node->ChildNodes[0];
+    layout.ChildNodes[1] = node->ChildNodes[1];
+    layout.Windows.resize(node->Windows.Size);
+    if (node->Windows.Size > 0)
+        memcpy(layout.Windows.Data, node->Windows.Data, (size_t)node->Windows.size_in_bytes());
+    layout.Pos = node->Pos;
+    layout.Size = node->Size;
+    layout.SizeRef = node->SizeRef;
+    layout.WindowMinSize = g.Style.WindowMinSize;
+    layout.SeparatorSize = g.Style.DockingSeparatorSize;
+    layout.MergedFlags = node->MergedFlags;
+    layout.SplitAxis = node->SplitAxis;
+    layout.IsVisible = node->IsVisible;
+    layout.WantLockSizeOnce = node->WantLockSizeOnce;
+    node->IsLayoutDirty = false;
+}
+
 // Update Pos/Size for a node hierarchy (don't affect child Windows yet)
 // (Depth-first, Pre-Order)
 void ImGui::DockNodeTreeUpdatePosSize(ImGuiDockNode* node, ImVec2 pos, ImVec2 size, ImGuiDockNode* only_write_to_single_node)
@@ -18352,11 +19575,20 @@ void ImGui::DockNodeTreeUpdatePosSize(ImGuiDockNode* node, ImVec2 pos, ImVec2 si
     // 'only_write_to_single_node' is only set when turning a node visible mid-frame and we need its size right-away.
     ImGuiContext& g = *GImGui;
     const bool write_to_node = only_write_to_single_node == NULL || only_write_to_single_node == node;
+    if (only_write_to_single_node == NULL)
+    {
+        // Skip nodes that didn't change since they were last laid out, when given the same space: their Pos/Size and those of their child nodes are already correct.
+        if (!node->IsLayoutDirty && node->Pos == pos && node->Size == size)
+            return;
+        g.DockContext.NodesLayoutUpdated++;
+    }
     if (write_to_node)
     {
         node->Pos = pos;
         node->Size = size;
     }
+    if (only_write_to_single_node == NULL)
+        DockNodeStoreLayoutState(node); // Our inputs are final: Pos/Size were written above, SizeRef/WantLockSizeOnce by our parent.
 
     if (node->IsLeafNode())
         return;
@@ -18437,8 +19669,31 @@ void ImGui::DockNodeTreeUpdatePosSize(ImGuiDockNode* node, ImVec2 pos, ImVec2 si
     const bool child_1_recurse = only_write_to_single_node ? child_1_is_toward_single_node : child_1->IsVisible;
     if (child_0_recurse)
         DockNodeTreeUpdatePosSize(child_0, child_0_pos, child_0_size);
+    else if (only_write_to_single_node == NULL)
+        DockNodeTreeStoreLayoutState(child_0);
     if (child_1_recurse)
         DockNodeTreeUpdatePosSize(child_1, child_1_pos, child_1_size);
+    else if (only_write_to_single_node == NULL)
+        DockNodeTreeStoreLayoutState(child_1);
+}
+
+// Hidden nodes are not laid out: store their state as-is so they don't keep their parents dirty.
+// (Depth-first, Pre-Order)
+void ImGui::DockNodeTreeStoreLayoutState(ImGuiDockNode* node)
+{
+    DockNodeStoreLayoutState(node);
+    if (node->ChildNodes[0])
+        DockNodeTreeStoreLayoutState(node->ChildNodes[0]);
+    if (node->ChildNodes[1])
+        DockNodeTreeStoreLayoutState(node->ChildNodes[1]);
+}
+
+// Mark a node and its parents so that the next DockNodeTreeUpdatePosSize() pass over them isn't skipped.
+// Needed when layout inputs are modified after DockNodeUpdateFlagsAndCollapse() compared them for the frame.
+void ImGui::DockNodeMarkLayoutDirty(ImGuiDockNode* node)
+{
+    for (; node != NULL; node = node->ParentNode)
+        node->IsLayoutDirty = true;
 }
 
 static void DockNodeTreeUpdateSplitterFindTouchingNode(ImGuiDockNode* node, ImGuiAxis axis, int side, ImVector<ImGuiDockNode*>* touching_nodes)
@@ -18552,6 +19807,7 @@ void ImGui::DockNodeTreeUpdateSplitter(ImGuiDockNode* node)
                                     // Mark other node so its size will be preserved during the upcoming call to DockNodeTreeUpdatePosSize().
                                     ImGuiDockNode* node_to_preserve = touching_node->ParentNode->ChildNodes[side_n];
                                     node_to_preserve->WantLockSizeOnce = true;
+                                    DockNodeMarkLayoutDirty(node_to_preserve);
                                     //draw_list->AddRect(touching_node->Pos, touching_node->Rect().Max, IM_COL32(255, 0, 0, 255));
                                     //draw_list->AddRectFilled(node_to_preserve->Pos, node_to_preserve->Rect().Max, IM_COL32(0, 255, 0, 100));
                                 }
@@ -18559,6 +19815,8 @@ void ImGui::DockNodeTreeUpdateSplitter(ImGuiDockNode* node)
                             }
                         }
 
+                    DockNodeMarkLayoutDirty(child_0);
+                    DockNodeMarkLayoutDirty(child_1);
                     DockNodeTreeUpdatePosSize(child_0, child_0->Pos, child_0->Size);
                     DockNodeTreeUpdatePosSize(child_1, child_1->Pos, child_1->Size);
                     MarkIniSettingsDirty();
@@ -18863,6 +20121,7 @@ void ImGui::DockBuilderSetNodePos(ImGuiID node_id, ImVec2 pos)
         return;
     node->Pos = pos;
     node->AuthorityForPos = ImGuiDataAuthority_DockNode;
+    DockNodeMarkLayoutDirty(node);
 }
 
 void ImGui::DockBuilderSetNodeSize(ImGuiID node_id, ImVec2 size)
@@ -18874,6 +20133,7 @@ void ImGui::DockBuilderSetNodeSize(ImGuiID node_id, ImVec2 size)
     IM_ASSERT(size.x > 0.0f && size.y > 0.0f);
     node->Size = node->SizeRef = size;
     node->AuthorityForSize = ImGuiDataAuthority_DockNode;
+    DockNodeMarkLayoutDirty(node);
 }
 
 // Make sure to use the ImGuiDockNodeFlags_DockSpace flag to create a dockspace node! Otherwise this will create a floating node!
@@ -19296,11 +20556,21 @@ static ImGuiDockNode* ImGui::DockContextBindNodeToWindow(ImGuiContext* ctx, ImGu
     return node;
 }
 
+// Colors are generally the same for all windows: only convert the ones which changed since last call.
 static void StoreDockStyleForWindow(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
+    ImGuiDockContext* dc = &g.DockContext;
     for (int color_n = 0; color_n < ImGuiWindowDockStyleCol_COUNT; color_n++)
-        window->DockStyle.Colors[color_n] = ImGui::ColorConvertFloat4ToU32(g.Style.Colors[GWindowDockStyleColors[color_n]]);
+    {
+        const ImVec4& col = g.Style.Colors[GWindowDockStyleColors[color_n]];
+        if (memcmp(&col, &dc->StyleColorsSrc[color_n], sizeof(ImVec4)) != 0)
+        {
+            dc->StyleColorsSrc[color_n] = col;
+            dc->StyleColors.Colors[color_n] = ImGui::ColorConvertFloat4ToU32(col);
+        }
+        window->DockStyle.Colors[color_n] = dc->StyleColors.Colors[color_n];
+    }
 }
 
 void ImGui::BeginDocked(ImGuiWindow* window, bool* p_open)
@@ -20517,6 +21787,13 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Details for Text Layout Cache
+    if (TreeNode("TextLayoutCache", "Text Layout Cache (%d entries, %d hits, %d misses)", g.TextLayoutCache.GetEntriesCount(), g.TextLayoutCache.HitsLastFrame, g.TextLayoutCache.MissesLastFrame))
+    {
+        DebugNodeTextLayoutCache(&g.TextLayoutCache);
+        TreePop();
+    }
+
     // Details for Docking
 #ifdef IMGUI_HAS_DOCK
     if (TreeNode("Docking"))
@@ -20528,6 +21805,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         if (SmallButton("Clear nodes")) { DockContextClearNodes(&g, 0, true); }
         SameLine();
         if (SmallButton("Rebuild all")) { dc->WantFullRebuild = true; }
+        Text("Nodes layout last frame: %d updated, %d unchanged", dc->NodesLayoutUpdatedPrev, ImMax(dc->NodesLayoutCheckedPrev - dc->NodesLayoutUpdatedPrev, 0));
         for (int n = 0; n < dc->Nodes.Data.Size; n++)
             if (ImGuiDockNode* node = (ImGuiDockNode*)dc->Nodes.Data[n].val_p)
                 if (!root_nodes_only || node->IsRootNode())
@@ -20554,6 +21832,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             TextUnformatted("<NULL>");
         Checkbox("io.ConfigDebugIniSettings", &io.ConfigDebugIniSettings);
         Text("SettingsDirtyTimer %.2f", g.SettingsDirtyTimer);
+        Checkbox("io.IniSavingThreaded", &io.IniSavingThreaded);
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+        SameLine();
+        Text("(%s)", (g.SettingsSaveJob == NULL) ? "idle" : g.SettingsSaveJob->Done.load() ? "done" : "writing");
+#else
+        SameLine();
+        TextDisabled("(IMGUI_DISABLE_WORKER_THREADS: synchronous)");
+#endif
+        Text("Windows .ini cache: %d bytes", g.SettingsWindowsIniCache.size());
         if (TreeNode("SettingsHandlers", "Settings handlers: (%d)", g.SettingsHandlers.Size))
         {
             for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
@@ -20619,7 +21906,68 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         for (int n = buf_size - 1; n >= 0; n--)
         {
             ImGuiDebugAllocEntry* entry = &info->LastEntriesBuf[(info->LastEntriesIdx - n + buf_size) % buf_size];
-            BulletText("Frame %06d: %+3d ( %2d malloc, %2d free )%s", entry->FrameCount, entry->AllocCount - entry->FreeCount, entry->AllocCount, entry->FreeCount, (n == 0) ? " (most recent)" : "");
+            BulletText("Frame %06d: %+3d ( %2d malloc, %2d free, %d bytes )%s", entry->FrameCount, entry->AllocCount - entry->FreeCount, entry->AllocCount, entry->FreeCount, entry->AllocBytes, (n == 0) ? " (most recent)" : "");
+        }
+        SeparatorText("Steady state");
+        Checkbox("io.ConfigMemorySteadyState", &io.ConfigMemorySteadyState);
+        SetNextItemWidth(GetFontSize() * 8);
+        DragInt("io.ConfigDebugSteadyStateWarmupFrames", &io.ConfigDebugSteadyStateWarmupFrames, 1.0f, 0, INT_MAX);
+        Checkbox("io.ConfigDebugSteadyStateAssert", &io.ConfigDebugSteadyStateAssert);
+        if (io.ConfigDebugSteadyStateWarmupFrames > 0)
+        {
+            const int warmup_frames_left = info->SteadyStateFrameStart + io.ConfigDebugSteadyStateWarmupFrames - g.FrameCount;
+            if (warmup_frames_left > 0)
+                Text("Warming up: %d frames left", warmup_frames_left);
+            else
+                Text("%d allocations after warm-up", info->SteadyStateAllocCount);
+            SameLine();
+            if (SmallButton("Restart warm-up"))
+            {
+                info->SteadyStateFrameStart = g.FrameCount;
+                info->SteadyStateAllocCount = 0;
+                memset(info->ReportsBuf, 0, sizeof(info->ReportsBuf));
+            }
+            const int reports_size = IM_ARRAYSIZE(info->ReportsBuf);
+            for (int n = 0; n < reports_size; n++)
+            {
+                const ImGuiDebugAllocReport* report = &info->ReportsBuf[(info->ReportsIdx - n + reports_size) % reports_size];
+                if (report->FrameCount != 0)
+                    BulletText("Frame %06d: %d bytes in %s", report->FrameCount, report->Size, report->Tags);
+            }
+        }
+        if (GImAllocatorAllocFunc == ImTieredAllocator::AllocFunc)
+        {
+            // Copy stats under lock as worker threads may be allocating
+            ImTieredAllocator* allocator = (ImTieredAllocator*)GImAllocatorUserData;
+            ImTieredAllocatorStats stats;
+            ImTieredAllocatorClass classes[IM_TIERED_ALLOCATOR_CLASSES_COUNT];
+            size_t pages_bytes, large_bytes;
+            {
+                ImTieredAllocatorLockScope lock(allocator->Lock);
+                stats = allocator->LastFrameStats;
+                memcpy(classes, allocator->Classes, sizeof(classes));
+                pages_bytes = allocator->PagesBytes;
+                large_bytes = allocator->LargeBytes;
+            }
+            SeparatorText("ImTieredAllocator");
+            Text("Last frame: %d allocs (%d bytes), %d frees, %d backend allocs", stats.AllocCount, (int)stats.AllocBytes, stats.FreeCount, stats.BackendAllocCount);
+            Text("Frame arena: %d / %d bytes used last frame", (int)stats.FrameBytes, (int)allocator->FrameArenaSize);
+            Text("Pages: %d KB, large blocks: %d KB", (int)(pages_bytes / 1024), (int)(large_bytes / 1024));
+            if (BeginTable("##classes", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+            {
+                TableSetupColumn("Size class");
+                TableSetupColumn("Blocks used");
+                TableSetupColumn("Blocks");
+                TableHeadersRow();
+                for (int class_n = 0; class_n < IM_TIERED_ALLOCATOR_CLASSES_COUNT; class_n++)
+                {
+                    const ImTieredAllocatorClass* pool = &classes[class_n];
+                    TableNextColumn(); Text("%d bytes", 16 << class_n);
+                    TableNextColumn(); Text("%d", pool->BlocksUsed);
+                    TableNextColumn(); Text("%d", pool->BlocksCount);
+                }
+                EndTable();
+            }
         }
         TreePop();
     }
@@ -20662,6 +22010,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             Text("MouseStationaryTimer: %.2f", g.MouseStationaryTimer);
             Text("Mouse source: %s", GetMouseSourceName(io.MouseSource));
             Text("Pen Pressure: %.1f", io.PenPressure); // Note: currently unused
+            Checkbox("io.ConfigInputCoalesceMouseEvents", &io.ConfigInputCoalesceMouseEvents);
+            Text("Merged events: %d mouse pos, %d mouse wheel", g.InputEventsMergedMousePos, g.InputEventsMergedMouseWheel);
             Unindent();
         }
 
@@ -21241,13 +22591,31 @@ void ImGui::DebugNodeFontGlyph(ImFont*, const ImFontGlyph* glyph)
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
-    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+    if (!TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->HashIndex.size_in_bytes(), storage->UseHashIndex ? " (hashed)" : ""))
         return;
     for (const ImGuiStorage::ImGuiStoragePair& p : storage->Data)
         BulletText("Key 0x%08X Value { i: %d }", p.key, p.val_i); // Important: we currently don't store a type, real value may not be integer.
     TreePop();
 }
 
+// [DEBUG] Display statistics of ImGuiTextLayoutCache
+void ImGui::DebugNodeTextLayoutCache(ImGuiTextLayoutCache* cache)
+{
+    const int lookups_last_frame = cache->HitsLastFrame + cache->MissesLastFrame;
+    const ImU64 lookups_total = cache->HitsTotal + cache->MissesTotal;
+    Text("Entries: %d/%d (%d evicted), %d lines (%d bytes)", cache->GetEntriesCount(), cache->MaxEntries, cache->FreeEntries.Size, cache->LineRanges.Size / 2, cache->Entries.size_in_bytes() + cache->Map.Data.size_in_bytes() + cache->LineRanges.size_in_bytes() + cache->TextData.size_in_bytes());
+    Text("Last frame: %d hits, %d misses (%.1f%% hit rate)", cache->HitsLastFrame, cache->MissesLastFrame, lookups_last_frame ? cache->HitsLastFrame * 100.0f / lookups_last_frame : 0.0f);
+    Text("Total: %llu hits, %llu misses (%.1f%% hit rate)", cache->HitsTotal, cache->MissesTotal, lookups_total ? (double)cache->HitsTotal * 100.0 / (double)lookups_total : 0.0);
+    SetNextItemWidth(GetFontSize() * 10);
+    DragInt("MaxEntries", &cache->MaxEntries, 16.0f, 0, 1 << 20);
+    SetNextItemWidth(GetFontSize() * 10);
+    DragInt("MaxAge", &cache->MaxAge, 1.0f, 1, 10000, "%d frames");
+    SetNextItemWidth(GetFontSize() * 10);
+    DragInt("MinTextLen", &cache->MinTextLen, 1.0f, 0, 10000, "%d bytes");
+    if (SmallButton("Clear"))
+        cache->Clear();
+}
+
 // [DEBUG] Display contents of ImGuiTabBar
 void ImGui::DebugNodeTabBar(ImGuiTabBar* tab_bar, const char* label)
 {
@@ -21879,6 +23247,7 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList*, const ImDrawList
 void ImGui::DebugNodeFont(ImFont*) {}
 void ImGui::DebugNodeStorage(ImGuiStorage*, const char*) {}
 void ImGui::DebugNodeTabBar(ImGuiTabBar*, const char*) {}
+void ImGui::DebugNodeTextLayoutCache(ImGuiTextLayoutCache*) {}
 void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
 void ImGui::DebugNodeWindowSettings(ImGuiWindowSettings*) {}
 void ImGui::DebugNodeWindowsList(ImVector<ImGuiWindow*>*, const char*) {}
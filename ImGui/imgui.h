@@ -176,6 +176,7 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store measured item heights for ImGuiListClipper::BeginVariableHeight()
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformIO;             // Multi-viewport support: interface for Platform/Renderer backends + viewports to render
@@ -353,7 +354,11 @@ namespace ImGui
     //    such as BeginMenu/EndMenu, BeginPopup/EndPopup, etc. where the EndXXX call should only be called if the corresponding
     //    BeginXXX function returned true. Begin and BeginChild are the only odd ones out. Will be fixed in a future update.]
     // - Note that the bottom of window stack always contains a window called "Debug".
+    // - Begin(ImGuiID id, name) skips hashing the name: cache the result of GetWindowIDFromName(name) once and pass it every frame.
+    //   The 'name' parameter is still required (for display and first creation) and must hash to the same ID.
     IMGUI_API bool          Begin(const char* name, bool* p_open = NULL, ImGuiWindowFlags flags = 0);
+    IMGUI_API bool          Begin(ImGuiID id, const char* name, bool* p_open = NULL, ImGuiWindowFlags flags = 0);
+    IMGUI_API ImGuiID       GetWindowIDFromName(const char* name);                          // calculate window ID from a window name, e.g. "Host###host42" -> hash of "###host42".
     IMGUI_API void          End();
 
     // Child Windows
@@ -2216,6 +2221,7 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds. May change every frame.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
+    bool        IniSavingThreaded;              // = false          // Write the .ini file from a worker thread when saving automatically (only serialization happens in NewFrame()). The file is written under a temporary name then renamed, so it is never seen partially written. Writes synchronously with IMGUI_DISABLE_WORKER_THREADS.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     void*       UserData;                       // = NULL           // Store your own data.
 
@@ -2241,12 +2247,14 @@ struct ImGuiIO
     bool        MouseDrawCursor;                // = false          // Request ImGui to draw a mouse cursor for you (if you are on a platform without a mouse cursor). Cannot be easily renamed to 'io.ConfigXXX' because this is frequently used by backend implementations.
     bool        ConfigMacOSXBehaviors;          // = defined(__APPLE__) // Swap Cmd<>Ctrl keys + OS X style text editing cursor movement using Alt instead of Ctrl, Shortcuts using Cmd/Super instead of Ctrl, Line/Text Start and End using Cmd+Arrows instead of Home/End, Double click selects by word instead of selecting whole text, Multi-selection in lists uses Cmd/Super instead of Ctrl.
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
+    bool        ConfigInputCoalesceMouseEvents; // = false          // Merge a mouse pos/wheel event into the last queued event when it is of the same type, instead of queuing it. Order relative to other events (e.g. buttons) is preserved. Reduces the queue with high-rate mice and trackpads, at the cost of intermediate positions in g.InputEventsTrail.
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
     bool        ConfigInputTextEnterKeepActive; // = false          // [BETA] Pressing Enter will keep item active and select contents (single-line only).
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigMemorySteadyState;        // = false          // [BETA] Keep transient windows/tables/draw buffers at their high-water mark instead of freeing them (ConfigMemoryCompactTimer is ignored), so that hiding and showing windows doesn't allocate. See io.ConfigDebugSteadyStateWarmupFrames to audit it.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2278,6 +2286,13 @@ struct ImGuiIO
     // - Backends may have other side-effects on focus loss, so this will reduce side-effects but not necessary remove all of them.
     bool        ConfigDebugIgnoreFocusLoss;     // = false          // Ignore io.AddFocusEvent(false), consequently not calling io.ClearInputKeys() in input processing.
 
+    // Option to audit heap allocations in steady state (best used with io.ConfigMemorySteadyState).
+    // - After warm-up, every MemAlloc() call is recorded along with the current tag stack and window. See Metrics/Debugger->Memory allocations.
+    // - Use ImGui::DebugAllocPushTag()/DebugAllocPopTag() from imgui_internal.h to tag sections of your own code.
+    // - Allocations made by DataTable()/ImGuiTableQuery worker threads are not visible to this, they don't use the render thread.
+    int         ConfigDebugSteadyStateWarmupFrames; // = 0      // When > 0: report heap allocations made after this many frames. Warm-up can be restarted from Metrics/Debugger.
+    bool        ConfigDebugSteadyStateAssert;   // = false          // Assert on heap allocations made after warm-up.
+
     // Option to audit .ini data
     bool        ConfigDebugIniSettings;         // = false          // Save .ini data with extra comments (particularly helpful for Docking, but makes saving slower)
 
@@ -2583,6 +2598,8 @@ struct ImGuiTextBuffer
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// A storage may opt into a hash index with SetUseHashIndex(true) when it needs to hold many keys (e.g. open state of a tree with 10k+ nodes):
+// lookups and insertions become O(1) but Data is then kept in insertion order instead of being sorted.
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2600,11 +2617,16 @@ struct ImGuiStorage
     };
 
     ImVector<ImGuiStoragePair>      Data;
+    ImVector<int>                   HashIndex;      // Open-addressing table (power of two size) of indices into Data, -1 = empty slot. Only used when UseHashIndex is set.
+    bool                            UseHashIndex;
+
+    ImGuiStorage()      { UseHashIndex = false; }
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N), or O(1) with a hash index.
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    void                Clear() { Data.clear(); HashIndex.clear(); }
+    IMGUI_API void      SetUseHashIndex(bool enabled);  // Switch between sorted (default) and hashed mode. Disabling sorts Data back by key. The index is allocated on first insertion.
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2624,6 +2646,7 @@ struct ImGuiStorage
     IMGUI_API void**    GetVoidPtrRef(ImGuiID key, void* default_val = NULL);
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // In hashed mode this also rebuilds the hash index, so it must be called after pushing pairs into Data directly.
     IMGUI_API void      BuildSortByKey();
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
@@ -2649,6 +2672,9 @@ struct ImGuiStorage
 // - Clipper calculate the actual range of elements to display based on the current clipping rectangle, position the cursor before the first visible element.
 // - User code submit visible elements.
 // - The clipper also handles various subtleties related to keyboard/gamepad navigation, wrapping etc.
+// Items of different heights (e.g. wrapped text, expanded tree nodes): use BeginVariableHeight() with a persistent ImGuiListClipperHeights.
+// The clipper then returns visible items one at a time so it can measure each of them, and uses the measured heights to find the first
+// visible item and to size the list. Items which were never measured are assumed to be ImGuiListClipperHeights::DefaultHeight tall.
 struct ImGuiListClipper
 {
     ImGuiContext*   Ctx;                // Parent UI context
@@ -2664,6 +2690,7 @@ struct ImGuiListClipper
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginVariableHeight(int items_count, ImGuiListClipperHeights* heights); // 'heights' needs to persist across frames, one per list.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2679,6 +2706,23 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Item heights for ImGuiListClipper::BeginVariableHeight(), stored in a Fenwick tree (binary indexed tree) of prefix sums.
+// Updating the height of an item, getting the position of an item and finding the item at a position are all O(log N).
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;            // Height of each item (including item spacing). DefaultHeight until measured.
+    ImVector<double>    Tree;               // Fenwick tree over Heights, 1-based
+    float               DefaultHeight;      // Height assumed for items not measured yet. Default to GetTextLineHeightWithSpacing() when <= 0.0f.
+
+    ImGuiListClipperHeights()               { DefaultHeight = 0.0f; }
+    IMGUI_API void      Resize(int items_count);                    // Keep measured heights of existing items. Called by BeginVariableHeight().
+    IMGUI_API void      SetItemHeight(int item_n, float height);    // Called by the clipper when measuring, can also be called to provide known heights.
+    IMGUI_API double    GetItemOffset(int item_n) const;            // Sum of heights of items [0, item_n)
+    IMGUI_API int       FindItemAtOffset(double offset) const;      // Item covering 'offset' (clamped to existing items)
+    double              GetTotalHeight() const                      { return GetItemOffset(Heights.Size); }
+    void                Clear()                                     { Heights.clear(); Tree.clear(); }
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2080,6 +2080,8 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     draw_list->_PopUnusedDrawCmd();
 
     // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // When the first command of a channel gets merged into the previous one, we mark it with ElemCount == 0 and skip it
+    // when writing, instead of erasing it from the channel (which would shift the whole channel command buffer).
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
     ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
@@ -2100,14 +2102,15 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
                 // Merge previous channel last draw command with current channel first draw command if matching.
                 last_cmd->ElemCount += next_cmd->ElemCount;
                 idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
+                next_cmd->ElemCount = 0;
             }
         }
-        if (ch._CmdBuffer.Size > 0)
+        const int cmd_first = (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.Data[0].ElemCount == 0 && ch._CmdBuffer.Data[0].UserCallback == NULL) ? 1 : 0;
+        if (ch._CmdBuffer.Size > cmd_first)
             last_cmd = &ch._CmdBuffer.back();
-        new_cmd_buffer_count += ch._CmdBuffer.Size;
+        new_cmd_buffer_count += ch._CmdBuffer.Size - cmd_first;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
+        for (int cmd_n = cmd_first; cmd_n < ch._CmdBuffer.Size; cmd_n++)
         {
             ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
             idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
@@ -2122,7 +2125,8 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        const int cmd_first = (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.Data[0].ElemCount == 0 && ch._CmdBuffer.Data[0].UserCallback == NULL) ? 1 : 0;
+        if (int sz = ch._CmdBuffer.Size - cmd_first) { memcpy(cmd_write, ch._CmdBuffer.Data + cmd_first, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
     draw_list->_IdxWritePtr = idx_write;
@@ -3950,6 +3954,39 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
             }
         }
 
+        // Fast path: measure a whole run of ASCII characters without going through the UTF-8 decoder
+        if (!word_wrap_enabled && s + 1 < text_end && ((unsigned char)s[0] | (unsigned char)s[1]) < 0x80 && s[0] != 0)
+        {
+            const char* run_end = s + ImTextCountLeadingAscii(s, text_end);
+            while (s < run_end)
+            {
+                const unsigned int c = (unsigned int)*s;
+                if (c < 32)
+                {
+                    if (c == '\n')
+                    {
+                        text_size.x = ImMax(text_size.x, line_width);
+                        text_size.y += line_height;
+                        line_width = 0.0f;
+                        s++;
+                        continue;
+                    }
+                    if (c == '\r')
+                    {
+                        s++;
+                        continue;
+                    }
+                }
+                const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+                if (line_width + char_width >= max_width)
+                    break;
+                line_width += char_width;
+                s++;
+            }
+            if (s < run_end || s >= text_end)
+                break;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
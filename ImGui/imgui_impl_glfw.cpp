@@ -1222,7 +1222,7 @@ static void ImGui_ImplGlfw_RenderWindow(ImGuiViewport* viewport, void*)
 {
     ImGui_ImplGlfw_Data* bd = ImGui_ImplGlfw_GetBackendData();
     ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
-    if (bd->ClientApi == GlfwClientApi_OpenGL)
+    if (bd->ClientApi == GlfwClientApi_OpenGL && glfwGetCurrentContext() != vd->Window)
         glfwMakeContextCurrent(vd->Window);
 }
 
@@ -1232,7 +1232,9 @@ static void ImGui_ImplGlfw_SwapBuffers(ImGuiViewport* viewport, void*)
     ImGui_ImplGlfw_ViewportData* vd = (ImGui_ImplGlfw_ViewportData*)viewport->PlatformUserData;
     if (bd->ClientApi == GlfwClientApi_OpenGL)
     {
-        glfwMakeContextCurrent(vd->Window);
+        // Skip the context switch when the viewport was just rendered (e.g. render then swap each viewport in turn)
+        if (glfwGetCurrentContext() != vd->Window)
+            glfwMakeContextCurrent(vd->Window);
         glfwSwapBuffers(vd->Window);
     }
 }
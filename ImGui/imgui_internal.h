@@ -59,6 +59,9 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 #endif
 
 // Visual Studio warnings
@@ -146,9 +149,13 @@ struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
+struct ImGuiPlotSummary;            // Storage for a series of samples with a min/max summary, plotted with PlotSummaryEx()
 struct ImGuiPopupData;              // Storage for current popup stack
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
+struct ImGuiSettingsSaveJob;        // Storage for a .ini file write in progress on a worker thread
 struct ImGuiStackSizes;             // Storage of stack sizes for debugging/asserting
+struct ImGuiStreamingPlot;          // Storage for a ring of samples pushed by another thread, plotted with PlotStreamingEx()
+struct ImGuiStreamingPlotCounters;  // Storage for the atomic counters of an ImGuiStreamingPlot, shared with its producer thread
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
 struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
@@ -159,8 +166,21 @@ struct ImGuiTableInstanceData;      // Storage for one instance of a same table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTableDataSource;        // Storage for rows of a table submitted with DataTable()
+struct ImGuiTableDataSortJob;       // Storage for a sort of an ImGuiTableDataSource in progress (possibly on a worker thread)
+struct ImGuiTableQuery;             // Storage for a sort + filter query over columnar data, run on worker threads
+struct ImGuiTableQueryJob;          // Storage for an ImGuiTableQuery in progress
+struct ImGuiTableQueryWorkers;      // Worker threads of an ImGuiTableQuery, kept between jobs (std::thread, defined in imgui_tables.cpp)
+struct ImGuiTableQueryResult;       // Storage for rows produced by an ImGuiTableQuery
+struct ImGuiTextDocument;           // Storage for a large text document edited with InputTextDocument()
+struct ImGuiTextDocumentPiece;      // Storage for one piece of an ImGuiTextDocument
+struct ImGuiTextLayoutCache;        // Storage for cached text measurements, see CalcTextSize()
+struct ImGuiTextLayoutCacheEntry;   // Storage for one cached text measurement
+struct ImGuiTypingSelectIndex;      // Storage for a sorted index of item names, for TypingSelectFindMatch() over very large lists
 struct ImGuiTypingSelectState;      // Storage for GetTypingSelectRequest()
 struct ImGuiTypingSelectRequest;    // Storage for GetTypingSelectRequest() (aimed to be public)
+struct ImGuiVirtualTree;            // Storage for a lazily loaded tree displayed with VirtualTree()
+struct ImGuiVirtualTreeNode;        // Storage for one node of an ImGuiVirtualTree
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowDockStyle;        // Storage for window-style data which needs to be stored for docking purpose
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
@@ -420,6 +440,7 @@ IMGUI_API int           ImTextCountUtf8BytesFromChar(const char* in_text, const
 IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end);                        // return number of bytes to express string in UTF-8
 IMGUI_API const char*   ImTextFindPreviousUtf8Codepoint(const char* in_text_start, const char* in_text_curr);                   // return previous UTF-8 code-point.
 IMGUI_API int           ImTextCountLines(const char* in_text, const char* in_text_end);                                         // return number of lines taken by text. trailing carriage return doesn't count as an extra line.
+IMGUI_API int           ImTextCountLeadingAscii(const char* in_text, const char* in_text_end);                                  // return number of leading non-zero ASCII bytes (scanning 16/32 bytes at a time with SSE2/AVX2).
 
 // Helpers: File System
 #ifdef IMGUI_DISABLE_FILE_FUNCTIONS
@@ -438,6 +459,7 @@ IMGUI_API bool              ImFileClose(ImFileHandle file);
 IMGUI_API ImU64             ImFileGetSize(ImFileHandle file);
 IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFileHandle file);
 IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
+IMGUI_API bool              ImFileRename(const char* src_filename, const char* dst_filename);    // Replace dst with src (atomically where the OS allows it)
 #else
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
@@ -504,6 +526,7 @@ static inline ImVec2 ImMul(const ImVec2& lhs, const ImVec2& rhs)
 static inline bool   ImIsFloatAboveGuaranteedIntegerPrecision(float f)          { return f <= -16777216 || f >= 16777216; }
 static inline float  ImExponentialMovingAverage(float avg, float sample, int n) { avg -= avg / n; avg += sample / n; return avg; }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
+IMGUI_API void       ImMinMaxF(const float* data, int count, float* out_min, float* out_max);   // Ignore NaN values. Output FLT_MAX/-FLT_MAX when no values.
 
 // Helpers: Geometry
 IMGUI_API ImVec2     ImBezierCubicCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, float t);
@@ -748,6 +771,72 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+//-----------------------------------------------------------------------------
+// Helper: ImTieredAllocator
+// Allocator for Dear ImGui, to install with SetAllocatorFunctions() before creating the context:
+//   static ImTieredAllocator allocator;
+//   ImGui::SetAllocatorFunctions(ImTieredAllocator::AllocFunc, ImTieredAllocator::FreeFunc, &allocator);
+// - Allocations up to IM_TIERED_ALLOCATOR_MAX_POOLED_SIZE bytes are served from size-class pools (16, 32, 64.. bytes).
+//   Freed blocks are reused and pages are never released, so containers which reached their steady-state size don't reach malloc().
+// - Larger allocations are forwarded to the backend allocator given to the constructor (malloc/free by default).
+// - AllocFrame(): bump allocation from a per-frame arena, reset by NewFrame() (called by ImGui::NewFrame()). Use ImGui::MemAllocFrame().
+//   The arena grows to the largest amount used in a frame. Don't call MemFree() on those allocations.
+//   The arena is shared by all contexts: with several contexts, a frame allocation is only valid until the next NewFrame() of any of them.
+// - AllocFunc()/FreeFunc() are thread-safe, as worker threads (e.g. DataTable() sorts) may allocate. AllocFrame() is not.
+// - The allocator needs to outlive all contexts and ImVector<> instances using it.
+//-----------------------------------------------------------------------------
+
+#define IM_TIERED_ALLOCATOR_CLASSES_COUNT       8       // Size classes: 16, 32, 64 ... 2048 bytes
+#define IM_TIERED_ALLOCATOR_MAX_POOLED_SIZE     (16 << (IM_TIERED_ALLOCATOR_CLASSES_COUNT - 1))
+#define IM_TIERED_ALLOCATOR_PAGE_SIZE           (64 * 1024)
+
+struct ImTieredAllocatorStats
+{
+    int             AllocCount;             // Calls to AllocFunc()
+    int             FreeCount;              // Calls to FreeFunc()
+    int             BackendAllocCount;      // Allocations which reached the backend allocator (large blocks and new pages)
+    size_t          AllocBytes;             // Bytes requested from AllocFunc()
+    size_t          FrameBytes;             // Bytes requested from AllocFrame()
+};
+
+struct ImTieredAllocatorLock;       // Spin lock (std::atomic, defined in imgui.cpp)
+
+struct ImTieredAllocatorClass
+{
+    void*           FreeList;               // Linked list of free blocks
+    int             BlocksCount;            // Blocks carved from pages
+    int             BlocksUsed;
+};
+
+struct IMGUI_API ImTieredAllocator
+{
+    ImTieredAllocatorClass  Classes[IM_TIERED_ALLOCATOR_CLASSES_COUNT];
+    void*                   Pages;          // Linked list of pages, freed by destructor
+    size_t                  PagesBytes;
+    size_t                  LargeBytes;     // Bytes currently allocated from the backend for large blocks
+    char*                   FrameArena;
+    size_t                  FrameArenaSize;
+    size_t                  FrameArenaUsed;
+    void*                   FrameOverflow;  // Linked list of blocks allocated when FrameArena was full, freed by NewFrame() which then grows FrameArena.
+    size_t                  FrameOverflowBytes;
+    ImTieredAllocatorStats  FrameStats;     // Stats for current frame
+    ImTieredAllocatorStats  LastFrameStats; // Stats for last complete frame
+    ImTieredAllocatorLock*  Lock;           // Allocated from the backend allocator
+    ImGuiMemAllocFunc       BackendAllocFunc;
+    ImGuiMemFreeFunc        BackendFreeFunc;
+    void*                   BackendUserData;
+
+    ImTieredAllocator(ImGuiMemAllocFunc backend_alloc_func = NULL, ImGuiMemFreeFunc backend_free_func = NULL, void* backend_user_data = NULL); // Default backend: malloc/free
+    ~ImTieredAllocator();
+    void*                   Alloc(size_t size);
+    void                    Free(void* ptr);
+    void*                   AllocFrame(size_t size);                    // Transient allocation, valid until next NewFrame()
+    void                    NewFrame();                                 // Reset frame arena and stats
+    ImTieredAllocatorStats  GetFrameStats();                            // Copy of FrameStats, safe while worker threads allocate
+    static void*            AllocFunc(size_t size, void* user_data)     { return ((ImTieredAllocator*)user_data)->Alloc(size); }
+    static void             FreeFunc(void* ptr, void* user_data)        { ((ImTieredAllocator*)user_data)->Free(ptr); }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -1135,10 +1224,12 @@ struct IMGUI_API ImGuiInputTextState
     bool                    ReloadUserBuf;          // force a reload of user buf so it may be modified externally. may be automatic in future version.
     int                     ReloadSelectionStart;   // POSITIONS ARE IN IMWCHAR units *NOT* UTF-8 this is why this is not exposed yet.
     int                     ReloadSelectionEnd;
+    ImVector<int>           LineStartsW;            // multi-line: index in TextW of the first character of each line. Maintained by edits, so rendering only needs to visit visible lines.
+    bool                    LineStartsValid;        // cleared when TextW is rewritten as a whole, LineStartsW is then rebuilt on next render
 
     ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
-    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
+    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; LineStartsValid = false; CursorClamp(); }
+    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); LineStartsW.clear(); LineStartsValid = false; }
     int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
     int         GetRedoAvailCount() const   { return IMSTB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
@@ -1164,6 +1255,119 @@ struct IMGUI_API ImGuiInputTextState
 
 };
 
+// One piece of an ImGuiTextDocument = a range of bytes in one of its two source buffers.
+// Pieces are the nodes of an implicit treap (randomized balanced binary tree ordered by document position).
+struct IMGUI_API ImGuiTextDocumentPiece
+{
+    int         Left, Right;            // Child pieces (-1 when none)
+    ImU32       Priority;               // Treap priority, a parent always has a priority >= its children
+    int         Offset;                 // Start of the piece in its source buffer
+    int         Length;                 // Length of the piece in bytes
+    int         LineBreaks;             // Number of '\n' within the piece
+    int         SubtreeLength;          // Sum of Length over this piece and its children
+    int         SubtreeLineBreaks;      // Sum of LineBreaks over this piece and its children
+    bool        InAdded;                // Source buffer is ImGuiTextDocument::Added (otherwise ::Original)
+};
+
+// Large text document, edited with InputTextDocument().
+// - The text is a sequence of pieces referencing either the loaded text (Original) or an append-only buffer of inserted text (Added).
+//   Loading a document never converts it to ImWchar and editing never moves existing text.
+// - Pieces are kept in a balanced tree aggregating byte and line counts, and the line breaks of each source buffer are indexed once,
+//   so that edits and offset<->line conversions are O(log N) regardless of the document size.
+// - All positions are byte offsets into the UTF-8 text.
+struct IMGUI_API ImGuiTextDocument
+{
+    ImVector<char>          Original;               // Text given to SetText()
+    ImVector<char>          Added;                  // Text inserted since, append-only
+    ImVector<int>           OriginalLineBreaks;     // Sorted offsets of '\n' in Original
+    ImVector<int>           AddedLineBreaks;        // Sorted offsets of '\n' in Added
+    ImVector<ImGuiTextDocumentPiece> Pieces;        // Pool of tree nodes
+    ImVector<int>           PiecesFreeList;         // Unused entries of Pieces
+    int                     Root;                   // Root piece (-1 when the document is empty)
+    ImU32                   RandomSeed;             // For treap priorities
+
+    // Edit state, maintained by InputTextDocument()
+    int                     Cursor;                 // Cursor position
+    int                     SelectionAnchor;        // Other end of the selection (== Cursor when nothing is selected)
+    float                   PreferredX;             // Horizontal position to keep when moving up/down (< 0.0f: none)
+    float                   CursorAnim;             // Timer for cursor blink
+    bool                    CursorFollow;           // Scroll to make the cursor visible
+    float                   MaxLineWidth;           // Widest line rendered so far, for horizontal scrolling
+    ImVector<char>          TempLine;               // Scratch buffer for the line being measured/rendered
+
+    ImGuiTextDocument()                         { Root = -1; RandomSeed = 0x9E3779B9; Cursor = SelectionAnchor = 0; PreferredX = -1.0f; CursorAnim = 0.0f; CursorFollow = false; MaxLineWidth = 0.0f; }
+    void        SetText(const char* text, const char* text_end = NULL); // Replace whole contents, clearing the edit history
+    void        Clear()                         { SetText(""); }
+    int         GetLength() const               { return Root != -1 ? Pieces[Root].SubtreeLength : 0; }
+    int         GetLineCount() const            { return (Root != -1 ? Pieces[Root].SubtreeLineBreaks : 0) + 1; }
+    int         GetLineStart(int line_no) const;                        // Offset of the first byte of a line
+    int         GetLineEnd(int line_no) const   { return (line_no + 1 < GetLineCount()) ? GetLineStart(line_no + 1) - 1 : GetLength(); } // Offset of the line's '\n' (or end of document)
+    int         GetLineFromOffset(int offset) const;
+    char        GetChar(int offset) const;
+    void        CopyText(int offset, int len, char* out) const;         // Copy 'len' bytes to 'out' (not zero-terminated)
+    void        ExportText(ImVector<char>* out) const;                  // Copy whole document, zero-terminated
+    void        InsertText(int offset, const char* text, int len);
+    void        DeleteText(int offset, int len);
+    bool        HasSelection() const            { return Cursor != SelectionAnchor; }
+};
+
+// Series of samples with a multi-resolution min/max summary, plotted with PlotSummaryEx().
+// - Level 0 stores the min/max of each block of IM_PLOT_SUMMARY_BLOCK_SIZE samples, each next level the min/max of 4 entries of the level below.
+// - Appending a sample updates one entry per level. The min/max of any range of samples is found in O(log N),
+//   which lets PlotSummaryEx() decimate millions of samples down to one min/max pair per pixel column every frame.
+#define IM_PLOT_SUMMARY_BLOCK_SIZE      16
+#define IM_PLOT_SUMMARY_LEVELS_MAX      14      // Last level has blocks of 16 << 26 samples
+struct IMGUI_API ImGuiPlotSummary
+{
+    ImVector<float>         Values;                                 // Samples
+    ImVector<ImVec2>        Levels[IM_PLOT_SUMMARY_LEVELS_MAX];     // Min/max of each block (x = min, y = max). FLT_MAX/-FLT_MAX for blocks with only NaN values.
+    int                     LevelsCount;                            // Only levels with more than one block are created
+
+    ImGuiPlotSummary()      { LevelsCount = 0; }
+    void    Clear();
+    void    Append(float v);
+    void    Append(const float* values, int values_count);
+    void    GetMinMax(int first, int last, float* out_min, float* out_max) const;  // Over samples [first, last), ignoring NaN values
+    static int GetBlockSize(int level)  { return IM_PLOT_SUMMARY_BLOCK_SIZE << (level * 2); }
+};
+
+// Fixed-capacity ring of samples pushed by a sampling thread, plotted with PlotStreamingEx().
+// - Single producer/single consumer, lock-free: the sampling thread only calls Push(), the UI thread only calls PlotStreamingEx().
+// - Samples are written in place in the ring and read from there (no copy). The last DisplayCount consumed samples are displayed,
+//   Push() returns false and drops the sample when the ring is full of samples that are displayed or not consumed yet.
+// - The min/max of displayed samples is maintained incrementally (monotonic queues), so auto-scaling is O(1) per frame.
+// - Line segments are tessellated once when they scroll in, then copied with an offset on following frames (as long as scale and size don't change).
+struct IMGUI_API ImGuiStreamingPlot
+{
+    ImVector<float>         Samples;                // Ring of samples, never reallocated after construction
+    ImU32                   CapacityMask;           // Samples.Size - 1 (Samples.Size is a power of two)
+    int                     DisplayCount;           // Number of samples displayed
+    ImGuiStreamingPlotCounters* Counters;           // Shared with the producer: samples written, released by the consumer, dropped
+
+    // Consumer state, maintained by PlotStreamingEx()
+    ImU32                   ConsumedCount;          // Samples before this one were consumed
+    int                     DisplaySize;            // Number of samples currently displayed (<= DisplayCount)
+    ImVector<ImU32>         MinQueue, MaxQueue;     // Monotonic queues of displayed sample indices (rings of same capacity as Samples)
+    ImU32                   MinQueueHead, MinQueueTail, MaxQueueHead, MaxQueueTail;
+    ImVector<ImDrawVert>    CacheVtx;               // Tessellated segments, CacheVtxPerSegment per sample slot, relative to the segment start
+    ImVector<ImDrawIdx>     CacheIdx;               // CacheIdxPerSegment per sample slot, relative to the segment first vertex
+    int                     CacheVtxPerSegment, CacheIdxPerSegment;
+    ImU32                   CacheBegin, CacheEnd;   // Segments [CacheBegin, CacheEnd) are cached. Segment N joins samples N-1 and N.
+    ImVec4                  CacheScaleAndSize;      // Scale min/max, segment width and plot height used by cached segments
+    ImU32                   CacheCol;
+    ImDrawListFlags         CacheFlags;
+    ImVec2                  CacheTexUvWhitePixel;   // Changes when the font atlas is rebuilt
+
+    ImGuiStreamingPlot(int display_count, int capacity = 0);   // Capacity defaults to at least 2x display_count
+    ~ImGuiStreamingPlot();
+    bool    Push(float v);                          // [Producer] Return false if the sample was dropped
+    ImU32   GetDroppedCount() const;                // Number of samples dropped because the ring was full
+    void    Consume();                              // [Consumer] Consume pushed samples, called by PlotStreamingEx()
+    ImU32   GetDisplayBegin() const                 { return ConsumedCount - (ImU32)DisplaySize; }
+    float   GetSample(ImU32 sample_n) const         { return Samples.Data[sample_n & CapacityMask]; }
+    void    GetMinMax(float* out_min, float* out_max) const;   // Over displayed samples, ignoring NaN values
+};
+
 enum ImGuiWindowRefreshFlags_
 {
     ImGuiWindowRefreshFlags_None                = 0,
@@ -1277,6 +1481,52 @@ struct ImGuiNavTreeNodeData
     ImRect                  NavRect;
 };
 
+// Node of an ImGuiVirtualTree. Children of a node are stored contiguously in ImGuiVirtualTree::Nodes[].
+struct ImGuiVirtualTreeNode
+{
+    ImU64                   UserID;             // Passed to GetNodeLabel()
+    int                     Parent;             // Index in Nodes[], -1 for the root node
+    int                     ChildrenStart;      // Index of first child in Nodes[], valid when ChildrenCount > 0
+    int                     ChildrenCount;
+    ImS16                   Depth;              // 0 for top-level nodes (-1 for the root node)
+    ImU8                    HasChildren : 1;    // Node may have children, which are loaded on first open
+    ImU8                    IsOpen : 1;
+    ImU8                    IsLoaded : 1;       // Children have been added
+    ImU8                    IsLoading : 1;      // LoadChildren() returned false, waiting for EndLoadChildren()
+};
+
+// Tree displayed with VirtualTree(), for hierarchies too large to be walked every frame.
+// - Nodes are created when their parent is first opened: LoadChildren() is called and adds children with AddChild().
+//   To load children asynchronously, return false then call AddChild() + EndLoadChildren() later (from the UI thread).
+// - Open nodes are flattened into VisibleRows[], which is updated incrementally when a node is opened or closed,
+//   and only visible rows are submitted using ImGuiListClipper. Open state is stored in nodes, not in ImGuiStorage.
+// - Children loaded by EndLoadChildren() are not inserted right away: VisibleRows[] is rebuilt once on next use,
+//   so that many asynchronous loads completing in the same frame cost a single pass over the visible rows.
+// - Node indices are stable until Clear(). Nodes[0] is the root node, which isn't displayed.
+struct IMGUI_API ImGuiVirtualTree
+{
+    bool                    (*LoadChildren)(void* user_data, ImGuiVirtualTree* tree, int node_n);           // Add children of 'node_n' with AddChild() and return true, or return false if loading asynchronously.
+    const char*             (*GetNodeLabel)(void* user_data, ImU64 user_id, char* buf, int buf_size);       // Optional: return node label, which may be written to 'buf'. Default to displaying UserID.
+    void*                   UserData;
+    int                     SelectedNode;       // Index in Nodes[] of selected node, or -1.
+
+    // [Internal]
+    ImVector<ImGuiVirtualTreeNode> Nodes;
+    ImVector<int>           VisibleRows;        // Display row -> index in Nodes[], for nodes whose ancestors are all open and loaded.
+    bool                    VisibleRowsDirty;   // VisibleRows[] is missing children loaded by EndLoadChildren(), see UpdateVisibleRows().
+    ImVector<int>           TempRows;
+    ImVector<int>           TempStack;
+
+    ImGuiVirtualTree()      { LoadChildren = NULL; GetNodeLabel = NULL; UserData = NULL; SelectedNode = -1; VisibleRowsDirty = false; }
+    void                    Clear();                                                    // Remove all nodes. The root node is reloaded by the next VirtualTree() call.
+    int                     AddChild(int parent_n, ImU64 user_id, bool has_children);   // Return index of new node. All children of a node need to be added before adding children to another node.
+    void                    EndLoadChildren(int node_n);                                // Finish asynchronous loading of children of 'node_n'.
+    void                    SetNodeOpen(int node_n, bool open, int row_n = -1);         // Open/close node, loading children if needed. 'row_n': index in VisibleRows[] if known.
+    bool                    IsNodeVisible(int node_n) const;                            // Return true if all ancestors are open and loaded.
+    int                     FindVisibleRow(int node_n);                                 // Return index in VisibleRows[], or -1.
+    void                    UpdateVisibleRows();                                        // Rebuild VisibleRows[] if children were loaded since last call. Called by VirtualTree().
+};
+
 struct IMGUI_API ImGuiStackSizes
 {
     short   SizeOfIDStack;
@@ -1533,13 +1783,16 @@ struct ImGuiListClipperRange
 struct ImGuiListClipperData
 {
     ImGuiListClipper*               ListClipper;
+    ImGuiListClipperHeights*        Heights;            // Set by BeginVariableHeight()
+    int                             MeasureItem;        // Item submitted by the last step, to be measured by the next one (variable height only)
+    float                           MeasureStartPosY;
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
     ImVector<ImGuiListClipperRange> Ranges;
 
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; Heights = NULL; MeasureItem = -1; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -1669,6 +1922,75 @@ struct IMGUI_API ImGuiTypingSelectState
     void            Clear()  { SearchBuffer[0] = 0; SingleCharModeLock = false; } // We preserve remaining data for easier debugging
 };
 
+// Prebuilt index of item names, so TypingSelectFindMatch() is O(log N) instead of calling the name getter for every item.
+// Call Build() once for a given list of items (and again when it changes). Names are compared case-insensitively, like the linear search.
+// Results are identical to the linear search: first item (in list order) with the longest leading match, or next item starting with the same character.
+struct IMGUI_API ImGuiTypingSelectIndex
+{
+    ImVector<int>   SortedItems;            // Item indices sorted by name, then by index
+    ImVector<int>   SortedItemsMinTree;     // Segment tree over SortedItems giving the smallest item index of a range
+    ImVector<ImU64> FirstCharItems;         // (First character << 32) | item index, sorted
+
+    void            Build(int items_count, const char* (*get_item_name_func)(void*, int), void* user_data);
+    void            Clear()                 { SortedItems.clear(); SortedItemsMinTree.clear(); FirstCharItems.clear(); }
+    int             GetItemsCount() const   { return SortedItems.Size; }
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] Text layout cache
+//-----------------------------------------------------------------------------
+
+// One cached text measurement, keyed by (font, font size, wrap width, text contents)
+// The key is only used to find the entry: all the inputs are stored and compared on lookup, so a hash collision can't return another text's layout.
+struct ImGuiTextLayoutCacheEntry
+{
+    ImGuiID         Key;
+    ImFont*         Font;               // NULL for evicted entries, see ImGuiTextLayoutCache::FreeEntries
+    const float*    FontAdvances;       // Font->IndexAdvanceX.Data, changes when the font atlas is rebuilt
+    float           FontSize;
+    float           WrapWidth;
+    int             TextOffset;         // Index of text copy in ImGuiTextLayoutCache::TextData
+    int             TextLen;
+    int             LastFrameUsed;
+    ImVec2          Size;               // Output of ImFont::CalcTextSizeA() (not rounded)
+    int             LinesOffset;        // Index of first line in ImGuiTextLayoutCache::LineRanges, -1 if not computed yet (only computed for wrapped text being rendered)
+    int             LinesCount;
+};
+
+// Bounded, frame-aged cache of text measurements and word-wrap positions.
+// - Used by CalcTextSize() and RenderTextWrapped(), so TextEx()/TextWrapped() don't measure and wrap the same text every frame.
+// - Short unwrapped text is not cached: hashing it costs about as much as measuring it. For the same reason RenderText() doesn't
+//   use the cache: it mostly renders short labels, and TextEx() already clips long unwrapped text to its visible lines.
+// - Entries unused for MaxAge frames (or unused last frame when the cache is full) are evicted by a sweep bounded per frame.
+//   Evicted entries are reused by insertions. Their text and lines are reclaimed by compacting the cache once they make up half of it.
+struct IMGUI_API ImGuiTextLayoutCache
+{
+    ImVector<ImGuiTextLayoutCacheEntry> Entries;
+    ImGuiStorage    Map;                // Key -> index into Entries
+    ImVector<int>   LineRanges;         // Pairs of [begin, end) byte offsets of each visual line, for entries with LinesOffset != -1
+    ImVector<int>   LineRangesTemp;     // Swapped with LineRanges during garbage collection, so both buffers keep their capacity
+    ImVector<char>  TextData;           // Copy of each entry's text, compared on lookup
+    ImVector<char>  TextDataTemp;       // Swapped with TextData during garbage collection
+    ImVector<int>   FreeEntries;        // Indices of evicted entries
+    int             SweepIndex;         // Next entry checked by the eviction sweep
+    int             GarbageKeys;        // Map keys of evicted entries (set to -1), since last compaction
+    int             GarbageTextLen;     // Bytes of TextData used by evicted entries
+    int             GarbageLinesCount;  // Lines of LineRanges used by evicted entries
+    int             MaxEntries;         // Set to 0 to disable the cache
+    int             MaxAge;             // In frames
+    int             MinTextLen;         // Minimum text length for caching unwrapped text
+    int             HitsThisFrame;
+    int             MissesThisFrame;
+    int             HitsLastFrame;
+    int             MissesLastFrame;
+    ImU64           HitsTotal;
+    ImU64           MissesTotal;
+
+    ImGuiTextLayoutCache()  { SweepIndex = GarbageKeys = GarbageTextLen = GarbageLinesCount = 0; MaxEntries = 4096; MaxAge = 60; MinTextLen = 32; HitsThisFrame = MissesThisFrame = HitsLastFrame = MissesLastFrame = 0; HitsTotal = MissesTotal = 0; }
+    void            Clear() { Entries.clear(); Map.Clear(); LineRanges.clear(); LineRangesTemp.clear(); TextData.clear(); TextDataTemp.clear(); FreeEntries.clear(); SweepIndex = GarbageKeys = GarbageTextLen = GarbageLinesCount = 0; }
+    int             GetEntriesCount() const { return Entries.Size - FreeEntries.Size; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Columns support
 //-----------------------------------------------------------------------------
@@ -1790,6 +2112,26 @@ enum ImGuiDockNodeState
     ImGuiDockNodeState_HostWindowVisible,
 };
 
+// Layout inputs of a dock node, stored by the last DockNodeTreeUpdatePosSize() pass over it.
+// DockNodeUpdateFlagsAndCollapse() compares them every frame: unchanged nodes keep their Pos/Size and are not laid out again.
+struct ImGuiDockNodeLayoutState
+{
+    ImGuiDockNode*          ParentNode;
+    ImGuiDockNode*          ChildNodes[2];
+    ImVector<ImGuiWindow*>  Windows;                    // Copy of Windows[] (same order)
+    ImVec2                  Pos;
+    ImVec2                  Size;
+    ImVec2                  SizeRef;
+    ImVec2                  WindowMinSize;              // Style values used by the size allocation policy
+    float                   SeparatorSize;
+    ImGuiDockNodeFlags      MergedFlags;
+    ImGuiAxis               SplitAxis;
+    bool                    IsVisible;
+    bool                    WantLockSizeOnce;
+
+    ImGuiDockNodeLayoutState() { ParentNode = ChildNodes[0] = ChildNodes[1] = NULL; SeparatorSize = 0.0f; MergedFlags = ImGuiDockNodeFlags_None; SplitAxis = ImGuiAxis_None; IsVisible = WantLockSizeOnce = false; }
+};
+
 // sizeof() 156~192
 struct IMGUI_API ImGuiDockNode
 {
@@ -1814,7 +2156,9 @@ struct IMGUI_API ImGuiDockNode
     ImGuiWindow*            VisibleWindow;              // Generally point to window which is ID is == SelectedTabID, but when CTRL+Tabbing this can be a different window.
     ImGuiDockNode*          CentralNode;                // [Root node only] Pointer to central node.
     ImGuiDockNode*          OnlyNodeWithWindows;        // [Root node only] Set when there is a single visible node within the hierarchy.
+    ImGuiDockNode*          FirstNodeWithWindows;       // [Root node only] Kept for frames where the hierarchy is unchanged and DockNodeFindInfo() is skipped.
     int                     CountNodeWithWindows;       // [Root node only]
+    ImGuiDockNodeLayoutState LayoutState;               // Layout inputs as of the last DockNodeTreeUpdatePosSize() pass over this node.
     int                     LastFrameAlive;             // Last frame number the node was updated or kept alive explicitly with DockSpace() + ImGuiDockNodeFlags_KeepAliveOnly
     int                     LastFrameActive;            // Last frame number the node was updated.
     int                     LastFrameFocused;           // Last frame number the node was focused.
@@ -1836,6 +2180,7 @@ struct IMGUI_API ImGuiDockNode
     bool                    WantMouseMove           :1; // After a node extraction we need to transition toward moving the newly created host window
     bool                    WantHiddenTabBarUpdate  :1;
     bool                    WantHiddenTabBarToggle  :1;
+    bool                    IsLayoutDirty           :1; // Set when this node or one of its child nodes differs from its LayoutState, cleared once laid out.
 
     ImGuiDockNode(ImGuiID id);
     ~ImGuiDockNode();
@@ -1881,6 +2226,12 @@ struct ImGuiDockContext
     ImVector<ImGuiDockRequest>      Requests;
     ImVector<ImGuiDockNodeSettings> NodesSettings;
     bool                            WantFullRebuild;
+    int                             NodesLayoutChecked;         // Nodes compared against their LayoutState this frame
+    int                             NodesLayoutUpdated;         // Nodes laid out again this frame
+    int                             NodesLayoutCheckedPrev;     // Same for previous frame, for display
+    int                             NodesLayoutUpdatedPrev;
+    ImVec4                          StyleColorsSrc[ImGuiWindowDockStyleCol_COUNT];  // Style colors last converted by StoreDockStyleForWindow()
+    ImGuiWindowDockStyle            StyleColors;                                    // Packed StyleColorsSrc[]
     ImGuiDockContext()              { memset(this, 0, sizeof(*this)); }
 };
 
@@ -1935,6 +2286,15 @@ struct ImGuiViewportP : public ImGuiViewport
 // [SECTION] Settings support
 //-----------------------------------------------------------------------------
 
+// Fields of ImGuiWindowSettings written in .ini data
+struct ImGuiWindowSettingsIniFields
+{
+    ImVec2ih    Pos, Size, ViewportPos;
+    ImGuiID     ViewportId, DockId, ClassId;
+    short       DockOrder;
+    bool        Collapsed, IsChild;
+};
+
 // Windows data saved in imgui.ini file
 // Because we never destroy or rename ImGuiWindowSettings, we can store the names in a separate buffer easily.
 // (this is designed to be stored in a ImChunkStream buffer, with the variable-length Name following our structure)
@@ -1952,6 +2312,9 @@ struct ImGuiWindowSettings
     bool        IsChild;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
     bool        WantDelete;     // Set to invalidate/delete the settings entry
+    ImGuiWindowSettingsIniFields IniFields; // Fields written in .ini data by last write, when IniSize != 0
+    int         IniOffset;      // Offset of this entry's text in g.SettingsWindowsIniCache (last write), reused by next write if IniFields didn't change
+    int         IniSize;        // Size of this entry's text in g.SettingsWindowsIniCache, 0 if not written yet
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); DockOrder = -1; }
     char* GetName()             { return (char*)(this + 1); }
@@ -2029,6 +2392,15 @@ struct ImGuiDebugAllocEntry
     int         FrameCount;
     ImS16       AllocCount;
     ImS16       FreeCount;
+    int         AllocBytes;
+};
+
+// Heap allocation made after warm-up (io.ConfigDebugSteadyStateWarmupFrames)
+struct ImGuiDebugAllocReport
+{
+    int         FrameCount;
+    int         Size;
+    char        Tags[120];                  // Tag stack + current window/table, e.g. "NewFrame > Dear ImGui Demo"
 };
 
 struct ImGuiDebugAllocInfo
@@ -2038,6 +2410,14 @@ struct ImGuiDebugAllocInfo
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
 
+    // Steady-state audit
+    int         SteadyStateFrameStart;      // Warm-up is counted from this frame
+    int         SteadyStateAllocCount;      // Number of MemAlloc() calls made after warm-up
+    int         TagStackSize;
+    const char* TagStack[8];                // Pushed with DebugAllocPushTag(). Strings need to persist until popped.
+    ImS16       ReportsIdx;                 // Current index in buffer
+    ImGuiDebugAllocReport ReportsBuf[8];    // Track last 8 allocations made after warm-up
+
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
 
@@ -2136,13 +2516,15 @@ struct ImGuiContext
     ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail.
     ImGuiMouseSource        InputEventsNextMouseSource;
     ImU32                   InputEventsNextEventId;
+    int                     InputEventsMergedMousePos;          // Number of mouse pos events merged into the previous queued one (io.ConfigInputCoalesceMouseEvents), since context creation.
+    int                     InputEventsMergedMouseWheel;        // Same for mouse wheel events
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
-    ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
+    ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow* (hashed: O(1) lookup with many windows)
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     ImVec2                  WindowsHoverPadding;                // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, WINDOWS_HOVER_PADDING).
     ImGuiID                 DebugBreakInWindow;                 // Set to break in Begin() call.
@@ -2387,6 +2769,7 @@ struct ImGuiContext
     ImVector<char>          ClipboardHandlerData;               // If no custom clipboard handler is defined
     ImVector<ImGuiID>       MenusIdSubmittedThisFrame;          // A list of menu IDs that were rendered at least once
     ImGuiTypingSelectState  TypingSelectState;                  // State for GetTypingSelectRequest()
+    ImGuiTextLayoutCache    TextLayoutCache;                    // Cached text measurements for CalcTextSize()/RenderTextWrapped()
 
     // Platform support
     ImGuiPlatformImeData    PlatformImeData;                    // Data updated by current frame
@@ -2405,6 +2788,11 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiStorage                        SettingsWindowsMap;     // Map ID -> offset in SettingsWindows (hashed)
+    ImGuiStorage                        SettingsTablesMap;      // Map ID -> offset in SettingsTables (hashed)
+    ImGuiTextBuffer                     SettingsWindowsIniCache;        // Text of all window entries from last write. Unchanged entries are copied from it instead of being formatted again.
+    ImGuiTextBuffer                     SettingsWindowsIniCacheTemp;    // Next SettingsWindowsIniCache, swapped with it after a write
+    ImGuiSettingsSaveJob*               SettingsSaveJob;        // .ini file write in progress or finished on a worker thread (io.IniSavingThreaded)
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2454,6 +2842,7 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImVector<void*>         FrameAllocs;                        // Allocations made by MemAllocFrame() when not using ImTieredAllocator, freed by NewFrame()
     char                    TempKeychordName[64];
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
@@ -2477,7 +2866,9 @@ struct ImGuiContext
 
         InputEventsNextMouseSource = ImGuiMouseSource_Mouse;
         InputEventsNextEventId = 1;
+        InputEventsMergedMousePos = InputEventsMergedMouseWheel = 0;
 
+        WindowsById.SetUseHashIndex(true);
         WindowsActiveCount = 0;
         CurrentWindow = NULL;
         HoveredWindow = NULL;
@@ -2624,6 +3015,7 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsSaveJob = NULL;
         HookIdNext = 0;
 
         memset(LocalizationTable, 0, sizeof(LocalizationTable));
@@ -3000,6 +3392,7 @@ struct ImGuiTableColumn
     bool                    IsRequestOutput;                // Return value for TableSetColumnIndex() / TableNextColumn(): whether we request user to output contents or not.
     bool                    IsSkipItems;                    // Do we want item submissions to this column to be completely ignored (no layout will happen).
     bool                    IsPreserveWidthAuto;
+    bool                    IsDrawMergedPrev;               // Set by TableMergeDrawChannels() when contents fit in ClipRect during previous frame, allowing direct draw.
     ImS8                    NavLayerCurrent;                // ImGuiNavLayer in 1 byte
     ImU8                    AutoFitQueue;                   // Queue of 8 values for the next 8 frames to request auto-fit
     ImU8                    CannotSkipItemsQueue;           // Queue of 8 values for the next 8 frames to disable Clipped/SkipItem
@@ -3113,6 +3506,7 @@ struct IMGUI_API ImGuiTable
     ImRect                      Bg2ClipRectForDrawCmd;      // Actual ImDrawCmd clip rect for BG2 channel. This tends to be a correct, tight-fit, because output to BG2 are done by widgets relying on regular ClipRect.
     ImRect                      HostClipRect;               // This is used to check if we can eventually merge our columns draw calls into the current draw call of the current window.
     ImRect                      HostBackupInnerClipRect;    // Backup of InnerWindow->ClipRect during PushTableBackground()/PopTableBackground()
+    ImRect                      DirectDrawClipRect;         // ImDrawCmd clip rect shared by all visible columns when IsDirectDraw is set (== merged clip rect TableMergeDrawChannels() would use). Items are still clipped with their column ClipRect.
     ImGuiWindow*                OuterWindow;                // Parent window for the table
     ImGuiWindow*                InnerWindow;                // Window holding the table data (== OuterWindow or a child window)
     ImGuiTextBuffer             ColumnsNames;               // Contiguous buffer holding columns names
@@ -3149,6 +3543,9 @@ struct IMGUI_API ImGuiTable
     ImGuiTableDrawChannelIdx    DummyDrawChannel;           // Redirect non-visible columns here.
     ImGuiTableDrawChannelIdx    Bg2DrawChannelCurrent;      // For Selectable() and other widgets drawing across columns after the freezing line. Index within DrawSplitter.Channels[]
     ImGuiTableDrawChannelIdx    Bg2DrawChannelUnfrozen;
+    unsigned int                DirectDrawCellIdxOffset;    // Direct draw: index of the first draw index of the current cell, to clip it with its column ClipRect when its contents stray off.
+    int                         DrawCmdCountBeforeMerge;    // [DEBUG] Number of draw commands in the table channels before TableMergeDrawChannels()/DrawSplitter->Merge() (last instance)
+    int                         DrawCmdCountAfterMerge;     // [DEBUG] Number of draw commands added to the inner window draw list after merge (last instance)
     bool                        IsLayoutLocked;             // Set by TableUpdateLayout() which is called when beginning the first row.
     bool                        IsInsideRow;                // Set when inside TableBeginRow()/TableEndRow().
     bool                        IsInitializing;
@@ -3162,6 +3559,7 @@ struct IMGUI_API ImGuiTable
     bool                        IsResetAllRequest;
     bool                        IsResetDisplayOrderRequest;
     bool                        IsUnfrozenRows;             // Set when we got past the frozen row.
+    bool                        IsDirectDraw;               // Set by TableSetupDrawChannels() when all visible columns output into a single channel, in final order, using DirectDrawClipRect.
     bool                        IsDefaultSizingPolicy;      // Set if user didn't explicitly set a sizing policy in BeginTable()
     bool                        IsActiveIdAliveBeforeTable;
     bool                        IsActiveIdInTable;
@@ -3239,6 +3637,116 @@ struct ImGuiTableSettings
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
 };
 
+// Sort key of an ImGuiTableDataSource (copy of one ImGuiTableColumnSortSpecs)
+struct ImGuiTableDataSortKey
+{
+    ImGuiTableColumnIdx     ColumnIndex;
+    ImGuiSortDirection      SortDirection;
+};
+
+// Filter type of an ImGuiTableQueryFilter
+enum ImGuiTableQueryFilterType
+{
+    ImGuiTableQueryFilterType_Substring,            // Text column contains Text (case-insensitive for ASCII)
+    ImGuiTableQueryFilterType_Range,                // Numeric column value is within [Min, Max]
+};
+
+// Column of an ImGuiTableQuery
+struct ImGuiTableQueryColumn
+{
+    ImGuiDataType           DataType;               // ImGuiDataType_S8..ImGuiDataType_Double, or ImGuiDataType_String
+    const void*             Data;                   // RowsCount values of DataType, or RowsCount 'const char*' for ImGuiDataType_String
+};
+
+struct ImGuiTableQueryFilter
+{
+    ImGuiTableQueryFilterType Type;
+    int                     ColumnIndex;
+    char                    Text[128];              // Lowercase
+    int                     TextLen;
+    double                  Min, Max;
+};
+
+struct ImGuiTableQueryResult
+{
+    ImVector<int>           Rows;
+};
+
+// Sort and filter engine over columnar data, for large tables (e.g. through ImGuiTableDataSource::Query).
+// Submit() runs the request (Filters, then SortKeys) on worker threads. Update() takes the resulting rows on the UI thread
+// once the job is done. Rows keep the previous result until then.
+// - Filters: substring search uses SSE2 to find candidate positions, range filters compare values as double.
+// - Sort: LSD radix sort on numeric keys (parallel histograms and scatter, skipping passes where all digits are equal).
+//   Any text key switches to a parallel merge sort. Ties are ordered by row index.
+// - Submit() doesn't wait for a job it cancels: the job stops at its next check and is freed by a later Update().
+// Column data is read from worker threads: it must stay valid and unmodified while IsRunning() or HasCanceledJobs().
+struct IMGUI_API ImGuiTableQuery
+{
+    int                     RowsCount;
+    ImVector<ImGuiTableQueryColumn> Columns;
+    int                     WorkersCount;           // Number of threads used by a job. 0: std::thread::hardware_concurrency().
+
+    // Request, applied by Submit()
+    ImVector<ImGuiTableDataSortKey> SortKeys;
+    ImVector<ImGuiTableQueryFilter> Filters;        // Rows need to pass all filters
+
+    // Result
+    ImVector<int>           Rows;                   // Rows passing filters, in sorted order. Valid when HasResult.
+    bool                    HasResult;
+    ImGuiTableQueryJob*     Job;
+    ImVector<ImGuiTableQueryJob*> CanceledJobs;     // Canceled by Submit(), still running
+    ImGuiTableQueryWorkers* Workers;                // Threads running each phase of a job along with the job thread
+
+    ImGuiTableQuery();
+    ~ImGuiTableQuery();
+    void                    AddColumn(ImGuiDataType data_type, const void* data) { ImGuiTableQueryColumn column; column.DataType = data_type; column.Data = data; Columns.push_back(column); }
+    void                    AddFilterSubstring(int column_n, const char* text);
+    void                    AddFilterRange(int column_n, double min, double max);
+    void                    ClearFilters()          { Filters.resize(0); }
+    void                    Submit();               // Start running the request, canceling the one in progress.
+    bool                    Update();               // Take rows of a completed job and free finished canceled jobs. Return true when Rows changed.
+    bool                    IsRunning() const       { return Job != NULL; }
+    bool                    HasCanceledJobs() const { return CanceledJobs.Size > 0; }
+};
+
+// Rows of a table submitted with DataTable(), which pulls the cells of visible rows only through GetCellText().
+// The sorted order of rows is stored as a permutation (SortedRows). When sort specs or rows change, it is:
+// - reversed when the direction of every sort key is flipped (ties are ordered by row index, following the direction of the first key),
+// - merged with the sorted rows appended since (when RowsCount increased and sort specs didn't change),
+// - otherwise rebuilt. Large data sets are sorted on a worker thread and displayed in their previous order meanwhile.
+//   GetCellText() and GetCellSortKey() are then called from that thread, concurrently with the UI thread.
+// Call MarkDirty() after modifying or removing rows.
+struct IMGUI_API ImGuiTableDataSource
+{
+    int                     RowsCount;
+    int                     ColumnsCount;
+    const char* const*      ColumnNames;            // Optional: ColumnsCount column names.
+    const char*             (*GetCellText)(void* user_data, int row_n, int column_n, char* buf, int buf_size); // Return cell text, which may be written to 'buf'.
+    double                  (*GetCellSortKey)(void* user_data, int row_n, int column_n);                       // Optional: numeric sort key. When NULL, rows are sorted by comparing cell text.
+    void*                   UserData;
+    ImGuiTableQuery*        Query;                  // Optional: sort and filter rows with a query instead. Table sort specs are forwarded to it.
+
+    // [Internal]
+    ImVector<int>           SortedRows;             // Display row -> source row, covering source rows [0, SortedRows.Size). Following rows are displayed unsorted.
+    ImVector<ImGuiTableDataSortKey> SortedKeys;     // Sort keys SortedRows was sorted with.
+    ImVector<ImGuiTableDataSortKey> WantedKeys;     // Sort keys from the table sort specs.
+    ImVector<float>         ColumnsContentWidth;    // Widest cell text of each column, sampled then updated from displayed rows. Used for auto-fit instead of the visible rows only.
+    ImGuiTableDataSortJob*  SortJob;                // Sort in progress.
+    bool                    IsDirty;
+
+    ImGuiTableDataSource()  { memset(this, 0, sizeof(*this)); }
+    ~ImGuiTableDataSource();
+    void                    MarkDirty()             { IsDirty = true; }
+    bool                    IsSorting() const       { return SortJob != NULL; }
+    int                     GetDisplayRowsCount() const { return (Query && Query->HasResult) ? Query->Rows.Size : RowsCount; }
+    int                     GetSourceRow(int display_row_n) const
+    {
+        if (Query && Query->HasResult)
+            return Query->Rows[display_row_n];
+        return (display_row_n < SortedRows.Size) ? SortedRows[display_row_n] : display_row_n;
+    }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGui internal API
 // No guarantee of forward compatibility here!
@@ -3291,6 +3799,9 @@ namespace ImGui
     inline ImDrawList*      GetForegroundDrawList(ImGuiWindow* window) { return GetForegroundDrawList(window->Viewport); }
     IMGUI_API void          AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
 
+    // Memory
+    IMGUI_API void*         MemAllocFrame(size_t size);     // Transient allocation, valid until next NewFrame(). Don't call MemFree() on it. Uses ImTieredAllocator frame arena when installed.
+
     // Init
     IMGUI_API void          Initialize();
     IMGUI_API void          Shutdown();    // Since 1.60 this is a _private_ function. You can call DestroyContext() to destroy the context created by CreateContext().
@@ -3325,6 +3836,8 @@ namespace ImGui
     IMGUI_API void                  AddSettingsHandler(const ImGuiSettingsHandler* handler);
     IMGUI_API void                  RemoveSettingsHandler(const char* type_name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API bool                  SaveIniSettingsToDiskThreaded(const char* ini_filename);   // Serialize now and write on a worker thread (synchronously with IMGUI_DISABLE_WORKER_THREADS). Return false (doing nothing) if the previous write is still in progress.
+    IMGUI_API void                  WaitIniSettingsSaved();                                     // Block until a write started by SaveIniSettingsToDiskThreaded() is finished
 
     // Settings - Windows
     IMGUI_API ImGuiWindowSettings*  CreateNewWindowSettings(const char* name);
@@ -3420,6 +3933,10 @@ namespace ImGui
     IMGUI_API bool          BeginComboPopup(ImGuiID popup_id, const ImRect& bb, ImGuiComboFlags flags);
     IMGUI_API bool          BeginComboPreview();
     IMGUI_API void          EndComboPreview();
+    IMGUI_API bool          ComboEx(const char* label, int* current_item, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count, const ImGuiTypingSelectIndex* index, int popup_max_height_in_items = -1); // Combo() with typing-select backed by 'index' (may be NULL)
+
+    // List Boxes
+    IMGUI_API bool          ListBoxEx(const char* label, int* current_item, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count, const ImGuiTypingSelectIndex* index, int height_in_items = -1); // ListBox() with typing-select backed by 'index' (may be NULL)
 
     // Gamepad/Keyboard Navigation
     IMGUI_API void          NavInitWindow(ImGuiWindow* window, bool force_reinit);
@@ -3610,6 +4127,9 @@ namespace ImGui
     IMGUI_API int           TypingSelectFindMatch(ImGuiTypingSelectRequest* req, int items_count, const char* (*get_item_name_func)(void*, int), void* user_data, int nav_item_idx);
     IMGUI_API int           TypingSelectFindNextSingleCharMatch(ImGuiTypingSelectRequest* req, int items_count, const char* (*get_item_name_func)(void*, int), void* user_data, int nav_item_idx);
     IMGUI_API int           TypingSelectFindBestLeadingMatch(ImGuiTypingSelectRequest* req, int items_count, const char* (*get_item_name_func)(void*, int), void* user_data);
+    IMGUI_API int           TypingSelectFindMatch(ImGuiTypingSelectRequest* req, const ImGuiTypingSelectIndex* index, const char* (*get_item_name_func)(void*, int), void* user_data, int nav_item_idx);
+    IMGUI_API int           TypingSelectFindNextSingleCharMatch(ImGuiTypingSelectRequest* req, const ImGuiTypingSelectIndex* index, const char* (*get_item_name_func)(void*, int), void* user_data, int nav_item_idx);
+    IMGUI_API int           TypingSelectFindBestLeadingMatch(ImGuiTypingSelectRequest* req, const ImGuiTypingSelectIndex* index, const char* (*get_item_name_func)(void*, int), void* user_data);
 
     // Internal Columns API (this is not exposed because we will encourage transitioning to the Tables API)
     IMGUI_API void          SetWindowClipRectBeforeSetChannel(ImGuiWindow* window, const ImRect& clip_rect);
@@ -3634,6 +4154,7 @@ namespace ImGui
     IMGUI_API void          TablePushBackgroundChannel();
     IMGUI_API void          TablePopBackgroundChannel();
     IMGUI_API void          TableAngledHeadersRowEx(ImGuiID row_id, float angle, float max_label_width, const ImGuiTableHeaderData* data, int data_count);
+    IMGUI_API bool          DataTable(const char* str_id, ImGuiTableDataSource* source, ImGuiTableFlags flags = 0, const ImVec2& outer_size = ImVec2(0, 0), float inner_width = 0.0f); // Full table (headers + visible rows) pulled from 'source'.
 
     // Tables: Internals
     inline    ImGuiTable*   GetCurrentTable() { ImGuiContext& g = *GImGui; return g.CurrentTable; }
@@ -3653,6 +4174,7 @@ namespace ImGui
     inline ImGuiID                  TableGetInstanceID(ImGuiTable* table, int instance_no)   { return TableGetInstanceData(table, instance_no)->TableInstanceID; }
     IMGUI_API void          TableSortSpecsSanitize(ImGuiTable* table);
     IMGUI_API void          TableSortSpecsBuild(ImGuiTable* table);
+    IMGUI_API void          TableDataSourceUpdateSort(ImGuiTableDataSource* source);
     IMGUI_API ImGuiSortDirection TableGetColumnNextSortDirection(ImGuiTableColumn* column);
     IMGUI_API void          TableFixColumnSortDirection(ImGuiTable* table, ImGuiTableColumn* column);
     IMGUI_API float         TableGetColumnWidthAuto(ImGuiTable* table, ImGuiTableColumn* column);
@@ -3717,6 +4239,12 @@ namespace ImGui
     IMGUI_API const char*   FindRenderedTextEnd(const char* text, const char* text_end = NULL); // Find the optional ## from which we stop displaying text.
     IMGUI_API void          RenderMouseCursor(ImVec2 pos, float scale, ImGuiMouseCursor mouse_cursor, ImU32 col_fill, ImU32 col_border, ImU32 col_shadow);
 
+    // Text layout cache
+    IMGUI_API ImGuiTextLayoutCacheEntry* TextLayoutCacheGet(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end); // Return NULL if text is not cached. Size is computed on insertion.
+    IMGUI_API void          TextLayoutCacheBuildLines(ImGuiTextLayoutCacheEntry* entry, ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end);
+    IMGUI_API void          TextLayoutCacheGarbageCollect();
+    IMGUI_API void          TextLayoutCacheCompact();
+
     // Render helpers (those functions don't access any ImGui state!)
     IMGUI_API void          RenderArrow(ImDrawList* draw_list, ImVec2 pos, ImU32 col, ImGuiDir dir, float scale = 1.0f);
     IMGUI_API void          RenderBullet(ImDrawList* draw_list, ImVec2 pos, ImU32 col);
@@ -3736,6 +4264,7 @@ namespace ImGui
     IMGUI_API void          SeparatorTextEx(ImGuiID id, const char* label, const char* label_end, float extra_width);
     IMGUI_API bool          CheckboxFlags(const char* label, ImS64* flags, ImS64 flags_value);
     IMGUI_API bool          CheckboxFlags(const char* label, ImU64* flags, ImU64 flags_value);
+    IMGUI_API bool          VirtualTree(const char* str_id, ImGuiVirtualTree* tree, const ImVec2& size = ImVec2(0, 0)); // Child window with visible rows of 'tree'. Return true when selection changed.
 
     // Widgets: Window Decorations
     IMGUI_API bool          CloseButton(ImGuiID id, const ImVec2& pos);
@@ -3780,6 +4309,7 @@ namespace ImGui
     IMGUI_API bool          InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API void          InputTextDeactivateHook(ImGuiID id);
     IMGUI_API bool          TempInputText(const ImRect& bb, ImGuiID id, const char* label, char* buf, int buf_size, ImGuiInputTextFlags flags);
+    IMGUI_API bool          InputTextDocument(const char* label, ImGuiTextDocument* doc, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0); // Multi-line editor for very large documents. Only supports ImGuiInputTextFlags_ReadOnly and _AllowTabInput (other flags assert). No undo.
     IMGUI_API bool          TempInputScalar(const ImRect& bb, ImGuiID id, const char* label, ImGuiDataType data_type, void* p_data, const char* format, const void* p_clamp_min = NULL, const void* p_clamp_max = NULL);
     inline bool             TempInputIsActive(ImGuiID id)       { ImGuiContext& g = *GImGui; return (g.ActiveId == id && g.TempInputId == id); }
     inline ImGuiInputTextState* GetInputTextState(ImGuiID id)   { ImGuiContext& g = *GImGui; return (id != 0 && g.InputTextState.ID == id) ? &g.InputTextState : NULL; } // Get input text state if active
@@ -3792,6 +4322,8 @@ namespace ImGui
 
     // Plot
     IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotSummaryEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotSummary* summary, int values_first, int values_count, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg); // values_count < 0: up to the last sample
+    IMGUI_API int           PlotStreamingEx(ImGuiPlotType plot_type, const char* label, ImGuiStreamingPlot* plot, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -3807,6 +4339,8 @@ namespace ImGui
     IMGUI_API void          DebugLog(const char* fmt, ...) IM_FMTARGS(1);
     IMGUI_API void          DebugLogV(const char* fmt, va_list args) IM_FMTLIST(1);
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
+    IMGUI_API void          DebugAllocPushTag(const char* tag);                 // Tag heap allocations reported in steady state (io.ConfigDebugSteadyStateWarmupFrames). 'tag' needs to persist until popped.
+    IMGUI_API void          DebugAllocPopTag();
 
     // Debug Tools
     IMGUI_API void          ErrorCheckEndFrameRecover(ImGuiErrorLogCallback log_callback, void* user_data = NULL);
@@ -3836,6 +4370,7 @@ namespace ImGui
     IMGUI_API void          DebugNodeTableSettings(ImGuiTableSettings* settings);
     IMGUI_API void          DebugNodeInputTextState(ImGuiInputTextState* state);
     IMGUI_API void          DebugNodeTypingSelectState(ImGuiTypingSelectState* state);
+    IMGUI_API void          DebugNodeTextLayoutCache(ImGuiTextLayoutCache* cache);
     IMGUI_API void          DebugNodeWindow(ImGuiWindow* window, const char* label);
     IMGUI_API void          DebugNodeWindowSettings(ImGuiWindowSettings* settings);
     IMGUI_API void          DebugNodeWindowsList(ImVector<ImGuiWindow*>* windows, const char* label);
@@ -14,6 +14,8 @@ Index of this file:
 // [SECTION] Tables: Columns width management
 // [SECTION] Tables: Drawing
 // [SECTION] Tables: Sorting
+// [SECTION] Tables: Data source
+// [SECTION] Tables: Query engine
 // [SECTION] Tables: Headers
 // [SECTION] Tables: Context Menu
 // [SECTION] Tables: Settings (.ini data)
@@ -201,6 +203,12 @@ Index of this file:
 
 // System includes
 #include <stdint.h>     // intptr_t
+#include <atomic>       // std::atomic (DataTable() sorting, ImGuiTableQuery)
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+#include <thread>       // std::thread (DataTable() sorting, ImGuiTableQuery)
+#include <mutex>        // std::mutex, std::condition_variable (ImGuiTableQuery workers)
+#include <condition_variable>
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -1398,9 +1406,14 @@ void    ImGui::EndTable()
     // Flatten channels and merge draw calls
     ImDrawListSplitter* splitter = table->DrawSplitter;
     splitter->SetCurrentChannel(inner_window->DrawList, 0);
+    const int draw_cmd_count_host = inner_window->DrawList->CmdBuffer.Size;
+    table->DrawCmdCountBeforeMerge = 0;
+    for (int channel_n = 1; channel_n < splitter->_Count; channel_n++)
+        table->DrawCmdCountBeforeMerge += splitter->_Channels[channel_n]._CmdBuffer.Size;
     if ((table->Flags & ImGuiTableFlags_NoClip) == 0)
         TableMergeDrawChannels(table);
     splitter->Merge(inner_window->DrawList);
+    table->DrawCmdCountAfterMerge = ImMax(inner_window->DrawList->CmdBuffer.Size - draw_cmd_count_host, 0);
 
     // Update ColumnsAutoFitWidth to get us ahead for host using our size to auto-resize without waiting for next BeginTable()
     float auto_fit_width_for_fixed = 0.0f;
@@ -2143,7 +2156,21 @@ void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
     {
         // FIXME-TABLE: Could avoid this if draw channel is dummy channel?
         SetWindowClipRectBeforeSetChannel(window, column->ClipRect);
-        table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
+        if (table->IsDirectDraw && column->DrawChannelCurrent != table->DummyDrawChannel)
+        {
+            // Direct draw: items and PushClipRect() calls are still clipped with the column ClipRect (window->ClipRect and top of
+            // the clip rect stack), but draw commands use the clip rect shared by all columns. When the previous cell used the same
+            // channel, its last draw command may use another clip rect (e.g. after a PopClipRect()): start a new one.
+            window->DrawList->_CmdHeader.ClipRect = table->DirectDrawClipRect.ToVec4();
+            if (table->DrawSplitter->_Current == column->DrawChannelCurrent)
+                window->DrawList->_OnChangedClipRect();
+            table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
+            table->DirectDrawCellIdxOffset = (unsigned int)window->DrawList->IdxBuffer.Size;
+        }
+        else
+        {
+            table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
+        }
     }
 
     // Logging
@@ -2154,6 +2181,33 @@ void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
     }
 }
 
+// Direct draw: contents of the current cell stray off its column, so they can't use the clip rect shared by all columns.
+// Split the draw command where the cell started, and give the column ClipRect to the draw commands of the cell.
+// The next cell starts a new draw command using the shared clip rect. TableMergeDrawChannels() will revert to regular channels.
+static void TableDirectDrawClipCell(ImGuiTable* table, ImGuiTableColumn* column, ImDrawList* draw_list)
+{
+    const ImVec4 direct_clip_rect = table->DirectDrawClipRect.ToVec4();
+    const unsigned int idx_offset = table->DirectDrawCellIdxOffset;
+    ImVector<ImDrawCmd>& cmds = draw_list->CmdBuffer;
+    int cmd_n = cmds.Size - 1;
+    while (cmd_n > 0 && cmds.Data[cmd_n].IdxOffset > idx_offset)
+        cmd_n--;
+    ImDrawCmd* cmd = &cmds.Data[cmd_n];
+    if (cmd->IdxOffset < idx_offset && cmd->IdxOffset + cmd->ElemCount > idx_offset)
+    {
+        ImDrawCmd cell_cmd = *cmd;
+        cell_cmd.IdxOffset = idx_offset;
+        cell_cmd.ElemCount = cmd->IdxOffset + cmd->ElemCount - idx_offset;
+        cmd->ElemCount = idx_offset - cmd->IdxOffset;
+        cmds.insert(cmds.Data + cmd_n + 1, cell_cmd);
+    }
+    if (cmds.Data[cmd_n].IdxOffset < idx_offset)
+        cmd_n++;
+    for (; cmd_n < cmds.Size; cmd_n++)
+        if (cmds.Data[cmd_n].UserCallback == NULL && memcmp(&cmds.Data[cmd_n].ClipRect, &direct_clip_rect, sizeof(ImVec4)) == 0)
+            cmds.Data[cmd_n].ClipRect = column->ClipRect.ToVec4();
+}
+
 // [Internal] Called by TableNextRow()/TableSetColumnIndex()/TableNextColumn()
 void ImGui::TableEndCell(ImGuiTable* table)
 {
@@ -2170,6 +2224,12 @@ void ImGui::TableEndCell(ImGuiTable* table)
     else
         p_max_pos_x = table->IsUnfrozenRows ? &column->ContentMaxXUnfrozen : &column->ContentMaxXFrozen;
     *p_max_pos_x = ImMax(*p_max_pos_x, window->DC.CursorMaxPos.x);
+    if (table->IsDirectDraw && column->DrawChannelCurrent != table->DummyDrawChannel && !(column->Flags & ImGuiTableColumnFlags_NoClip))
+    {
+        const float cell_max_x = (table->RowFlags & ImGuiTableRowFlags_Headers) ? *p_max_pos_x : window->DC.CursorMaxPos.x;
+        if (cell_max_x > column->ClipRect.Max.x)
+            TableDirectDrawClipCell(table, column, window->DrawList);
+    }
     if (column->IsEnabled)
         table->RowPosY2 = ImMax(table->RowPosY2, window->DC.CursorMaxPos.y + table->RowCellPaddingY);
     column->ItemWidth = window->DC.ItemWidth;
@@ -2410,6 +2470,8 @@ void ImGui::TablePopBackgroundChannel()
 
     // Optimization: avoid PopClipRect() + SetCurrentChannel()
     SetWindowClipRectBeforeSetChannel(window, table->HostBackupInnerClipRect);
+    if (table->IsDirectDraw && column->DrawChannelCurrent != table->DummyDrawChannel)
+        window->DrawList->_CmdHeader.ClipRect = table->DirectDrawClipRect.ToVec4(); // Same as TableBeginCell()
     table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
 }
 
@@ -2428,11 +2490,44 @@ void ImGui::TablePopBackgroundChannel()
 // - Clip                         --> 2+D+N channels
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
+// - DirectDraw                   --> 2+D+1 channels: same as NoClip, but each column still clips items with its own ClipRect
 // Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Direct draw is used when nothing is frozen and all visible columns contents fit in their ClipRect during the previous
+// frame: TableMergeDrawChannels() would merge all columns in a single group, so we output draw commands directly in their
+// final order with the merged clip rect instead of splitting and reordering 1 channel per column. Columns and rows then
+// share a single ImDrawCmd, which is much cheaper for tables with many columns. A cell whose contents stray off its column
+// gets draw commands using the column ClipRect (see TableDirectDrawClipCell()), and TableMergeDrawChannels() reverts to
+// regular channels on the next frame.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
+    table->IsDirectDraw = false;
+    if ((table->Flags & ImGuiTableFlags_NoClip) == 0 && table->FreezeRowsCount == 0 && table->FreezeColumnsCount == 0 && table->ResizedColumn == -1 && !table->IsInitializing)
+    {
+        ImRect direct_clip_rect(+FLT_MAX, +FLT_MAX, -FLT_MAX, -FLT_MAX);
+        table->IsDirectDraw = true;
+        for (int column_n = 0; column_n < table->ColumnsCount && table->IsDirectDraw; column_n++)
+        {
+            ImGuiTableColumn* column = &table->Columns[column_n];
+            if (!column->IsVisibleX || !column->IsVisibleY)
+                continue;
+            if (!column->IsDrawMergedPrev)
+                table->IsDirectDraw = false;
+            direct_clip_rect.Add(column->ClipRect);
+        }
+        if (direct_clip_rect.Min.x > direct_clip_rect.Max.x)
+            table->IsDirectDraw = false;
+
+        // Extend clip limits to match those of host, like TableMergeDrawChannels() does for a single merge group.
+        const ImRect host_rect = table->HostClipRect;
+        direct_clip_rect.Min = ImMin(direct_clip_rect.Min, host_rect.Min);
+        direct_clip_rect.Max.x = ImMax(direct_clip_rect.Max.x, host_rect.Max.x);
+        if ((table->Flags & ImGuiTableFlags_NoHostExtendY) == 0)
+            direct_clip_rect.Max.y = ImMax(direct_clip_rect.Max.y, host_rect.Max.y);
+        table->DirectDrawClipRect = direct_clip_rect;
+    }
+
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = ((table->Flags & ImGuiTableFlags_NoClip) || table->IsDirectDraw) ? 1 : table->ColumnsEnabledCount;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
     const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
@@ -2449,7 +2544,7 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
         {
             column->DrawChannelFrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current);
             column->DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current + (table->FreezeRowsCount > 0 ? channels_for_row + 1 : 0));
-            if (!(table->Flags & ImGuiTableFlags_NoClip))
+            if (!(table->Flags & ImGuiTableFlags_NoClip) && !table->IsDirectDraw)
                 draw_channel_current++;
         }
         else
@@ -2505,6 +2600,20 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     const bool has_freeze_h = (table->FreezeColumnsCount > 0);
     IM_ASSERT(splitter->_Current == 0);
 
+    // Direct draw: all columns already output into a single channel in their final order, nothing to reorder.
+    // Verify that contents still fit in their column, otherwise revert to regular channels on the next frame.
+    if (table->IsDirectDraw)
+    {
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        {
+            ImGuiTableColumn* column = &table->Columns[column_n];
+            const float content_max_x = ImMax(column->ContentMaxXUnfrozen, column->ContentMaxXHeadersUsed);
+            column->IsDrawMergedPrev = IM_BITARRAY_TESTBIT(table->VisibleMaskByIndex, column_n) && ((column->Flags & ImGuiTableColumnFlags_NoClip) || content_max_x <= column->ClipRect.Max.x);
+            column->DrawChannelCurrent = (ImGuiTableDrawChannelIdx)-1;
+        }
+        return;
+    }
+
     // Track which groups we are going to attempt to merge, and which channels goes into each group.
     struct MergeGroup
     {
@@ -2527,11 +2636,13 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     // 1. Scan channels and take note of those which can be merged
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
     {
+        ImGuiTableColumn* column = &table->Columns[column_n];
+        column->IsDrawMergedPrev = false;
         if (!IM_BITARRAY_TESTBIT(table->VisibleMaskByIndex, column_n))
             continue;
-        ImGuiTableColumn* column = &table->Columns[column_n];
 
         const int merge_group_sub_count = has_freeze_v ? 2 : 1;
+        int merged_sub_count = 0;
         for (int merge_group_sub_n = 0; merge_group_sub_n < merge_group_sub_count; merge_group_sub_n++)
         {
             const int channel_no = (merge_group_sub_n == 0) ? column->DrawChannelFrozen : column->DrawChannelUnfrozen;
@@ -2567,7 +2678,9 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
             merge_group->ChannelsCount++;
             merge_group->ClipRect.Add(src_channel->_CmdBuffer[0].ClipRect);
             merge_group_mask |= (1 << merge_group_n);
+            merged_sub_count++;
         }
+        column->IsDrawMergedPrev = (merged_sub_count == merge_group_sub_count);
 
         // Invalidate current draw channel
         // (we don't clear DrawChannelFrozen/DrawChannelUnfrozen solely to facilitate debugging/later inspection of data)
@@ -2961,6 +3074,1142 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Data source
+//-------------------------------------------------------------------------
+// - ImGuiTableDataSortJob [Internal]
+// - TableDataSortEntries() [Internal]
+// - TableDataSourceSortJob() [Internal]
+// - TableDataSourceUpdateSort() [Internal]
+// - DataTable()
+//-------------------------------------------------------------------------
+
+// Sorting a data source with more rows than this happens on a worker thread
+#ifndef IMGUI_TABLE_DATA_SORT_ASYNC_MIN_ROWS
+#define IMGUI_TABLE_DATA_SORT_ASYNC_MIN_ROWS        (1 << 16)
+#endif
+// Number of rows sampled to initialize ImGuiTableDataSource::ColumnsContentWidth[]
+#define IMGUI_TABLE_DATA_WIDTH_SAMPLE_ROWS          256
+
+struct ImGuiTableDataSortEntry
+{
+    double                          Key;            // Value of the first sort key, when sorting by numeric keys
+    int                             Row;
+};
+
+struct ImGuiTableDataSortColumn
+{
+    double*                         Values;         // Numeric keys (GetCellSortKey)
+    char*                           Text;           // Zero-terminated cells text, when sorting by text
+    int*                            TextOffsets;
+    bool                            Descending;
+};
+
+struct ImGuiTableDataSortContext
+{
+    const ImGuiTableDataSortColumn* Columns;
+    int                             ColumnsCount;
+    int                             TieOrder;       // Result of comparing two equal rows where a.Row < b.Row: follows the direction of the first key
+};
+
+struct ImGuiTableDataSortJob
+{
+    ImGuiTableDataSource*           Source;
+    ImVector<ImGuiTableDataSortKey> Keys;
+    int                             RowsCount;
+    int                             MergeFrom;      // >= 0: Rows[0, MergeFrom) are already sorted, only sort following rows and merge them. -1: sort all rows.
+    ImVector<int>                   Rows;           // Sized by the UI thread, written by the job
+    ImGuiMemAllocFunc               AllocFunc;      // The job doesn't use ImGui::MemAlloc(), which updates context stats and isn't safe to call from a worker thread
+    ImGuiMemFreeFunc                FreeFunc;
+    void*                           AllocUserData;
+    std::atomic<bool>               Done;
+    std::atomic<bool>               Cancel;
+    bool                            Completed;      // Done and not canceled
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    std::thread                     Thread;
+#endif
+
+    ImGuiTableDataSortJob() : Done(false), Cancel(false) { Source = NULL; RowsCount = 0; MergeFrom = -1; AllocFunc = NULL; FreeFunc = NULL; AllocUserData = NULL; Completed = false; }
+};
+
+static void TableDataSourceEndSortJob(ImGuiTableDataSource* source)
+{
+    ImGuiTableDataSortJob* job = source->SortJob;
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    if (job->Thread.joinable())
+        job->Thread.join();
+#endif
+    IM_DELETE(job);
+    source->SortJob = NULL;
+}
+
+ImGuiTableDataSource::~ImGuiTableDataSource()
+{
+    if (SortJob != NULL)
+    {
+        SortJob->Cancel.store(true);
+        TableDataSourceEndSortJob(this);
+    }
+}
+
+static inline int TableDataSortCompare(const ImGuiTableDataSortContext* ctx, const ImGuiTableDataSortEntry& a, const ImGuiTableDataSortEntry& b)
+{
+    for (int n = 0; n < ctx->ColumnsCount; n++)
+    {
+        const ImGuiTableDataSortColumn* column = &ctx->Columns[n];
+        int delta;
+        if (column->Values)
+        {
+            const double value_a = (n == 0) ? a.Key : column->Values[a.Row];
+            const double value_b = (n == 0) ? b.Key : column->Values[b.Row];
+            delta = (value_a < value_b) ? -1 : (value_a > value_b) ? +1 : 0;
+        }
+        else
+        {
+            delta = strcmp(column->Text + column->TextOffsets[a.Row], column->Text + column->TextOffsets[b.Row]);
+        }
+        if (delta != 0)
+            return column->Descending ? -delta : delta;
+    }
+    return (a.Row < b.Row) ? ctx->TieOrder : -ctx->TieOrder;
+}
+
+static void TableDataSortMerge(const ImGuiTableDataSortContext* ctx, const ImGuiTableDataSortEntry* a, int a_count, const ImGuiTableDataSortEntry* b, int b_count, ImGuiTableDataSortEntry* out)
+{
+    int a_n = 0, b_n = 0;
+    while (a_n < a_count && b_n < b_count)
+        *out++ = (TableDataSortCompare(ctx, b[b_n], a[a_n]) < 0) ? b[b_n++] : a[a_n++];
+    while (a_n < a_count)
+        *out++ = a[a_n++];
+    while (b_n < b_count)
+        *out++ = b[b_n++];
+}
+
+// Bottom-up merge sort, starting from insertion-sorted runs. Check for cancellation between passes. Return false if canceled.
+static bool TableDataSortEntries(const ImGuiTableDataSortContext* ctx, ImGuiTableDataSortEntry* entries, ImGuiTableDataSortEntry* scratch, int count, const std::atomic<bool>* cancel)
+{
+    const int RUN_SIZE = 32;
+    for (int run_start = 0; run_start < count; run_start += RUN_SIZE)
+    {
+        const int run_end = ImMin(run_start + RUN_SIZE, count);
+        for (int n = run_start + 1; n < run_end; n++)
+        {
+            ImGuiTableDataSortEntry entry = entries[n];
+            int dst_n = n;
+            for (; dst_n > run_start && TableDataSortCompare(ctx, entry, entries[dst_n - 1]) < 0; dst_n--)
+                entries[dst_n] = entries[dst_n - 1];
+            entries[dst_n] = entry;
+        }
+    }
+
+    ImGuiTableDataSortEntry* src = entries;
+    ImGuiTableDataSortEntry* dst = scratch;
+    for (int width = RUN_SIZE; width < count; width *= 2)
+    {
+        if (cancel->load(std::memory_order_relaxed))
+            return false;
+        for (int lo = 0; lo < count; lo += width * 2)
+        {
+            const int a_count = ImMin(width, count - lo);
+            const int b_count = ImMin(width, count - lo - a_count);
+            TableDataSortMerge(ctx, src + lo, a_count, src + lo + a_count, b_count, dst + lo);
+        }
+        ImSwap(src, dst);
+    }
+    if (src != entries)
+        memcpy(entries, src, (size_t)count * sizeof(ImGuiTableDataSortEntry));
+    return true;
+}
+
+// Runs on a worker thread for large data sets: only access the job and the source callbacks from here.
+static void TableDataSourceSortJob(ImGuiTableDataSortJob* job)
+{
+    const ImGuiTableDataSource* source = job->Source;
+    const int rows_count = job->RowsCount;
+    const int sort_first = ImMax(job->MergeFrom, 0);
+    const int sort_count = rows_count - sort_first;
+    const int keys_count = job->Keys.Size;
+    void* alloc_user_data = job->AllocUserData;
+    bool ok = true;
+
+    // Extract sort keys of all rows (merging needs keys of already sorted rows as well)
+    char buf[256];
+    ImGuiTableDataSortColumn* columns = (ImGuiTableDataSortColumn*)job->AllocFunc(sizeof(ImGuiTableDataSortColumn) * keys_count, alloc_user_data);
+    memset(columns, 0, sizeof(ImGuiTableDataSortColumn) * keys_count);
+    for (int key_n = 0; key_n < keys_count && ok; key_n++)
+    {
+        ImGuiTableDataSortColumn* column = &columns[key_n];
+        const int column_n = job->Keys[key_n].ColumnIndex;
+        column->Descending = (job->Keys[key_n].SortDirection == ImGuiSortDirection_Descending);
+        if (source->GetCellSortKey)
+        {
+            column->Values = (double*)job->AllocFunc(sizeof(double) * rows_count, alloc_user_data);
+            for (int row_n = 0; row_n < rows_count && ok; row_n++)
+            {
+                column->Values[row_n] = source->GetCellSortKey(source->UserData, row_n, column_n);
+                if ((row_n & 0xFFFF) == 0xFFFF && job->Cancel.load(std::memory_order_relaxed))
+                    ok = false;
+            }
+            continue;
+        }
+
+        // Two passes so the text of all rows can be stored in a single allocation
+        size_t text_size = 0;
+        for (int row_n = 0; row_n < rows_count; row_n++)
+            text_size += strlen(source->GetCellText(source->UserData, row_n, column_n, buf, IM_ARRAYSIZE(buf))) + 1;
+        IM_ASSERT(text_size <= INT_MAX);
+        column->Text = (char*)job->AllocFunc(text_size, alloc_user_data);
+        column->TextOffsets = (int*)job->AllocFunc(sizeof(int) * rows_count, alloc_user_data);
+        size_t text_offset = 0;
+        for (int row_n = 0; row_n < rows_count && ok; row_n++)
+        {
+            const char* text = source->GetCellText(source->UserData, row_n, column_n, buf, IM_ARRAYSIZE(buf));
+            const size_t text_len = ImMin(strlen(text), text_size - text_offset - (rows_count - row_n)); // Text of a row could have grown since the first pass
+            memcpy(column->Text + text_offset, text, text_len);
+            column->Text[text_offset + text_len] = 0;
+            column->TextOffsets[row_n] = (int)text_offset;
+            text_offset += text_len + 1;
+            if ((row_n & 0xFFFF) == 0xFFFF && job->Cancel.load(std::memory_order_relaxed))
+                ok = false;
+        }
+    }
+
+    ImGuiTableDataSortContext ctx;
+    ctx.Columns = columns;
+    ctx.ColumnsCount = keys_count;
+    ctx.TieOrder = (keys_count > 0 && columns[0].Descending) ? +1 : -1;
+
+    // Sort new rows
+    ImGuiTableDataSortEntry* entries = (ImGuiTableDataSortEntry*)job->AllocFunc(sizeof(ImGuiTableDataSortEntry) * ImMax(sort_count, 1), alloc_user_data);
+    ImGuiTableDataSortEntry* scratch = (ImGuiTableDataSortEntry*)job->AllocFunc(sizeof(ImGuiTableDataSortEntry) * ImMax(sort_count, 1), alloc_user_data);
+    if (ok)
+    {
+        const double* keys_0 = (keys_count > 0) ? columns[0].Values : NULL;
+        for (int n = 0; n < sort_count; n++)
+        {
+            entries[n].Row = sort_first + n;
+            entries[n].Key = keys_0 ? keys_0[sort_first + n] : 0.0;
+        }
+        ok = TableDataSortEntries(&ctx, entries, scratch, sort_count, &job->Cancel);
+    }
+
+    // Merge them with already sorted rows, or output them
+    if (ok && job->MergeFrom >= 0)
+    {
+        const double* keys_0 = (keys_count > 0) ? columns[0].Values : NULL;
+        int* merged = (int*)job->AllocFunc(sizeof(int) * rows_count, alloc_user_data);
+        int old_n = 0, new_n = 0, out_n = 0;
+        while (old_n < job->MergeFrom && new_n < sort_count)
+        {
+            ImGuiTableDataSortEntry old_entry;
+            old_entry.Row = job->Rows[old_n];
+            old_entry.Key = keys_0 ? keys_0[old_entry.Row] : 0.0;
+            merged[out_n++] = (TableDataSortCompare(&ctx, entries[new_n], old_entry) < 0) ? entries[new_n++].Row : job->Rows[old_n++];
+        }
+        while (old_n < job->MergeFrom)
+            merged[out_n++] = job->Rows[old_n++];
+        while (new_n < sort_count)
+            merged[out_n++] = entries[new_n++].Row;
+        memcpy(job->Rows.Data, merged, sizeof(int) * rows_count);
+        job->FreeFunc(merged, alloc_user_data);
+    }
+    else if (ok)
+    {
+        for (int n = 0; n < sort_count; n++)
+            job->Rows[n] = entries[n].Row;
+    }
+
+    job->FreeFunc(scratch, alloc_user_data);
+    job->FreeFunc(entries, alloc_user_data);
+    for (int key_n = 0; key_n < keys_count; key_n++)
+    {
+        job->FreeFunc(columns[key_n].Values, alloc_user_data);
+        job->FreeFunc(columns[key_n].Text, alloc_user_data);
+        job->FreeFunc(columns[key_n].TextOffsets, alloc_user_data);
+    }
+    job->FreeFunc(columns, alloc_user_data);
+    job->Completed = ok;
+    job->Done.store(true, std::memory_order_release);
+}
+
+static bool TableDataSortKeysEqual(const ImVector<ImGuiTableDataSortKey>& a, const ImVector<ImGuiTableDataSortKey>& b)
+{
+    if (a.Size != b.Size)
+        return false;
+    for (int n = 0; n < a.Size; n++)
+        if (a[n].ColumnIndex != b[n].ColumnIndex || a[n].SortDirection != b[n].SortDirection)
+            return false;
+    return true;
+}
+
+// Same columns, every direction flipped
+static bool TableDataSortKeysFlipped(const ImVector<ImGuiTableDataSortKey>& a, const ImVector<ImGuiTableDataSortKey>& b)
+{
+    if (a.Size != b.Size || a.Size == 0)
+        return false;
+    for (int n = 0; n < a.Size; n++)
+        if (a[n].ColumnIndex != b[n].ColumnIndex || a[n].SortDirection == b[n].SortDirection)
+            return false;
+    return true;
+}
+
+// Bring source->SortedRows up to date with source->WantedKeys and source->RowsCount. Called by DataTable().
+void ImGui::TableDataSourceUpdateSort(ImGuiTableDataSource* source)
+{
+    // Collect a finished sort. Its result is dropped if sort keys changed or rows were modified/removed since it started.
+    // Once cancelled, a job stays unwanted even if the change is undone before it finishes.
+    if (ImGuiTableDataSortJob* job = source->SortJob)
+    {
+        if (source->IsDirty || job->RowsCount > source->RowsCount || !TableDataSortKeysEqual(job->Keys, source->WantedKeys))
+            job->Cancel.store(true);
+        if (job->Done.load(std::memory_order_acquire))
+        {
+            if (!job->Cancel.load() && job->Completed)
+            {
+                source->SortedRows.swap(job->Rows);
+                source->SortedKeys = job->Keys;
+            }
+            TableDataSourceEndSortJob(source);
+        }
+    }
+
+    // Drop the displayed order as soon as it refers to modified or removed rows, including while a sort is still running:
+    // the job works on its own copy of the rows.
+    if (source->IsDirty)
+        source->ColumnsContentWidth.resize(0);
+    if (source->IsDirty || source->SortedRows.Size > source->RowsCount || source->WantedKeys.Size == 0)
+    {
+        source->SortedRows.resize(0);
+        source->SortedKeys.resize(0);
+        source->IsDirty = false;
+    }
+    if (source->SortJob != NULL || source->WantedKeys.Size == 0)
+        return;
+
+    // Up to date, or reverse order
+    const bool same_keys = TableDataSortKeysEqual(source->SortedKeys, source->WantedKeys);
+    if (same_keys && source->SortedRows.Size == source->RowsCount)
+        return;
+    if (source->SortedRows.Size == source->RowsCount && TableDataSortKeysFlipped(source->SortedKeys, source->WantedKeys))
+    {
+        for (int n = 0, n_end = source->SortedRows.Size - 1; n < n_end; n++, n_end--)
+            ImSwap(source->SortedRows.Data[n], source->SortedRows.Data[n_end]);
+        source->SortedKeys = source->WantedKeys;
+        return;
+    }
+
+    // Sort all rows, or sort appended rows and merge them
+    ImGuiTableDataSortJob* job = IM_NEW(ImGuiTableDataSortJob)();
+    job->Source = source;
+    job->Keys = source->WantedKeys;
+    job->RowsCount = source->RowsCount;
+    job->MergeFrom = (same_keys && source->SortedRows.Size > 0) ? source->SortedRows.Size : -1;
+    job->Rows.resize(source->RowsCount);
+    if (job->MergeFrom > 0)
+        memcpy(job->Rows.Data, source->SortedRows.Data, sizeof(int) * job->MergeFrom);
+    GetAllocatorFunctions(&job->AllocFunc, &job->FreeFunc, &job->AllocUserData);
+    source->SortJob = job;
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    if (job->RowsCount >= IMGUI_TABLE_DATA_SORT_ASYNC_MIN_ROWS)
+    {
+        job->Thread = std::thread(TableDataSourceSortJob, job);
+        return;
+    }
+#endif
+    TableDataSourceSortJob(job);
+    source->SortedRows.swap(job->Rows);
+    source->SortedKeys = job->Keys;
+    TableDataSourceEndSortJob(source);
+}
+
+// Submit a whole table from a data source: headers, then cells of visible rows in sorted order.
+// - Column widths used for auto-fit come from ImGuiTableDataSource::ColumnsContentWidth[] (initialized from a sample of rows,
+//   then widened by displayed rows) instead of the visible rows only, so they don't change while scrolling.
+// - Rows are displayed in their previous order while a large data set is being sorted, see ImGuiTableDataSource::IsSorting().
+// - With ImGuiTableDataSource::Query set, sort specs are submitted to the query and rows are displayed from its last published result.
+bool ImGui::DataTable(const char* str_id, ImGuiTableDataSource* source, ImGuiTableFlags flags, const ImVec2& outer_size, float inner_width)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(source != NULL && source->GetCellText != NULL);
+    IM_ASSERT(source->ColumnsCount > 0 && source->RowsCount >= 0);
+
+    if (!BeginTable(str_id, source->ColumnsCount, flags, outer_size, inner_width))
+    {
+        // Keep collecting finished sorts
+        if (source->Query)
+            source->Query->Update();
+        else
+            TableDataSourceUpdateSort(source);
+        return false;
+    }
+    ImGuiTable* table = g.CurrentTable;
+    if (flags & ImGuiTableFlags_ScrollY)
+        TableSetupScrollFreeze(0, 1);
+    for (int column_n = 0; column_n < source->ColumnsCount; column_n++)
+        TableSetupColumn(source->ColumnNames ? source->ColumnNames[column_n] : NULL);
+    TableHeadersRow();
+
+    if (ImGuiTableSortSpecs* sort_specs = TableGetSortSpecs())
+        if (sort_specs->SpecsDirty)
+        {
+            source->WantedKeys.resize(sort_specs->SpecsCount);
+            for (int n = 0; n < sort_specs->SpecsCount; n++)
+            {
+                source->WantedKeys[n].ColumnIndex = sort_specs->Specs[n].ColumnIndex;
+                source->WantedKeys[n].SortDirection = sort_specs->Specs[n].SortDirection;
+            }
+            sort_specs->SpecsDirty = false;
+            if (source->Query)
+            {
+                source->Query->SortKeys = source->WantedKeys;
+                source->Query->Submit();
+            }
+        }
+    if (source->Query)
+        source->Query->Update();
+    else
+        TableDataSourceUpdateSort(source);
+
+    char buf[256];
+    if (source->ColumnsContentWidth.Size != source->ColumnsCount)
+    {
+        const int sample_count = ImMin(source->RowsCount, IMGUI_TABLE_DATA_WIDTH_SAMPLE_ROWS);
+        source->ColumnsContentWidth.resize(source->ColumnsCount);
+        for (int column_n = 0; column_n < source->ColumnsCount; column_n++)
+        {
+            float width = 0.0f;
+            for (int sample_n = 0; sample_n < sample_count; sample_n++)
+            {
+                const int row_n = (int)((ImS64)sample_n * source->RowsCount / sample_count);
+                width = ImMax(width, CalcTextSize(source->GetCellText(source->UserData, row_n, column_n, buf, IM_ARRAYSIZE(buf))).x);
+            }
+            source->ColumnsContentWidth[column_n] = width;
+        }
+    }
+
+    ImGuiListClipper clipper;
+    clipper.Begin(source->GetDisplayRowsCount());
+    while (clipper.Step())
+        for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+        {
+            const int source_row_n = source->GetSourceRow(row_n);
+            TableNextRow();
+            for (int column_n = 0; column_n < source->ColumnsCount; column_n++)
+            {
+                if (!TableSetColumnIndex(column_n))
+                    continue;
+                TextUnformatted(source->GetCellText(source->UserData, source_row_n, column_n, buf, IM_ARRAYSIZE(buf)));
+                source->ColumnsContentWidth[column_n] = ImMax(source->ColumnsContentWidth[column_n], g.LastItemData.Rect.GetWidth());
+            }
+        }
+
+    // Report cached widths as contents width
+    for (int column_n = 0; column_n < source->ColumnsCount; column_n++)
+    {
+        ImGuiTableColumn* column = &table->Columns[column_n];
+        column->ContentMaxXUnfrozen = ImMax(column->ContentMaxXUnfrozen, column->WorkMinX + source->ColumnsContentWidth[column_n]);
+    }
+    EndTable();
+    return true;
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Query engine
+//-------------------------------------------------------------------------
+// - ImGuiTableQueryJob [Internal]
+// - ImGuiTableQueryWorkers [Internal]
+// - TableQueryFindSubstring() [Internal]
+// - TableQueryParallelFor() [Internal]
+// - TableQueryRunJob() [Internal]
+// - ImGuiTableQuery
+//-------------------------------------------------------------------------
+
+#define IMGUI_TABLE_QUERY_MAX_WORKERS               32
+
+struct ImGuiTableQueryJob
+{
+    int                             RowsCount;
+    int                             WorkersCount;
+    ImVector<ImGuiTableQueryColumn> Columns;
+    ImVector<ImGuiTableDataSortKey> SortKeys;
+    ImVector<ImGuiTableQueryFilter> Filters;
+    ImGuiTableQueryResult*          Result;         // Allocated by the UI thread, filled by the job, taken by Update() when Completed
+    ImGuiMemAllocFunc               AllocFunc;      // Same as ImGuiTableDataSortJob: don't use ImGui::MemAlloc() from worker threads
+    ImGuiMemFreeFunc                FreeFunc;
+    void*                           AllocUserData;
+    bool                            Completed;      // Result is valid (job wasn't canceled). Written before Done.
+    std::atomic<bool>               Done;
+    std::atomic<bool>               Cancel;
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    std::thread                     Thread;
+    ImGuiTableQueryWorkers*         Workers;        // Owned by the query, which outlives its jobs
+#endif
+
+    // Data shared by the tasks of the current phase
+    int                             Count;          // Number of rows in RowsA (after filtering)
+    int*                            RowsA;
+    int*                            RowsB;
+    ImU64*                          KeysA;          // Radix sort: key of the current sort column for each entry of RowsA
+    ImU64*                          KeysB;
+    ImU64*                          KeyValues[IMGUI_TABLE_MAX_COLUMNS]; // Merge sort: key of numeric sort columns, indexed by row
+    const ImGuiTableQueryColumn*    KeyColumn;
+    bool                            KeyDescending;
+    int                             RadixShift;
+    int                             WorkersRowsCount[IMGUI_TABLE_QUERY_MAX_WORKERS];
+    int                             WorkersSegment[IMGUI_TABLE_QUERY_MAX_WORKERS + 1];  // Merge sort: boundaries of sorted segments
+    int                             SegmentsCount;
+    int                             (*Histograms)[256];                                 // [WorkersCount][256]
+
+    ImGuiTableQueryJob() : Done(false), Cancel(false)
+    {
+        RowsCount = WorkersCount = 0; Result = NULL; Completed = false;
+        AllocFunc = NULL; FreeFunc = NULL; AllocUserData = NULL;
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+        Workers = NULL;
+#endif
+        Count = 0; RowsA = RowsB = NULL; KeysA = KeysB = NULL;
+        memset(KeyValues, 0, sizeof(KeyValues));
+        KeyColumn = NULL; KeyDescending = false; RadixShift = 0; SegmentsCount = 0; Histograms = NULL;
+    }
+};
+
+static inline void TableQueryGetSlice(const ImGuiTableQueryJob* job, int count, int worker_n, int* out_begin, int* out_end)
+{
+    *out_begin = (int)((ImS64)count * worker_n / job->WorkersCount);
+    *out_end = (int)((ImS64)count * (worker_n + 1) / job->WorkersCount);
+}
+
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+typedef void (*ImGuiTableQueryTaskFunc)(ImGuiTableQueryJob* job, int worker_n);
+
+// Threads 1..ThreadsCount-1 wait for phases started by TableQueryParallelFor(), worker 0 being the job thread.
+// Created on first use and kept until the query is destroyed. Jobs of a query run their phases one at a time (PhaseMutex):
+// a canceled job still running delays the next one by at most one phase.
+struct ImGuiTableQueryWorkers
+{
+    std::mutex                      PhaseMutex;
+    std::mutex                      Mutex;          // Protects following fields
+    std::condition_variable         PhaseStart;
+    std::condition_variable         PhaseEnd;
+    std::thread                     Threads[IMGUI_TABLE_QUERY_MAX_WORKERS];
+    int                             ThreadsCount;
+    ImGuiTableQueryJob*             Job;
+    ImGuiTableQueryTaskFunc         Func;
+    int                             WorkersCount;   // Workers of the current phase
+    int                             PendingCount;   // Workers of the current phase still running, excluding worker 0
+    unsigned int                    Phase;
+    bool                            Quit;
+
+    ImGuiTableQueryWorkers()        { ThreadsCount = 1; Job = NULL; Func = NULL; WorkersCount = PendingCount = 0; Phase = 0; Quit = false; }
+};
+
+static void TableQueryWorkerThread(ImGuiTableQueryWorkers* workers, int worker_n, unsigned int phase)
+{
+    std::unique_lock<std::mutex> lock(workers->Mutex);
+    while (true)
+    {
+        workers->PhaseStart.wait(lock, [&] { return workers->Quit || workers->Phase != phase; });
+        if (workers->Quit)
+            break;
+        phase = workers->Phase;
+        if (worker_n >= workers->WorkersCount)
+            continue;
+        ImGuiTableQueryJob* job = workers->Job;
+        ImGuiTableQueryTaskFunc func = workers->Func;
+        lock.unlock();
+        func(job, worker_n);
+        lock.lock();
+        if (--workers->PendingCount == 0)
+            workers->PhaseEnd.notify_one();
+    }
+}
+
+static void TableQueryDestroyWorkers(ImGuiTableQueryWorkers* workers)
+{
+    {
+        std::lock_guard<std::mutex> lock(workers->Mutex);
+        workers->Quit = true;
+    }
+    workers->PhaseStart.notify_all();
+    for (int thread_n = 1; thread_n < workers->ThreadsCount; thread_n++)
+        workers->Threads[thread_n].join();
+    IM_DELETE(workers);
+}
+#endif
+
+// Run 'func' on every worker and wait for all of them. Worker 0 is the calling thread.
+static void TableQueryParallelFor(ImGuiTableQueryJob* job, void (*func)(ImGuiTableQueryJob* job, int worker_n))
+{
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    if (job->WorkersCount > 1)
+    {
+        ImGuiTableQueryWorkers* workers = job->Workers;
+        std::lock_guard<std::mutex> phase_lock(workers->PhaseMutex);
+        {
+            std::lock_guard<std::mutex> lock(workers->Mutex);
+            for (; workers->ThreadsCount < job->WorkersCount; workers->ThreadsCount++)
+                workers->Threads[workers->ThreadsCount] = std::thread(TableQueryWorkerThread, workers, workers->ThreadsCount, workers->Phase);
+            workers->Job = job;
+            workers->Func = func;
+            workers->WorkersCount = job->WorkersCount;
+            workers->PendingCount = job->WorkersCount - 1;
+            workers->Phase++;
+        }
+        workers->PhaseStart.notify_all();
+        func(job, 0);
+        std::unique_lock<std::mutex> lock(workers->Mutex);
+        workers->PhaseEnd.wait(lock, [&] { return workers->PendingCount == 0; });
+        return;
+    }
+#endif
+    for (int worker_n = 0; worker_n < job->WorkersCount; worker_n++)
+        func(job, worker_n);
+}
+
+static inline char TableQueryToLower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+}
+
+static inline bool TableQueryMatchAt(const char* haystack, const char* needle_lower, int needle_len)
+{
+    for (int n = 0; n < needle_len; n++)
+        if (TableQueryToLower(haystack[n]) != needle_lower[n])
+            return false;
+    return true;
+}
+
+#ifdef IMGUI_ENABLE_SSE
+static inline __m128i TableQueryToLowerSSE(__m128i v)
+{
+    // Bytes >= 0x80 are negative and fail the first comparison
+    const __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(v, _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+}
+#endif
+
+// Case-insensitive (ASCII) substring search. With SSE2, compare the first and last needle characters
+// at 16 positions at once, and only verify the whole needle where both match.
+static bool TableQueryFindSubstring(const char* haystack, int haystack_len, const char* needle_lower, int needle_len)
+{
+    if (needle_len == 0)
+        return true;
+    int pos = 0;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128i first = _mm_set1_epi8(needle_lower[0]);
+    const __m128i last = _mm_set1_epi8(needle_lower[needle_len - 1]);
+    for (; pos + needle_len - 1 + 16 <= haystack_len; pos += 16)
+    {
+        const __m128i block_first = TableQueryToLowerSSE(_mm_loadu_si128((const __m128i*)(const void*)(haystack + pos)));
+        const __m128i block_last = TableQueryToLowerSSE(_mm_loadu_si128((const __m128i*)(const void*)(haystack + pos + needle_len - 1)));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+        for (int bit_n = 0; mask != 0; bit_n++, mask >>= 1)
+            if ((mask & 1) && TableQueryMatchAt(haystack + pos + bit_n + 1, needle_lower + 1, needle_len - 2 > 0 ? needle_len - 2 : 0))
+                return true;
+    }
+#endif
+    for (; pos + needle_len <= haystack_len; pos++)
+        if (TableQueryMatchAt(haystack + pos, needle_lower, needle_len))
+            return true;
+    return false;
+}
+
+static double TableQueryGetValue(const ImGuiTableQueryColumn* column, int row_n)
+{
+    switch (column->DataType)
+    {
+    case ImGuiDataType_S8:      return (double)((const ImS8*)column->Data)[row_n];
+    case ImGuiDataType_U8:      return (double)((const ImU8*)column->Data)[row_n];
+    case ImGuiDataType_S16:     return (double)((const ImS16*)column->Data)[row_n];
+    case ImGuiDataType_U16:     return (double)((const ImU16*)column->Data)[row_n];
+    case ImGuiDataType_S32:     return (double)((const ImS32*)column->Data)[row_n];
+    case ImGuiDataType_U32:     return (double)((const ImU32*)column->Data)[row_n];
+    case ImGuiDataType_S64:     return (double)((const ImS64*)column->Data)[row_n];
+    case ImGuiDataType_U64:     return (double)((const ImU64*)column->Data)[row_n];
+    case ImGuiDataType_Float:   return (double)((const float*)column->Data)[row_n];
+    case ImGuiDataType_Double:  return ((const double*)column->Data)[row_n];
+    }
+    IM_ASSERT(0);
+    return 0.0;
+}
+
+// Map a numeric value to an unsigned key with the same order
+static ImU64 TableQueryGetSortKey(const ImGuiTableQueryColumn* column, int row_n)
+{
+    const ImU64 sign_bit = (ImU64)1 << 63;
+    switch (column->DataType)
+    {
+    case ImGuiDataType_S8:      return (ImU64)(ImS64)((const ImS8*)column->Data)[row_n] ^ sign_bit;
+    case ImGuiDataType_U8:      return (ImU64)((const ImU8*)column->Data)[row_n];
+    case ImGuiDataType_S16:     return (ImU64)(ImS64)((const ImS16*)column->Data)[row_n] ^ sign_bit;
+    case ImGuiDataType_U16:     return (ImU64)((const ImU16*)column->Data)[row_n];
+    case ImGuiDataType_S32:     return (ImU64)(ImS64)((const ImS32*)column->Data)[row_n] ^ sign_bit;
+    case ImGuiDataType_U32:     return (ImU64)((const ImU32*)column->Data)[row_n];
+    case ImGuiDataType_S64:     return (ImU64)((const ImS64*)column->Data)[row_n] ^ sign_bit;
+    case ImGuiDataType_U64:     return ((const ImU64*)column->Data)[row_n];
+    case ImGuiDataType_Float:
+    {
+        ImU32 bits;
+        memcpy(&bits, &((const float*)column->Data)[row_n], sizeof(bits));
+        return (bits & 0x80000000) ? (ImU64)~bits & 0xFFFFFFFF : (ImU64)(bits | 0x80000000);
+    }
+    case ImGuiDataType_Double:
+    {
+        ImU64 bits;
+        memcpy(&bits, &((const double*)column->Data)[row_n], sizeof(bits));
+        return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+    }
+    }
+    IM_ASSERT(0);
+    return 0;
+}
+
+static bool TableQueryPassFilters(const ImGuiTableQueryJob* job, int row_n)
+{
+    for (const ImGuiTableQueryFilter& filter : job->Filters)
+    {
+        const ImGuiTableQueryColumn* column = &job->Columns[filter.ColumnIndex];
+        if (filter.Type == ImGuiTableQueryFilterType_Substring)
+        {
+            const char* text = ((const char* const*)column->Data)[row_n];
+            if (!TableQueryFindSubstring(text, (int)strlen(text), filter.Text, filter.TextLen))
+                return false;
+        }
+        else
+        {
+            const double value = TableQueryGetValue(column, row_n);
+            if (!(value >= filter.Min && value <= filter.Max))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Each worker writes rows passing filters at the start of its own slice, compacted afterwards
+static void TableQueryTaskFilter(ImGuiTableQueryJob* job, int worker_n)
+{
+    int row_begin, row_end;
+    TableQueryGetSlice(job, job->RowsCount, worker_n, &row_begin, &row_end);
+    int* out = job->RowsA + row_begin;
+    if (job->Filters.Size == 0)
+    {
+        for (int row_n = row_begin; row_n < row_end; row_n++)
+            *out++ = row_n;
+    }
+    else
+    {
+        for (int row_n = row_begin; row_n < row_end; row_n++)
+        {
+            if (TableQueryPassFilters(job, row_n))
+                *out++ = row_n;
+            if ((row_n & 0xFFFF) == 0xFFFF && job->Cancel.load(std::memory_order_relaxed))
+                break;
+        }
+    }
+    job->WorkersRowsCount[worker_n] = (int)(out - (job->RowsA + row_begin));
+}
+
+static void TableQueryTaskExtractKeys(ImGuiTableQueryJob* job, int worker_n)
+{
+    int begin, end;
+    TableQueryGetSlice(job, job->Count, worker_n, &begin, &end);
+    const ImU64 key_xor = job->KeyDescending ? ~(ImU64)0 : 0;
+    for (int n = begin; n < end; n++)
+    {
+        job->KeysA[n] = TableQueryGetSortKey(job->KeyColumn, job->RowsA[n]) ^ key_xor;
+        if ((n & 0xFFFF) == 0xFFFF && job->Cancel.load(std::memory_order_relaxed))
+            return;
+    }
+}
+
+static void TableQueryTaskRadixHistogram(ImGuiTableQueryJob* job, int worker_n)
+{
+    int begin, end;
+    TableQueryGetSlice(job, job->Count, worker_n, &begin, &end);
+    int* histogram = job->Histograms[worker_n];
+    memset(histogram, 0, sizeof(int) * 256);
+    const int shift = job->RadixShift;
+    for (int n = begin; n < end; n++)
+        histogram[(job->KeysA[n] >> shift) & 0xFF]++;
+}
+
+// Histograms[] hold the output offsets of each worker: scattering preserves order, so each pass is stable.
+static void TableQueryTaskRadixScatter(ImGuiTableQueryJob* job, int worker_n)
+{
+    int begin, end;
+    TableQueryGetSlice(job, job->Count, worker_n, &begin, &end);
+    int* offsets = job->Histograms[worker_n];
+    const int shift = job->RadixShift;
+    for (int n = begin; n < end; n++)
+    {
+        const int dst_n = offsets[(job->KeysA[n] >> shift) & 0xFF]++;
+        job->RowsB[dst_n] = job->RowsA[n];
+        job->KeysB[dst_n] = job->KeysA[n];
+    }
+}
+
+static void TableQueryTaskExtractKeyValues(ImGuiTableQueryJob* job, int worker_n)
+{
+    int begin, end;
+    TableQueryGetSlice(job, job->Count, worker_n, &begin, &end);
+    for (int key_n = 0; key_n < job->SortKeys.Size; key_n++)
+        if (ImU64* values = job->KeyValues[key_n])
+        {
+            const ImGuiTableQueryColumn* column = &job->Columns[job->SortKeys[key_n].ColumnIndex];
+            for (int n = begin; n < end; n++)
+            {
+                values[job->RowsA[n]] = TableQueryGetSortKey(column, job->RowsA[n]);
+                if ((n & 0xFFFF) == 0xFFFF && job->Cancel.load(std::memory_order_relaxed))
+                    return;
+            }
+        }
+}
+
+static inline int TableQueryCompareRows(const ImGuiTableQueryJob* job, int row_a, int row_b)
+{
+    for (int key_n = 0; key_n < job->SortKeys.Size; key_n++)
+    {
+        int delta;
+        if (const ImU64* values = job->KeyValues[key_n])
+        {
+            delta = (values[row_a] < values[row_b]) ? -1 : (values[row_a] > values[row_b]) ? +1 : 0;
+        }
+        else
+        {
+            const char* const* texts = (const char* const*)job->Columns[job->SortKeys[key_n].ColumnIndex].Data;
+            delta = strcmp(texts[row_a], texts[row_b]);
+        }
+        if (delta != 0)
+            return (job->SortKeys[key_n].SortDirection == ImGuiSortDirection_Descending) ? -delta : delta;
+    }
+    return row_a - row_b;
+}
+
+// Stops early (leaving 'out' incomplete) when the job is canceled
+static void TableQueryMergeRows(const ImGuiTableQueryJob* job, const int* a, int a_count, const int* b, int b_count, int* out)
+{
+    int a_n = 0, b_n = 0;
+    for (int out_n = 0; a_n < a_count && b_n < b_count; out_n++)
+    {
+        if ((out_n & 0xFFFF) == 0xFFFF && job->Cancel.load(std::memory_order_relaxed))
+            return;
+        *out++ = (TableQueryCompareRows(job, b[b_n], a[a_n]) < 0) ? b[b_n++] : a[a_n++];
+    }
+    while (a_n < a_count)
+        *out++ = a[a_n++];
+    while (b_n < b_count)
+        *out++ = b[b_n++];
+}
+
+// Merge sort each worker's slice of RowsA (using the same slice of RowsB as scratch)
+static void TableQueryTaskMergeSortSlice(ImGuiTableQueryJob* job, int worker_n)
+{
+    int begin, end;
+    TableQueryGetSlice(job, job->Count, worker_n, &begin, &end);
+    int* rows = job->RowsA + begin;
+    const int count = end - begin;
+    const int RUN_SIZE = 32;
+    for (int run_start = 0; run_start < count; run_start += RUN_SIZE)
+    {
+        if ((run_start & 0xFFFF) == 0 && job->Cancel.load(std::memory_order_relaxed))
+            return;
+        const int run_end = ImMin(run_start + RUN_SIZE, count);
+        for (int n = run_start + 1; n < run_end; n++)
+        {
+            const int row = rows[n];
+            int dst_n = n;
+            for (; dst_n > run_start && TableQueryCompareRows(job, row, rows[dst_n - 1]) < 0; dst_n--)
+                rows[dst_n] = rows[dst_n - 1];
+            rows[dst_n] = row;
+        }
+    }
+    int* src = rows;
+    int* dst = job->RowsB + begin;
+    for (int width = RUN_SIZE; width < count; width *= 2)
+    {
+        if (job->Cancel.load(std::memory_order_relaxed))
+            return;
+        for (int lo = 0; lo < count; lo += width * 2)
+        {
+            const int a_count = ImMin(width, count - lo);
+            const int b_count = ImMin(width, count - lo - a_count);
+            TableQueryMergeRows(job, src + lo, a_count, src + lo + a_count, b_count, dst + lo);
+        }
+        ImSwap(src, dst);
+    }
+    if (src != rows)
+        memcpy(rows, src, sizeof(int) * count);
+}
+
+// Number of rows of 'a' among the first 'out_n' rows of the merge of 'a' and 'b' (binary search along the merge path).
+// Rows never compare equal, so the split is unique.
+static int TableQueryMergeSplit(const ImGuiTableQueryJob* job, const int* a, int a_count, const int* b, int b_count, int out_n)
+{
+    int lo = ImMax(0, out_n - b_count);
+    int hi = ImMin(out_n, a_count);
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) / 2;
+        if (TableQueryCompareRows(job, a[mid], b[out_n - mid - 1]) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// Merge pairs of sorted segments from RowsA into RowsB. Each worker writes its own slice of the output, starting and ending
+// in the middle of a pair where needed, so every merge level (including the last one, a single pair) uses all workers.
+static void TableQueryTaskMergeSegments(ImGuiTableQueryJob* job, int worker_n)
+{
+    int out_begin, out_end;
+    TableQueryGetSlice(job, job->Count, worker_n, &out_begin, &out_end);
+    for (int segment_n = 0; segment_n < job->SegmentsCount; segment_n += 2)
+    {
+        const int a_begin = job->WorkersSegment[segment_n];
+        const int b_begin = job->WorkersSegment[ImMin(segment_n + 1, job->SegmentsCount)];
+        const int b_end = job->WorkersSegment[ImMin(segment_n + 2, job->SegmentsCount)];
+        const int begin = ImMax(a_begin, out_begin);
+        const int end = ImMin(b_end, out_end);
+        if (begin >= end)
+            continue;
+        const int* a = job->RowsA + a_begin;
+        const int* b = job->RowsA + b_begin;
+        const int a_count = b_begin - a_begin;
+        const int b_count = b_end - b_begin;
+        const int a_lo = TableQueryMergeSplit(job, a, a_count, b, b_count, begin - a_begin);
+        const int a_hi = TableQueryMergeSplit(job, a, a_count, b, b_count, end - a_begin);
+        const int b_lo = begin - a_begin - a_lo;
+        const int b_hi = end - a_begin - a_hi;
+        TableQueryMergeRows(job, a + a_lo, a_hi - a_lo, b + b_lo, b_hi - b_lo, job->RowsB + begin);
+    }
+}
+
+static void TableQueryRunJob(ImGuiTableQueryJob* job)
+{
+    void* alloc_user_data = job->AllocUserData;
+    const int rows_count = job->RowsCount;
+    job->RowsA = (int*)job->AllocFunc(sizeof(int) * ImMax(rows_count, 1), alloc_user_data);
+    job->RowsB = (int*)job->AllocFunc(sizeof(int) * ImMax(rows_count, 1), alloc_user_data);
+    job->Histograms = (int(*)[256])job->AllocFunc(sizeof(int) * 256 * job->WorkersCount, alloc_user_data);
+
+    // Filter, then compact the output of each worker
+    TableQueryParallelFor(job, TableQueryTaskFilter);
+    job->Count = 0;
+    for (int worker_n = 0; worker_n < job->WorkersCount; worker_n++)
+    {
+        int row_begin, row_end;
+        TableQueryGetSlice(job, rows_count, worker_n, &row_begin, &row_end);
+        memmove(job->RowsA + job->Count, job->RowsA + row_begin, sizeof(int) * job->WorkersRowsCount[worker_n]);
+        job->Count += job->WorkersRowsCount[worker_n];
+    }
+
+    // Sort
+    bool sort_by_text = false;
+    for (const ImGuiTableDataSortKey& sort_key : job->SortKeys)
+        if (job->Columns[sort_key.ColumnIndex].DataType == ImGuiDataType_String)
+            sort_by_text = true;
+    if (job->SortKeys.Size > 0 && !sort_by_text)
+    {
+        // LSD radix sort, from the last key to the first one
+        job->KeysA = (ImU64*)job->AllocFunc(sizeof(ImU64) * ImMax(job->Count, 1), alloc_user_data);
+        job->KeysB = (ImU64*)job->AllocFunc(sizeof(ImU64) * ImMax(job->Count, 1), alloc_user_data);
+        for (int key_n = job->SortKeys.Size - 1; key_n >= 0 && job->Count > 1; key_n--)
+        {
+            job->KeyColumn = &job->Columns[job->SortKeys[key_n].ColumnIndex];
+            job->KeyDescending = (job->SortKeys[key_n].SortDirection == ImGuiSortDirection_Descending);
+            TableQueryParallelFor(job, TableQueryTaskExtractKeys);
+            for (job->RadixShift = 0; job->RadixShift < 64 && !job->Cancel.load(std::memory_order_relaxed); job->RadixShift += 8)
+            {
+                TableQueryParallelFor(job, TableQueryTaskRadixHistogram);
+
+                // Skip passes where all keys have the same digit
+                const int digit_0 = (int)((job->KeysA[0] >> job->RadixShift) & 0xFF);
+                int digit_0_count = 0;
+                for (int worker_n = 0; worker_n < job->WorkersCount; worker_n++)
+                    digit_0_count += job->Histograms[worker_n][digit_0];
+                if (digit_0_count == job->Count)
+                    continue;
+
+                // Turn histograms into output offsets: by digit, then by worker
+                int offset = 0;
+                for (int digit = 0; digit < 256; digit++)
+                    for (int worker_n = 0; worker_n < job->WorkersCount; worker_n++)
+                    {
+                        const int count = job->Histograms[worker_n][digit];
+                        job->Histograms[worker_n][digit] = offset;
+                        offset += count;
+                    }
+                TableQueryParallelFor(job, TableQueryTaskRadixScatter);
+                ImSwap(job->RowsA, job->RowsB);
+                ImSwap(job->KeysA, job->KeysB);
+            }
+        }
+        job->FreeFunc(job->KeysA, alloc_user_data);
+        job->FreeFunc(job->KeysB, alloc_user_data);
+        job->KeysA = job->KeysB = NULL;
+    }
+    else if (job->SortKeys.Size > 0)
+    {
+        // Merge sort: sort a slice per worker, then merge pairs of segments until one remains
+        for (int key_n = 0; key_n < job->SortKeys.Size; key_n++)
+            if (job->Columns[job->SortKeys[key_n].ColumnIndex].DataType != ImGuiDataType_String)
+                job->KeyValues[key_n] = (ImU64*)job->AllocFunc(sizeof(ImU64) * ImMax(rows_count, 1), alloc_user_data);
+        TableQueryParallelFor(job, TableQueryTaskExtractKeyValues);
+        TableQueryParallelFor(job, TableQueryTaskMergeSortSlice);
+        job->SegmentsCount = job->WorkersCount;
+        for (int worker_n = 0; worker_n <= job->WorkersCount; worker_n++)
+            job->WorkersSegment[worker_n] = (int)((ImS64)job->Count * worker_n / job->WorkersCount);
+        while (job->SegmentsCount > 1 && !job->Cancel.load(std::memory_order_relaxed))
+        {
+            TableQueryParallelFor(job, TableQueryTaskMergeSegments);
+            ImSwap(job->RowsA, job->RowsB);
+            const int segments_count = (job->SegmentsCount + 1) / 2;
+            for (int segment_n = 0; segment_n <= segments_count; segment_n++)
+                job->WorkersSegment[segment_n] = job->WorkersSegment[ImMin(segment_n * 2, job->SegmentsCount)];
+            job->SegmentsCount = segments_count;
+        }
+        for (int key_n = 0; key_n < job->SortKeys.Size; key_n++)
+            job->FreeFunc(job->KeyValues[key_n], alloc_user_data);
+    }
+
+    // Publish
+    if (!job->Cancel.load(std::memory_order_relaxed))
+    {
+        memcpy(job->Result->Rows.Data, job->RowsA, sizeof(int) * job->Count);
+        job->Result->Rows.Size = job->Count;
+        job->Completed = true;
+    }
+    job->FreeFunc(job->RowsA, alloc_user_data);
+    job->FreeFunc(job->RowsB, alloc_user_data);
+    job->FreeFunc(job->Histograms, alloc_user_data);
+    job->Done.store(true, std::memory_order_release);
+}
+
+// Blocks until the job is done: call once Done is set, or after setting Cancel (returns quickly)
+static void TableQueryDestroyJob(ImGuiTableQueryJob* job)
+{
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    if (job->Thread.joinable())
+        job->Thread.join();
+#endif
+    if (job->Result != NULL)
+        IM_DELETE(job->Result);
+    IM_DELETE(job);
+}
+
+ImGuiTableQuery::ImGuiTableQuery()
+{
+    RowsCount = 0;
+    WorkersCount = 0;
+    HasResult = false;
+    Job = NULL;
+    Workers = NULL;
+}
+
+ImGuiTableQuery::~ImGuiTableQuery()
+{
+    if (Job != NULL)
+        CanceledJobs.push_back(Job);
+    Job = NULL;
+    for (ImGuiTableQueryJob* job : CanceledJobs)
+        job->Cancel.store(true);
+    for (ImGuiTableQueryJob* job : CanceledJobs)
+        TableQueryDestroyJob(job);
+    CanceledJobs.clear();
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    if (Workers != NULL)
+        TableQueryDestroyWorkers(Workers);
+#endif
+}
+
+void ImGuiTableQuery::AddFilterSubstring(int column_n, const char* text)
+{
+    IM_ASSERT(column_n >= 0 && column_n < Columns.Size && Columns[column_n].DataType == ImGuiDataType_String);
+    ImGuiTableQueryFilter filter;
+    memset(&filter, 0, sizeof(filter));
+    filter.Type = ImGuiTableQueryFilterType_Substring;
+    filter.ColumnIndex = column_n;
+    ImStrncpy(filter.Text, text, IM_ARRAYSIZE(filter.Text));
+    for (char* p = filter.Text; *p; p++)
+        *p = TableQueryToLower(*p);
+    filter.TextLen = (int)strlen(filter.Text);
+    Filters.push_back(filter);
+}
+
+void ImGuiTableQuery::AddFilterRange(int column_n, double min, double max)
+{
+    IM_ASSERT(column_n >= 0 && column_n < Columns.Size && Columns[column_n].DataType < ImGuiDataType_COUNT);
+    ImGuiTableQueryFilter filter;
+    memset(&filter, 0, sizeof(filter));
+    filter.Type = ImGuiTableQueryFilterType_Range;
+    filter.ColumnIndex = column_n;
+    filter.Min = min;
+    filter.Max = max;
+    Filters.push_back(filter);
+}
+
+void ImGuiTableQuery::Submit()
+{
+    IM_ASSERT(RowsCount >= 0 && Columns.Size > 0 && SortKeys.Size <= IMGUI_TABLE_MAX_COLUMNS);
+    if (Job != NULL)
+    {
+        Job->Cancel.store(true);
+        Update(); // Take a result completed before cancellation, free finished jobs
+        if (Job != NULL)
+            CanceledJobs.push_back(Job);
+        Job = NULL;
+    }
+
+    ImGuiTableQueryJob* job = IM_NEW(ImGuiTableQueryJob)();
+    job->RowsCount = RowsCount;
+    job->Columns = Columns;
+    job->SortKeys = SortKeys;
+    job->Filters = Filters;
+    job->WorkersCount = WorkersCount;
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    if (job->WorkersCount <= 0)
+        job->WorkersCount = (int)std::thread::hardware_concurrency();
+#endif
+    job->WorkersCount = ImClamp(job->WorkersCount, 1, IMGUI_TABLE_QUERY_MAX_WORKERS);
+    job->Result = IM_NEW(ImGuiTableQueryResult)();
+    job->Result->Rows.resize(RowsCount);
+    ImGui::GetAllocatorFunctions(&job->AllocFunc, &job->FreeFunc, &job->AllocUserData);
+    Job = job;
+#ifndef IMGUI_DISABLE_WORKER_THREADS
+    if (Workers == NULL)
+        Workers = IM_NEW(ImGuiTableQueryWorkers)();
+    job->Workers = Workers;
+    job->Thread = std::thread(TableQueryRunJob, job);
+#else
+    TableQueryRunJob(job);
+#endif
+}
+
+bool ImGuiTableQuery::Update()
+{
+    for (int job_n = 0; job_n < CanceledJobs.Size; job_n++)
+        if (CanceledJobs[job_n]->Done.load(std::memory_order_acquire))
+        {
+            TableQueryDestroyJob(CanceledJobs[job_n]);
+            CanceledJobs.erase(CanceledJobs.Data + job_n--);
+        }
+
+    if (Job == NULL || !Job->Done.load(std::memory_order_acquire))
+        return false;
+    ImGuiTableQueryResult* result = Job->Completed ? Job->Result : NULL;
+    if (result != NULL)
+        Job->Result = NULL;
+    TableQueryDestroyJob(Job);
+    Job = NULL;
+    if (result == NULL)
+        return false;
+    Rows.swap(result->Rows);
+    HasResult = true;
+    IM_DELETE(result);
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3542,18 +4791,20 @@ ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    g.SettingsTablesMap.SetInt(id, g.SettingsTables.offset_from_ptr(settings));
     return settings;
 }
 
 // Find existing settings
+// The map points to the most recently created entry for an ID. An entry invalidated with ID = 0 is only ever replaced by a new one.
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
     ImGuiContext& g = *GImGui;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsTablesMap.GetInt(id, -1);
+    if (offset == -1)
+        return NULL;
+    ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset);
+    return (settings->ID == id) ? settings : NULL;
 }
 
 // Get settings for a given table, NULL if none
@@ -3707,6 +4958,7 @@ static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (ImGuiTable* table = g.Tables.TryGetMapData(i))
             table->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesMap.Clear();
 }
 
 // Apply to existing windows (if any)
@@ -3878,6 +5130,15 @@ void ImGui::TableGcCompactSettings()
         if (settings->ID != 0)
             memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
     g.SettingsTables.swap(new_chunk_stream);
+
+    // Offsets changed: rebuild map and table bindings
+    g.SettingsTablesMap.Clear();
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        g.SettingsTablesMap.SetInt(settings->ID, g.SettingsTables.offset_from_ptr(settings));
+    for (int i = 0; i != g.Tables.GetMapSize(); i++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(i))
+            if (table->SettingsOffset != -1)
+                table->SettingsOffset = g.SettingsTablesMap.GetInt(table->ID, -1);
 }
 
 
@@ -3927,6 +5188,7 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
+    BulletText("DrawCmd: %d before merge, %d after merge%s", table->DrawCmdCountBeforeMerge, table->DrawCmdCountAfterMerge, table->IsDirectDraw ? " (direct draw)" : "");
     for (int n = 0; n < table->InstanceCurrent + 1; n++)
     {
         ImGuiTableInstanceData* table_instance = TableGetInstanceData(table, n);
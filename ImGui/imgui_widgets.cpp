@@ -15,8 +15,10 @@ Index of this file:
 // [SECTION] Widgets: SliderScalar, SliderFloat, SliderInt, etc.
 // [SECTION] Widgets: InputScalar, InputFloat, InputInt, etc.
 // [SECTION] Widgets: InputText, InputTextMultiline
+// [SECTION] Widgets: InputTextDocument (large documents)
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 // [SECTION] Widgets: TreeNode, CollapsingHeader, etc.
+// [SECTION] Widgets: VirtualTree
 // [SECTION] Widgets: Selectable
 // [SECTION] Widgets: Typing-Select support
 // [SECTION] Widgets: Multi-Select support
@@ -44,6 +46,7 @@ Index of this file:
 
 // System includes
 #include <stdint.h>     // intptr_t
+#include <atomic>       // std::atomic (ImGuiStreamingPlot)
 
 //-------------------------------------------------------------------------
 // Warnings
@@ -1704,6 +1707,7 @@ void ImGui::ShrinkWidths(ImGuiShrinkWidthItem* items, int count, float width_exc
 // - BeginComboPreview() [Internal]
 // - EndComboPreview() [Internal]
 // - Combo()
+// - ComboEx() [Internal]
 //-------------------------------------------------------------------------
 
 static float CalcMaxPopupHeightFromItemCount(int items_count)
@@ -1940,8 +1944,28 @@ static const char* Items_SingleStringGetter(void* data, int idx)
     return *p ? p : NULL;
 }
 
+// Typing-select for ComboEx()/ListBoxEx(), called from within the window holding the items.
+// Return index of item to focus, or -1.
+static int ItemsTypingSelect(const ImGuiTypingSelectIndex* index, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count)
+{
+    ImGuiContext& g = *GImGui;
+    if (index == NULL || !ImGui::IsWindowFocused())
+        return -1;
+    IM_ASSERT(index->GetItemsCount() == items_count && "ImGuiTypingSelectIndex needs to be rebuilt when items change!");
+    IM_UNUSED(items_count);
+    const int nav_item_idx = (g.NavWindow == g.CurrentWindow && g.NavLastValidSelectionUserData != ImGuiSelectionUserData_Invalid) ? (int)g.NavLastValidSelectionUserData : -1;
+    ImGuiTypingSelectRequest* req = ImGui::GetTypingSelectRequest(ImGuiTypingSelectFlags_AllowBackspace | ImGuiTypingSelectFlags_AllowSingleCharMode);
+    return ImGui::TypingSelectFindMatch(req, index, getter, user_data, nav_item_idx);
+}
+
 // Old API, prefer using BeginCombo() nowadays if you can.
 bool ImGui::Combo(const char* label, int* current_item, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count, int popup_max_height_in_items)
+{
+    return ComboEx(label, current_item, getter, user_data, items_count, NULL, popup_max_height_in_items);
+}
+
+// Per-frame cost only depends on the number of visible items: items are clipped, and typing-select uses 'index' instead of scanning items.
+bool ImGui::ComboEx(const char* label, int* current_item, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count, const ImGuiTypingSelectIndex* index, int popup_max_height_in_items)
 {
     ImGuiContext& g = *GImGui;
 
@@ -1959,9 +1983,12 @@ bool ImGui::Combo(const char* label, int* current_item, const char* (*getter)(vo
 
     // Display items
     bool value_changed = false;
+    const int focus_idx = ItemsTypingSelect(index, getter, user_data, items_count);
     ImGuiListClipper clipper;
     clipper.Begin(items_count);
     clipper.IncludeItemByIndex(*current_item);
+    if (focus_idx != -1)
+        clipper.IncludeItemByIndex(focus_idx);
     while (clipper.Step())
         for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
         {
@@ -1971,6 +1998,8 @@ bool ImGui::Combo(const char* label, int* current_item, const char* (*getter)(vo
 
             PushID(i);
             const bool item_selected = (i == *current_item);
+            if (index != NULL)
+                SetNextItemSelectionUserData(i);
             if (Selectable(item_text, item_selected) && *current_item != i)
             {
                 value_changed = true;
@@ -1978,6 +2007,11 @@ bool ImGui::Combo(const char* label, int* current_item, const char* (*getter)(vo
             }
             if (item_selected)
                 SetItemDefaultFocus();
+            if (i == focus_idx)
+            {
+                SetFocusID(g.LastItemData.ID, g.CurrentWindow);
+                ScrollToItem(ImGuiScrollFlags_KeepVisibleCenterY);
+            }
             PopID();
         }
 
@@ -3762,6 +3796,39 @@ static ImVec2 InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar* text_begi
     return text_size;
 }
 
+// Index of the line containing character 'pos', using the line index (see InputTextLineIndexBuild())
+static int InputTextLineIndexFind(const ImGuiInputTextState* obj, int pos)
+{
+    // Find first line start > pos
+    const ImVector<int>& starts = obj->LineStartsW;
+    int first = 0, count = starts.Size;
+    while (count > 0)
+    {
+        const int count2 = count >> 1;
+        if (starts.Data[first + count2] <= pos)
+        {
+            first += count2 + 1;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    return ImMax(first - 1, 0);
+}
+
+static void InputTextLineIndexBuild(ImGuiInputTextState* obj)
+{
+    obj->LineStartsW.resize(0);
+    obj->LineStartsW.push_back(0);
+    const ImWchar* text = obj->TextW.Data;
+    for (int n = 0; n < obj->CurLenW; n++)
+        if (text[n] == '\n')
+            obj->LineStartsW.push_back(n + 1);
+    obj->LineStartsValid = true;
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 namespace ImStb
 {
@@ -3823,6 +3890,17 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
     ImWchar* dst = obj->TextW.Data + pos;
 
+    // Update line index: drop lines starting within the deleted range, shift following lines
+    if (obj->LineStartsValid)
+    {
+        const int line_first = InputTextLineIndexFind(obj, pos) + 1;
+        const int line_last = InputTextLineIndexFind(obj, pos + n) + 1;
+        if (line_last > line_first)
+            obj->LineStartsW.erase(obj->LineStartsW.Data + line_first, obj->LineStartsW.Data + line_last);
+        for (int line_no = line_first; line_no < obj->LineStartsW.Size; line_no++)
+            obj->LineStartsW.Data[line_no] -= n;
+    }
+
     // We maintain our buffer length in both UTF-8 and wchar formats
     obj->Edited = true;
     obj->CurLenA -= ImTextCountUtf8BytesFromStr(dst, dst + n);
@@ -3864,6 +3942,27 @@ static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const Im
     obj->CurLenA += new_text_len_utf8;
     obj->TextW[obj->CurLenW] = '\0';
 
+    // Update line index: shift following lines, insert lines started by new line breaks
+    if (obj->LineStartsValid)
+    {
+        ImVector<int>& starts = obj->LineStartsW;
+        const int line_next = InputTextLineIndexFind(obj, pos) + 1;
+        for (int line_no = line_next; line_no < starts.Size; line_no++)
+            starts.Data[line_no] += new_text_len;
+        int new_lines = 0;
+        for (int n = 0; n < new_text_len; n++)
+            new_lines += (new_text[n] == '\n') ? 1 : 0;
+        if (new_lines > 0)
+        {
+            const int old_size = starts.Size;
+            starts.resize(old_size + new_lines);
+            memmove(starts.Data + line_next + new_lines, starts.Data + line_next, (size_t)(old_size - line_next) * sizeof(int));
+            for (int n = 0, dst = line_next; n < new_text_len; n++)
+                if (new_text[n] == '\n')
+                    starts.Data[dst++] = pos + n + 1;
+        }
+    }
+
     return true;
 }
 
@@ -4287,6 +4386,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->TextA.resize(0);
         state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
+        state->LineStartsValid = false;
         state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
 
         if (recycle_state)
@@ -4373,6 +4473,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->TextW.resize(buf_size + 1);
         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, NULL, &buf_end);
         state->CurLenA = (int)(buf_end - buf);
+        state->LineStartsValid = false;
         state->CursorClamp();
         render_selection &= state->HasSelection();
     }
@@ -4631,10 +4732,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
                 const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
-                char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
+                char* clipboard_data = (char*)MemAllocFrame(clipboard_data_len * sizeof(char));
                 ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
                 SetClipboardText(clipboard_data);
-                MemFree(clipboard_data);
             }
             if (is_cut)
             {
@@ -4650,7 +4750,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 // Filter pasted buffer
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC((clipboard_len + 1) * sizeof(ImWchar));
+                ImWchar* clipboard_filtered = (ImWchar*)MemAllocFrame((clipboard_len + 1) * sizeof(ImWchar));
                 int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s != 0; )
                 {
@@ -4666,7 +4766,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     stb_textedit_paste(state, &state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
-                MemFree(clipboard_filtered);
             }
         }
 
@@ -4710,11 +4809,14 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
 
         // Apply ASCII value
-        if (!is_readonly)
+        // Only convert after an edit: TextA is kept in sync with TextW otherwise, and converting a large buffer every frame is O(n).
+        bool text_a_updated = false;
+        if (!is_readonly && (state->Edited || !state->TextAIsValid))
         {
             state->TextAIsValid = true;
             state->TextA.resize(state->TextW.Size * 4 + 1);
             ImTextStrToUtf8(state->TextA.Data, state->TextA.Size, state->TextW.Data, NULL);
+            text_a_updated = true;
         }
 
         // When using 'ImGuiInputTextFlags_EnterReturnsTrue' as a special case we reapply the live buffer back to the input buffer
@@ -4729,7 +4831,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             // Apply new value immediately - copy modified buffer back
             // Note that as soon as the input box is active, the in-widget value gets priority over any underlying modification of the input buffer
             // FIXME: We actually always render 'buf' when calling DrawList->AddText, making the comment above incorrect.
-            // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks.
 
             // User callback
             if ((flags & (ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackEdit | ImGuiInputTextFlags_CallbackAlways)) != 0)
@@ -4804,14 +4905,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                         if (callback_data.BufTextLen > backup_current_text_length && is_resizable)
                             state->TextW.resize(state->TextW.Size + (callback_data.BufTextLen - backup_current_text_length)); // Worse case scenario resize
                         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, callback_data.Buf, NULL);
+                        state->LineStartsValid = false;
                         state->CurLenA = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
                         state->CursorAnimReset();
+                        text_a_updated = true;
                     }
                 }
             }
 
             // Will copy result string if modified
-            if (!is_readonly && strcmp(state->TextA.Data, buf) != 0)
+            // Only compare after an edit or on validation: 'buf' already received TextA on the last frame it changed, and callers
+            // rewriting 'buf' every frame (e.g. InputScalar() with ImGuiInputTextFlags_EnterReturnsTrue) get the live text on validation.
+            if (!is_readonly && (text_a_updated || validated) && strcmp(state->TextA.Data, buf) != 0)
             {
                 apply_new_text = state->TextA.Data;
                 apply_new_text_length = state->CurLenA;
@@ -4909,7 +5014,27 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // FIXME: This should occur on buf_display but we'd need to maintain cursor/select_start/select_end for UTF-8.
         const ImWchar* text_begin = state->TextW.Data;
         ImVec2 cursor_offset, select_start_offset;
+        int line_count = 0;
 
+        if (is_multiline)
+        {
+            // Multi-line: find line numbers with the line index, so we never visit lines that are not displayed.
+            if (!state->LineStartsValid)
+                InputTextLineIndexBuild(state);
+            line_count = state->LineStartsW.Size;
+            const int cursor_line_no = InputTextLineIndexFind(state, state->Stb.cursor);
+            cursor_offset.x = InputTextCalcTextSizeW(&g, text_begin + state->LineStartsW[cursor_line_no], text_begin + state->Stb.cursor).x;
+            cursor_offset.y = (cursor_line_no + 1) * g.FontSize;
+            if (render_selection)
+            {
+                const int select_start = ImMin(state->Stb.select_start, state->Stb.select_end);
+                const int select_start_line_no = InputTextLineIndexFind(state, select_start);
+                select_start_offset.x = InputTextCalcTextSizeW(&g, text_begin + state->LineStartsW[select_start_line_no], text_begin + select_start).x;
+                select_start_offset.y = (select_start_line_no + 1) * g.FontSize;
+            }
+            text_size = ImVec2(inner_size.x, line_count * g.FontSize);
+        }
+        else
         {
             // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
             const ImWchar* searches_input_ptr[2] = { NULL, NULL };
@@ -4931,7 +5056,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             // Iterate all lines to find our line numbers
             // In multi-line mode, we never exit the loop until all lines are counted, so add one extra to the searches_remaining counter.
             searches_remaining += is_multiline ? 1 : 0;
-            int line_count = 0;
             //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bit
             for (const ImWchar* s = text_begin; *s != 0; s++)
                 if (*s == '\n')
@@ -4954,10 +5078,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 select_start_offset.x = InputTextCalcTextSizeW(&g, ImStrbolW(searches_input_ptr[1], text_begin), searches_input_ptr[1]).x;
                 select_start_offset.y = searches_result_line_no[1] * g.FontSize;
             }
-
-            // Store text height (note that we haven't calculated text width at all, see GitHub issues #383, #1224)
-            if (is_multiline)
-                text_size = ImVec2(inner_size.x, line_count * g.FontSize);
         }
 
         // Scroll
@@ -5006,34 +5126,74 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const ImWchar* p = text_selected_begin; p < text_selected_end; )
+            if (is_multiline)
             {
-                if (rect_pos.y > clip_rect.w + g.FontSize)
-                    break;
-                if (rect_pos.y < clip_rect.y)
+                // Only visit lines which are both selected and visible
+                const int select_line_min = InputTextLineIndexFind(state, (int)(text_selected_begin - text_begin));
+                int select_line_max = InputTextLineIndexFind(state, (int)(text_selected_end - text_begin));
+                if (select_line_max > select_line_min && text_begin + state->LineStartsW[select_line_max] == text_selected_end)
+                    select_line_max--; // Selection ends right after a line break: nothing to highlight on the last line
+                const int visible_line_min = ImMax(select_line_min, (int)ImFloor((clip_rect.y - draw_pos.y) / g.FontSize) - 1);
+                const int visible_line_max = (text_selected_begin < text_selected_end) ? ImMin(select_line_max, (int)ImCeil((clip_rect.w - draw_pos.y) / g.FontSize)) : -1; // Selection may have been cleared by this frame's events
+                for (int line_no = visible_line_min; line_no <= visible_line_max; line_no++)
                 {
-                    //p = (const ImWchar*)wmemchr((const wchar_t*)p, '\n', text_selected_end - p);  // FIXME-OPT: Could use this when wchar_t are 16-bit
-                    //p = p ? p + 1 : text_selected_end;
-                    while (p < text_selected_end)
-                        if (*p++ == '\n')
-                            break;
-                }
-                else
-                {
-                    ImVec2 rect_size = InputTextCalcTextSizeW(&g, p, text_selected_end, &p, NULL, true);
+                    const ImWchar* line_begin = text_begin + state->LineStartsW[line_no];
+                    const ImWchar* line_end = (line_no + 1 < line_count) ? text_begin + state->LineStartsW[line_no + 1] - 1 : text_begin + state->CurLenW;
+                    rect_pos.x = (line_no == select_line_min) ? draw_pos.x + select_start_offset.x - draw_scroll.x : draw_pos.x - draw_scroll.x;
+                    rect_pos.y = draw_pos.y + (line_no + 1) * g.FontSize;
+                    ImVec2 rect_size = InputTextCalcTextSizeW(&g, ImMax(line_begin, text_selected_begin), ImMin(line_end, text_selected_end));
                     if (rect_size.x <= 0.0f) rect_size.x = IM_TRUNC(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
                     ImRect rect(rect_pos + ImVec2(0.0f, bg_offy_up - g.FontSize), rect_pos + ImVec2(rect_size.x, bg_offy_dn));
                     rect.ClipWith(clip_rect);
                     if (rect.Overlaps(clip_rect))
                         draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
                 }
-                rect_pos.x = draw_pos.x - draw_scroll.x;
-                rect_pos.y += g.FontSize;
+            }
+            else
+            {
+                for (const ImWchar* p = text_selected_begin; p < text_selected_end; )
+                {
+                    if (rect_pos.y > clip_rect.w + g.FontSize)
+                        break;
+                    if (rect_pos.y < clip_rect.y)
+                    {
+                        //p = (const ImWchar*)wmemchr((const wchar_t*)p, '\n', text_selected_end - p);  // FIXME-OPT: Could use this when wchar_t are 16-bit
+                        //p = p ? p + 1 : text_selected_end;
+                        while (p < text_selected_end)
+                            if (*p++ == '\n')
+                                break;
+                    }
+                    else
+                    {
+                        ImVec2 rect_size = InputTextCalcTextSizeW(&g, p, text_selected_end, &p, NULL, true);
+                        if (rect_size.x <= 0.0f) rect_size.x = IM_TRUNC(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+                        ImRect rect(rect_pos + ImVec2(0.0f, bg_offy_up - g.FontSize), rect_pos + ImVec2(rect_size.x, bg_offy_dn));
+                        rect.ClipWith(clip_rect);
+                        if (rect.Overlaps(clip_rect))
+                            draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
+                    }
+                    rect_pos.x = draw_pos.x - draw_scroll.x;
+                    rect_pos.y += g.FontSize;
+                }
             }
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (is_multiline && !is_displaying_hint)
+        {
+            // Multi-line: only convert and submit visible lines
+            const int visible_line_min = ImClamp((int)ImFloor((clip_rect.y - draw_pos.y) / g.FontSize), 0, line_count - 1);
+            const int visible_line_max = ImClamp((int)ImCeil((clip_rect.w - draw_pos.y) / g.FontSize), 0, line_count - 1);
+            const ImWchar* visible_begin = text_begin + state->LineStartsW[visible_line_min];
+            const ImWchar* visible_end = (visible_line_max + 1 < line_count) ? text_begin + state->LineStartsW[visible_line_max + 1] : text_begin + state->CurLenW;
+            const int visible_len_a = ImTextCountUtf8BytesFromStr(visible_begin, visible_end);
+            if (g.TempBuffer.Size < visible_len_a + 1)
+                g.TempBuffer.resize(visible_len_a + 1);
+            ImTextStrToUtf8(g.TempBuffer.Data, visible_len_a + 1, visible_begin, visible_end);
+            ImU32 col = GetColorU32(ImGuiCol_Text);
+            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll + ImVec2(0.0f, visible_line_min * g.FontSize), col, g.TempBuffer.Data, g.TempBuffer.Data + visible_len_a, 0.0f, NULL);
+        }
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -5155,180 +5315,969 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
 }
 
 //-------------------------------------------------------------------------
-// [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
+// [SECTION] Widgets: InputTextDocument (large documents)
 //-------------------------------------------------------------------------
-// - ColorEdit3()
-// - ColorEdit4()
-// - ColorPicker3()
-// - RenderColorRectWithAlphaCheckerboard() [Internal]
-// - ColorPicker4()
-// - ColorButton()
-// - SetColorEditOptions()
-// - ColorTooltip() [Internal]
-// - ColorEditOptionsPopup() [Internal]
-// - ColorPickerOptionsPopup() [Internal]
+// - ImGuiTextDocument [Internal]
+// - InputTextDocument() [Internal]
+//-------------------------------------------------------------------------
+// InputTextEx() converts the whole buffer to ImWchar on activation, moves the tail of the buffer on every
+// edit and scans the whole text to render it. This is fine for typical input fields but doesn't scale to
+// multi-megabyte documents (logs, configuration files). InputTextDocument() edits an ImGuiTextDocument
+// (piece table + line index) in place and only ever touches the visible lines.
 //-------------------------------------------------------------------------
 
-bool ImGui::ColorEdit3(const char* label, float col[3], ImGuiColorEditFlags flags)
+// Index of first element >= value in a sorted array
+static int TextDocLowerBound(const ImVector<int>& data, int value)
 {
-    return ColorEdit4(label, col, flags | ImGuiColorEditFlags_NoAlpha);
+    int first = 0;
+    int count = data.Size;
+    while (count > 0)
+    {
+        const int count2 = count >> 1;
+        if (data.Data[first + count2] < value)
+        {
+            first += count2 + 1;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    return first;
 }
 
-static void ColorEditRestoreH(const float* col, float* H)
+static void TextDocIndexLineBreaks(ImVector<int>* out_breaks, const char* buf, int offset, int len)
 {
-    ImGuiContext& g = *GImGui;
-    IM_ASSERT(g.ColorEditCurrentID != 0);
-    if (g.ColorEditSavedID != g.ColorEditCurrentID || g.ColorEditSavedColor != ImGui::ColorConvertFloat4ToU32(ImVec4(col[0], col[1], col[2], 0)))
-        return;
-    *H = g.ColorEditSavedHue;
+    for (const char* p = buf + offset, *p_end = buf + offset + len; (p = (const char*)memchr(p, '\n', (size_t)(p_end - p))) != NULL; p++)
+        out_breaks->push_back((int)(p - buf));
 }
 
-// ColorEdit supports RGB and HSV inputs. In case of RGB input resulting color may have undefined hue and/or saturation.
-// Since widget displays both RGB and HSV values we must preserve hue and saturation to prevent these values resetting.
-static void ColorEditRestoreHS(const float* col, float* H, float* S, float* V)
-{
-    ImGuiContext& g = *GImGui;
-    IM_ASSERT(g.ColorEditCurrentID != 0);
-    if (g.ColorEditSavedID != g.ColorEditCurrentID || g.ColorEditSavedColor != ImGui::ColorConvertFloat4ToU32(ImVec4(col[0], col[1], col[2], 0)))
-        return;
-
-    // When S == 0, H is undefined.
-    // When H == 1 it wraps around to 0.
-    if (*S == 0.0f || (*H == 0.0f && g.ColorEditSavedHue == 1))
-        *H = g.ColorEditSavedHue;
+static inline int TextDocSubtreeLength(const ImGuiTextDocument* doc, int n)     { return n != -1 ? doc->Pieces.Data[n].SubtreeLength : 0; }
+static inline int TextDocSubtreeLineBreaks(const ImGuiTextDocument* doc, int n) { return n != -1 ? doc->Pieces.Data[n].SubtreeLineBreaks : 0; }
 
-    // When V == 0, S is undefined.
-    if (*V == 0.0f)
-        *S = g.ColorEditSavedSat;
+static void TextDocUpdatePiece(ImGuiTextDocument* doc, int n)
+{
+    ImGuiTextDocumentPiece* piece = &doc->Pieces.Data[n];
+    const ImVector<int>& breaks = piece->InAdded ? doc->AddedLineBreaks : doc->OriginalLineBreaks;
+    piece->LineBreaks = TextDocLowerBound(breaks, piece->Offset + piece->Length) - TextDocLowerBound(breaks, piece->Offset);
 }
 
-// Edit colors components (each component in 0.0f..1.0f range).
-// See enum ImGuiColorEditFlags_ for available options. e.g. Only access 3 floats if ImGuiColorEditFlags_NoAlpha flag is set.
-// With typical options: Left-click on color square to open color picker. Right-click to open option menu. CTRL-Click over input fields to edit them and TAB to go to next item.
-bool ImGui::ColorEdit4(const char* label, float col[4], ImGuiColorEditFlags flags)
+static void TextDocUpdateSubtree(ImGuiTextDocument* doc, int n)
 {
-    ImGuiWindow* window = GetCurrentWindow();
-    if (window->SkipItems)
-        return false;
-
-    ImGuiContext& g = *GImGui;
-    const ImGuiStyle& style = g.Style;
-    const float square_sz = GetFrameHeight();
-    const char* label_display_end = FindRenderedTextEnd(label);
-    float w_full = CalcItemWidth();
-    g.NextItemData.ClearFlags();
-
-    BeginGroup();
-    PushID(label);
-    const bool set_current_color_edit_id = (g.ColorEditCurrentID == 0);
-    if (set_current_color_edit_id)
-        g.ColorEditCurrentID = window->IDStack.back();
-
-    // If we're not showing any slider there's no point in doing any HSV conversions
-    const ImGuiColorEditFlags flags_untouched = flags;
-    if (flags & ImGuiColorEditFlags_NoInputs)
-        flags = (flags & (~ImGuiColorEditFlags_DisplayMask_)) | ImGuiColorEditFlags_DisplayRGB | ImGuiColorEditFlags_NoOptions;
-
-    // Context menu: display and modify options (before defaults are applied)
-    if (!(flags & ImGuiColorEditFlags_NoOptions))
-        ColorEditOptionsPopup(col, flags);
+    ImGuiTextDocumentPiece* piece = &doc->Pieces.Data[n];
+    piece->SubtreeLength = TextDocSubtreeLength(doc, piece->Left) + piece->Length + TextDocSubtreeLength(doc, piece->Right);
+    piece->SubtreeLineBreaks = TextDocSubtreeLineBreaks(doc, piece->Left) + piece->LineBreaks + TextDocSubtreeLineBreaks(doc, piece->Right);
+}
 
-    // Read stored options
-    if (!(flags & ImGuiColorEditFlags_DisplayMask_))
-        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_DisplayMask_);
-    if (!(flags & ImGuiColorEditFlags_DataTypeMask_))
-        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_DataTypeMask_);
-    if (!(flags & ImGuiColorEditFlags_PickerMask_))
-        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_PickerMask_);
-    if (!(flags & ImGuiColorEditFlags_InputMask_))
-        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_InputMask_);
-    flags |= (g.ColorEditOptions & ~(ImGuiColorEditFlags_DisplayMask_ | ImGuiColorEditFlags_DataTypeMask_ | ImGuiColorEditFlags_PickerMask_ | ImGuiColorEditFlags_InputMask_));
-    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags_DisplayMask_)); // Check that only 1 is selected
-    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags_InputMask_));   // Check that only 1 is selected
+static int TextDocNewPiece(ImGuiTextDocument* doc, bool in_added, int offset, int length)
+{
+    int n;
+    if (doc->PiecesFreeList.Size > 0)
+    {
+        n = doc->PiecesFreeList.back();
+        doc->PiecesFreeList.pop_back();
+    }
+    else
+    {
+        n = doc->Pieces.Size;
+        doc->Pieces.resize(doc->Pieces.Size + 1);
+    }
+    doc->RandomSeed ^= doc->RandomSeed << 13; // xorshift32
+    doc->RandomSeed ^= doc->RandomSeed >> 17;
+    doc->RandomSeed ^= doc->RandomSeed << 5;
+    ImGuiTextDocumentPiece* piece = &doc->Pieces.Data[n];
+    piece->Left = piece->Right = -1;
+    piece->Priority = doc->RandomSeed;
+    piece->InAdded = in_added;
+    piece->Offset = offset;
+    piece->Length = length;
+    TextDocUpdatePiece(doc, n);
+    TextDocUpdateSubtree(doc, n);
+    return n;
+}
 
-    const bool alpha = (flags & ImGuiColorEditFlags_NoAlpha) == 0;
-    const bool hdr = (flags & ImGuiColorEditFlags_HDR) != 0;
-    const int components = alpha ? 4 : 3;
-    const float w_button = (flags & ImGuiColorEditFlags_NoSmallPreview) ? 0.0f : (square_sz + style.ItemInnerSpacing.x);
-    const float w_inputs = ImMax(w_full - w_button, 1.0f);
-    w_full = w_inputs + w_button;
+static void TextDocFreeSubtree(ImGuiTextDocument* doc, int n)
+{
+    if (n == -1)
+        return;
+    TextDocFreeSubtree(doc, doc->Pieces.Data[n].Left);
+    TextDocFreeSubtree(doc, doc->Pieces.Data[n].Right);
+    doc->PiecesFreeList.push_back(n);
+}
 
-    // Convert to the formats we need
-    float f[4] = { col[0], col[1], col[2], alpha ? col[3] : 1.0f };
-    if ((flags & ImGuiColorEditFlags_InputHSV) && (flags & ImGuiColorEditFlags_DisplayRGB))
-        ColorConvertHSVtoRGB(f[0], f[1], f[2], f[0], f[1], f[2]);
-    else if ((flags & ImGuiColorEditFlags_InputRGB) && (flags & ImGuiColorEditFlags_DisplayHSV))
+// Split subtree 'n' into [0,pos) and [pos,end). A piece straddling 'pos' is cut in two.
+static void TextDocSplit(ImGuiTextDocument* doc, int n, int pos, int* out_left, int* out_right)
+{
+    if (n == -1)
     {
-        // Hue is lost when converting from grayscale rgb (saturation=0). Restore it.
-        ColorConvertRGBtoHSV(f[0], f[1], f[2], f[0], f[1], f[2]);
-        ColorEditRestoreHS(col, &f[0], &f[1], &f[2]);
+        *out_left = *out_right = -1;
+        return;
     }
-    int i[4] = { IM_F32_TO_INT8_UNBOUND(f[0]), IM_F32_TO_INT8_UNBOUND(f[1]), IM_F32_TO_INT8_UNBOUND(f[2]), IM_F32_TO_INT8_UNBOUND(f[3]) };
-
-    bool value_changed = false;
-    bool value_changed_as_float = false;
+    const int left_len = TextDocSubtreeLength(doc, doc->Pieces.Data[n].Left);
+    const int piece_len = doc->Pieces.Data[n].Length;
+    if (pos <= left_len)
+    {
+        int l, r;
+        TextDocSplit(doc, doc->Pieces.Data[n].Left, pos, &l, &r);
+        doc->Pieces.Data[n].Left = r;
+        TextDocUpdateSubtree(doc, n);
+        *out_left = l;
+        *out_right = n;
+    }
+    else if (pos >= left_len + piece_len)
+    {
+        int l, r;
+        TextDocSplit(doc, doc->Pieces.Data[n].Right, pos - left_len - piece_len, &l, &r);
+        doc->Pieces.Data[n].Right = l;
+        TextDocUpdateSubtree(doc, n);
+        *out_left = n;
+        *out_right = r;
+    }
+    else
+    {
+        // Cut the piece. The new right half takes over the right subtree and the priority of 'n', so the heap property still holds.
+        const int cut = pos - left_len;
+        const int m = TextDocNewPiece(doc, doc->Pieces.Data[n].InAdded, doc->Pieces.Data[n].Offset + cut, piece_len - cut); // May reallocate Pieces
+        ImGuiTextDocumentPiece* piece = &doc->Pieces.Data[n];
+        ImGuiTextDocumentPiece* piece_r = &doc->Pieces.Data[m];
+        piece_r->Priority = piece->Priority;
+        piece_r->Right = piece->Right;
+        piece->Right = -1;
+        piece->Length = cut;
+        TextDocUpdatePiece(doc, n);
+        TextDocUpdateSubtree(doc, n);
+        TextDocUpdateSubtree(doc, m);
+        *out_left = n;
+        *out_right = m;
+    }
+}
 
-    const ImVec2 pos = window->DC.CursorPos;
-    const float inputs_offset_x = (style.ColorButtonPosition == ImGuiDir_Left) ? w_button : 0.0f;
-    window->DC.CursorPos.x = pos.x + inputs_offset_x;
+static int TextDocMerge(ImGuiTextDocument* doc, int a, int b)
+{
+    if (a == -1 || b == -1)
+        return (a != -1) ? a : b;
+    if (doc->Pieces.Data[a].Priority > doc->Pieces.Data[b].Priority)
+    {
+        const int r = TextDocMerge(doc, doc->Pieces.Data[a].Right, b);
+        doc->Pieces.Data[a].Right = r;
+        TextDocUpdateSubtree(doc, a);
+        return a;
+    }
+    const int l = TextDocMerge(doc, a, doc->Pieces.Data[b].Left);
+    doc->Pieces.Data[b].Left = l;
+    TextDocUpdateSubtree(doc, b);
+    return b;
+}
 
-    if ((flags & (ImGuiColorEditFlags_DisplayRGB | ImGuiColorEditFlags_DisplayHSV)) != 0 && (flags & ImGuiColorEditFlags_NoInputs) == 0)
+// When typing, the previous insertion usually ends right where the new text goes: grow that piece instead of adding one.
+static bool TextDocExtendPieceEndingAt(ImGuiTextDocument* doc, int n, int pos, int added_offset, int added_len)
+{
+    if (n == -1)
+        return false;
+    ImGuiTextDocumentPiece* piece = &doc->Pieces.Data[n];
+    const int left_len = TextDocSubtreeLength(doc, piece->Left);
+    bool extended = false;
+    if (pos <= left_len)
+        extended = TextDocExtendPieceEndingAt(doc, piece->Left, pos, added_offset, added_len);
+    else if (pos > left_len + piece->Length)
+        extended = TextDocExtendPieceEndingAt(doc, piece->Right, pos - left_len - piece->Length, added_offset, added_len);
+    else if (pos == left_len + piece->Length && piece->InAdded && piece->Offset + piece->Length == added_offset)
     {
-        // RGB/HSV 0..255 Sliders
-        const float w_items = w_inputs - style.ItemInnerSpacing.x * (components - 1);
+        piece->Length += added_len;
+        TextDocUpdatePiece(doc, n);
+        extended = true;
+    }
+    if (extended)
+        TextDocUpdateSubtree(doc, n);
+    return extended;
+}
 
-        const bool hide_prefix = (IM_TRUNC(w_items / components) <= CalcTextSize((flags & ImGuiColorEditFlags_Float) ? "M:0.000" : "M:000").x);
-        static const char* ids[4] = { "##X", "##Y", "##Z", "##W" };
-        static const char* fmt_table_int[3][4] =
+static void TextDocCopy(const ImGuiTextDocument* doc, int n, int offset, int len, char* out)
+{
+    while (n != -1 && len > 0)
+    {
+        const ImGuiTextDocumentPiece* piece = &doc->Pieces.Data[n];
+        const int left_len = TextDocSubtreeLength(doc, piece->Left);
+        if (offset < left_len)
         {
-            {   "%3d",   "%3d",   "%3d",   "%3d" }, // Short display
-            { "R:%3d", "G:%3d", "B:%3d", "A:%3d" }, // Long display for RGBA
-            { "H:%3d", "S:%3d", "V:%3d", "A:%3d" }  // Long display for HSVA
-        };
-        static const char* fmt_table_float[3][4] =
+            const int copy_len = ImMin(len, left_len - offset);
+            TextDocCopy(doc, piece->Left, offset, copy_len, out);
+            out += copy_len;
+            offset += copy_len;
+            len -= copy_len;
+        }
+        const int offset_in_piece = offset - left_len;
+        if (len > 0 && offset_in_piece < piece->Length)
         {
-            {   "%0.3f",   "%0.3f",   "%0.3f",   "%0.3f" }, // Short display
-            { "R:%0.3f", "G:%0.3f", "B:%0.3f", "A:%0.3f" }, // Long display for RGBA
-            { "H:%0.3f", "S:%0.3f", "V:%0.3f", "A:%0.3f" }  // Long display for HSVA
-        };
-        const int fmt_idx = hide_prefix ? 0 : (flags & ImGuiColorEditFlags_DisplayHSV) ? 2 : 1;
+            const int copy_len = ImMin(len, piece->Length - offset_in_piece);
+            memcpy(out, (piece->InAdded ? doc->Added.Data : doc->Original.Data) + piece->Offset + offset_in_piece, (size_t)copy_len);
+            out += copy_len;
+            offset += copy_len;
+            len -= copy_len;
+        }
+        offset -= left_len + piece->Length;
+        n = piece->Right;
+    }
+}
 
-        float prev_split = 0.0f;
-        for (int n = 0; n < components; n++)
+void ImGuiTextDocument::SetText(const char* text, const char* text_end)
+{
+    if (text_end == NULL)
+        text_end = text + strlen(text);
+    const int len = (int)(text_end - text);
+    Original.resize(len);
+    if (len > 0)
+        memcpy(Original.Data, text, (size_t)len);
+    OriginalLineBreaks.resize(0);
+    TextDocIndexLineBreaks(&OriginalLineBreaks, Original.Data, 0, len);
+    Added.resize(0);
+    AddedLineBreaks.resize(0);
+    Pieces.resize(0);
+    PiecesFreeList.resize(0);
+    Root = (len > 0) ? TextDocNewPiece(this, false, 0, len) : -1;
+    Cursor = SelectionAnchor = 0;
+    PreferredX = -1.0f;
+    MaxLineWidth = 0.0f;
+}
+
+int ImGuiTextDocument::GetLineStart(int line_no) const
+{
+    if (line_no <= 0)
+        return 0;
+    int n = Root;
+    int base = 0;
+    int remaining = line_no; // Looking for the 'remaining'-th line break of subtree 'n'
+    while (n != -1)
+    {
+        const ImGuiTextDocumentPiece* piece = &Pieces.Data[n];
+        const int left_breaks = TextDocSubtreeLineBreaks(this, piece->Left);
+        if (remaining <= left_breaks)
         {
-            if (n > 0)
-                SameLine(0, style.ItemInnerSpacing.x);
-            float next_split = IM_TRUNC(w_items * (n + 1) / components);
-            SetNextItemWidth(ImMax(next_split - prev_split, 1.0f));
-            prev_split = next_split;
-
-            // FIXME: When ImGuiColorEditFlags_HDR flag is passed HS values snap in weird ways when SV values go below 0.
-            if (flags & ImGuiColorEditFlags_Float)
-            {
-                value_changed |= DragFloat(ids[n], &f[n], 1.0f / 255.0f, 0.0f, hdr ? 0.0f : 1.0f, fmt_table_float[fmt_idx][n]);
-                value_changed_as_float |= value_changed;
-            }
-            else
-            {
-                value_changed |= DragInt(ids[n], &i[n], 1.0f, 0, hdr ? 0 : 255, fmt_table_int[fmt_idx][n]);
-            }
-            if (!(flags & ImGuiColorEditFlags_NoOptions))
-                OpenPopupOnItemClick("context", ImGuiPopupFlags_MouseButtonRight);
+            n = piece->Left;
+            continue;
         }
+        remaining -= left_breaks;
+        base += TextDocSubtreeLength(this, piece->Left);
+        if (remaining <= piece->LineBreaks)
+        {
+            const ImVector<int>& breaks = piece->InAdded ? AddedLineBreaks : OriginalLineBreaks;
+            const int break_offset = breaks.Data[TextDocLowerBound(breaks, piece->Offset) + remaining - 1];
+            return base + (break_offset - piece->Offset) + 1;
+        }
+        remaining -= piece->LineBreaks;
+        base += piece->Length;
+        n = piece->Right;
     }
-    else if ((flags & ImGuiColorEditFlags_DisplayHex) != 0 && (flags & ImGuiColorEditFlags_NoInputs) == 0)
+    return GetLength();
+}
+
+int ImGuiTextDocument::GetLineFromOffset(int offset) const
+{
+    int n = Root;
+    int line_no = 0;
+    while (n != -1)
     {
-        // RGB Hexadecimal Input
-        char buf[64];
-        if (alpha)
-            ImFormatString(buf, IM_ARRAYSIZE(buf), "#%02X%02X%02X%02X", ImClamp(i[0], 0, 255), ImClamp(i[1], 0, 255), ImClamp(i[2], 0, 255), ImClamp(i[3], 0, 255));
-        else
-            ImFormatString(buf, IM_ARRAYSIZE(buf), "#%02X%02X%02X", ImClamp(i[0], 0, 255), ImClamp(i[1], 0, 255), ImClamp(i[2], 0, 255));
-        SetNextItemWidth(w_inputs);
-        if (InputText("##Text", buf, IM_ARRAYSIZE(buf), ImGuiInputTextFlags_CharsUppercase))
+        const ImGuiTextDocumentPiece* piece = &Pieces.Data[n];
+        const int left_len = TextDocSubtreeLength(this, piece->Left);
+        if (offset < left_len)
         {
-            value_changed = true;
-            char* p = buf;
+            n = piece->Left;
+            continue;
+        }
+        offset -= left_len;
+        line_no += TextDocSubtreeLineBreaks(this, piece->Left);
+        if (offset < piece->Length)
+        {
+            const ImVector<int>& breaks = piece->InAdded ? AddedLineBreaks : OriginalLineBreaks;
+            return line_no + TextDocLowerBound(breaks, piece->Offset + offset) - TextDocLowerBound(breaks, piece->Offset);
+        }
+        offset -= piece->Length;
+        line_no += piece->LineBreaks;
+        n = piece->Right;
+    }
+    return line_no;
+}
+
+char ImGuiTextDocument::GetChar(int offset) const
+{
+    int n = Root;
+    while (n != -1)
+    {
+        const ImGuiTextDocumentPiece* piece = &Pieces.Data[n];
+        const int left_len = TextDocSubtreeLength(this, piece->Left);
+        if (offset < left_len)
+        {
+            n = piece->Left;
+            continue;
+        }
+        offset -= left_len;
+        if (offset < piece->Length)
+            return (piece->InAdded ? Added.Data : Original.Data)[piece->Offset + offset];
+        offset -= piece->Length;
+        n = piece->Right;
+    }
+    return 0;
+}
+
+void ImGuiTextDocument::CopyText(int offset, int len, char* out) const
+{
+    IM_ASSERT(offset >= 0 && len >= 0 && offset + len <= GetLength());
+    TextDocCopy(this, Root, offset, len, out);
+}
+
+void ImGuiTextDocument::ExportText(ImVector<char>* out) const
+{
+    const int len = GetLength();
+    out->resize(len + 1);
+    TextDocCopy(this, Root, 0, len, out->Data);
+    out->Data[len] = 0;
+}
+
+void ImGuiTextDocument::InsertText(int offset, const char* text, int len)
+{
+    IM_ASSERT(offset >= 0 && offset <= GetLength());
+    if (len <= 0)
+        return;
+    const int added_offset = Added.Size;
+    Added.resize(Added.Size + len);
+    memcpy(Added.Data + added_offset, text, (size_t)len);
+    TextDocIndexLineBreaks(&AddedLineBreaks, Added.Data, added_offset, len);
+    if (TextDocExtendPieceEndingAt(this, Root, offset, added_offset, len))
+        return;
+    int left, right;
+    TextDocSplit(this, Root, offset, &left, &right);
+    const int n = TextDocNewPiece(this, true, added_offset, len);
+    Root = TextDocMerge(this, TextDocMerge(this, left, n), right);
+}
+
+void ImGuiTextDocument::DeleteText(int offset, int len)
+{
+    IM_ASSERT(offset >= 0 && len >= 0 && offset + len <= GetLength());
+    if (len <= 0)
+        return;
+    int left, middle, right;
+    TextDocSplit(this, Root, offset, &left, &right);
+    TextDocSplit(this, right, len, &middle, &right);
+    TextDocFreeSubtree(this, middle);
+    Root = TextDocMerge(this, left, right);
+}
+
+// Helpers for InputTextDocument(). Cursor movements step over whole UTF-8 sequences.
+static int TextDocPrevCharOffset(const ImGuiTextDocument* doc, int offset)
+{
+    if (offset <= 0)
+        return 0;
+    offset--;
+    for (int n = 0; n < 3 && offset > 0 && (doc->GetChar(offset) & 0xC0) == 0x80; n++)
+        offset--;
+    return offset;
+}
+
+static int TextDocNextCharOffset(const ImGuiTextDocument* doc, int offset)
+{
+    const int len = doc->GetLength();
+    if (offset >= len)
+        return len;
+    const unsigned char c = (unsigned char)doc->GetChar(offset);
+    const int char_len = (c < 0xC0) ? 1 : (c < 0xE0) ? 2 : (c < 0xF0) ? 3 : 4;
+    return ImMin(offset + char_len, len);
+}
+
+static bool TextDocIsWordChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || (c & 0x80) != 0;
+}
+
+static int TextDocWordLeft(const ImGuiTextDocument* doc, int offset)
+{
+    while (offset > 0 && !TextDocIsWordChar(doc->GetChar(offset - 1)))
+        offset--;
+    while (offset > 0 && TextDocIsWordChar(doc->GetChar(offset - 1)))
+        offset--;
+    return offset;
+}
+
+static int TextDocWordRight(const ImGuiTextDocument* doc, int offset)
+{
+    const int len = doc->GetLength();
+    while (offset < len && TextDocIsWordChar(doc->GetChar(offset)))
+        offset++;
+    while (offset < len && !TextDocIsWordChar(doc->GetChar(offset)))
+        offset++;
+    return offset;
+}
+
+// Copy [offset, offset + len) into doc->TempLine, zero-terminated
+static const char* TextDocFetch(ImGuiTextDocument* doc, int offset, int len)
+{
+    doc->TempLine.resize(len + 1);
+    doc->CopyText(offset, len, doc->TempLine.Data);
+    doc->TempLine.Data[len] = 0;
+    return doc->TempLine.Data;
+}
+
+// Horizontal position of 'offset' within its line
+static float TextDocCalcOffsetX(ImGuiTextDocument* doc, int line_start, int offset)
+{
+    ImGuiContext& g = *GImGui;
+    const char* text = TextDocFetch(doc, line_start, offset - line_start);
+    return g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, text, text + (offset - line_start)).x;
+}
+
+// Offset of the character boundary closest to 'x' within a line
+static int TextDocLocateX(ImGuiTextDocument* doc, int line_no, float x)
+{
+    ImGuiContext& g = *GImGui;
+    const int line_start = doc->GetLineStart(line_no);
+    const int line_len = doc->GetLineEnd(line_no) - line_start;
+    const char* text = TextDocFetch(doc, line_start, line_len);
+    const char* text_end = text + line_len;
+    const float scale = g.FontSize / g.Font->FontSize;
+    float line_x = 0.0f;
+    for (const char* s = text; s < text_end; )
+    {
+        unsigned int c;
+        const int char_len = ImTextCharFromUtf8(&c, s, text_end);
+        const float char_width = g.Font->GetCharAdvance((ImWchar)c) * scale;
+        if (x < line_x + char_width * 0.5f)
+            return line_start + (int)(s - text);
+        line_x += char_width;
+        s += char_len;
+    }
+    return line_start + line_len;
+}
+
+// Return true if the document was modified (false with an empty selection, e.g. Backspace at the start of the text)
+static bool TextDocDeleteSelection(ImGuiTextDocument* doc)
+{
+    const int sel_min = ImMin(doc->Cursor, doc->SelectionAnchor);
+    const int sel_max = ImMax(doc->Cursor, doc->SelectionAnchor);
+    doc->Cursor = doc->SelectionAnchor = sel_min;
+    if (sel_max == sel_min)
+        return false;
+    doc->DeleteText(sel_min, sel_max - sel_min);
+    return true;
+}
+
+static void TextDocReplaceSelection(ImGuiTextDocument* doc, const char* text, int len)
+{
+    if (doc->HasSelection())
+        TextDocDeleteSelection(doc);
+    doc->InsertText(doc->Cursor, text, len);
+    doc->Cursor = doc->SelectionAnchor = doc->Cursor + len;
+}
+
+// Multi-line editor for an ImGuiTextDocument. Return true when the document was edited this frame.
+// Only the visible lines are fetched, measured and rendered, so the cost per frame doesn't depend on the document size.
+bool ImGui::InputTextDocument(const char* label, ImGuiTextDocument* doc, const ImVec2& size_arg, ImGuiInputTextFlags flags)
+{
+    IM_ASSERT((flags & ~(ImGuiInputTextFlags_ReadOnly | ImGuiInputTextFlags_AllowTabInput)) == 0 && "InputTextDocument() only supports ImGuiInputTextFlags_ReadOnly and ImGuiInputTextFlags_AllowTabInput");
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    const ImGuiStyle& style = g.Style;
+
+    BeginGroup(); // Open group before calling GetID() because groups tracks id created within their scope (including the scrollbar)
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), g.FontSize * 8.0f + style.FramePadding.y * 2.0f);
+    const ImVec2 total_size = ImVec2(frame_size.x + (label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f), frame_size.y);
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Min + total_size);
+
+    ImVec2 backup_pos = window->DC.CursorPos;
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, id, &frame_bb, ImGuiItemFlags_Inputable))
+    {
+        EndGroup();
+        return false;
+    }
+    ImGuiLastItemData item_data_backup = g.LastItemData;
+    window->DC.CursorPos = backup_pos;
+
+    // Prevent NavActivate reactivating in BeginChild() when we are already active.
+    const ImGuiID backup_activate_id = g.NavActivateId;
+    if (g.ActiveId == id)
+        g.NavActivateId = 0;
+    PushStyleColor(ImGuiCol_ChildBg, style.Colors[ImGuiCol_FrameBg]);
+    PushStyleVar(ImGuiStyleVar_ChildRounding, style.FrameRounding);
+    PushStyleVar(ImGuiStyleVar_ChildBorderSize, style.FrameBorderSize);
+    PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0)); // Ensure no clip rect so mouse hover can reach FramePadding edges
+    bool child_visible = BeginChildEx(label, id, frame_bb.GetSize(), true, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_HorizontalScrollbar);
+    g.NavActivateId = backup_activate_id;
+    PopStyleVar(3);
+    PopStyleColor();
+    if (!child_visible)
+    {
+        EndChild();
+        EndGroup();
+        return false;
+    }
+    ImGuiWindow* draw_window = g.CurrentWindow;
+    draw_window->DC.NavLayersActiveMaskNext |= (1 << draw_window->DC.NavLayerCurrent);
+    draw_window->DC.CursorPos += style.FramePadding;
+    ImVec2 draw_pos = draw_window->DC.CursorPos; // Top-left of the first line, scrolled
+    const ImRect clip_rect = draw_window->InnerClipRect;
+
+    const bool hovered = ItemHoverable(frame_bb, id, g.LastItemData.InFlags);
+    if (hovered)
+        g.MouseCursor = ImGuiMouseCursor_TextInput;
+
+    if (g.LastItemData.InFlags & ImGuiItemFlags_ReadOnly)
+        flags |= ImGuiInputTextFlags_ReadOnly;
+    const bool is_readonly = (flags & ImGuiInputTextFlags_ReadOnly) != 0;
+    const bool is_osx = io.ConfigMacOSXBehaviors;
+    const float line_height = g.FontSize;
+    const bool user_clicked = hovered && io.MouseClicked[0];
+    const bool input_requested_by_nav = (g.ActiveId != id) && (g.NavActivateId == id);
+    bool clear_active_id = false;
+    bool value_changed = false;
+
+    doc->Cursor = ImClamp(doc->Cursor, 0, doc->GetLength());
+    doc->SelectionAnchor = ImClamp(doc->SelectionAnchor, 0, doc->GetLength());
+    if (g.ActiveId != id && (user_clicked || input_requested_by_nav))
+    {
+        SetActiveID(id, window);
+        SetFocusID(id, window);
+        FocusWindow(window);
+        doc->CursorAnim = -0.30f;
+    }
+    if (g.ActiveId == id)
+    {
+        if (user_clicked)
+            SetKeyOwner(ImGuiKey_MouseLeft, id);
+        g.ActiveIdUsingNavDirMask |= (1 << ImGuiDir_Left) | (1 << ImGuiDir_Right) | (1 << ImGuiDir_Up) | (1 << ImGuiDir_Down);
+        SetKeyOwner(ImGuiKey_Enter, id);
+        SetKeyOwner(ImGuiKey_KeypadEnter, id);
+        SetKeyOwner(ImGuiKey_Home, id);
+        SetKeyOwner(ImGuiKey_End, id);
+        SetKeyOwner(ImGuiKey_PageUp, id);
+        SetKeyOwner(ImGuiKey_PageDown, id);
+        if (io.MouseClicked[0] && !hovered)
+            clear_active_id = true;
+    }
+
+    // Mouse
+    if (g.ActiveId == id)
+    {
+        g.ActiveIdAllowOverlap = !io.MouseDown[0];
+        const ImVec2 mouse_local = io.MousePos - draw_pos;
+        const int mouse_line = ImClamp((int)ImFloor(mouse_local.y / line_height), 0, doc->GetLineCount() - 1);
+        if (user_clicked || (io.MouseDown[0] && !io.MouseClicked[0] && (io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f)))
+        {
+            doc->Cursor = TextDocLocateX(doc, mouse_line, mouse_local.x);
+            if (user_clicked && io.MouseClickedCount[0] == 2)
+            {
+                doc->SelectionAnchor = TextDocWordLeft(doc, TextDocNextCharOffset(doc, doc->Cursor));
+                doc->Cursor = TextDocWordRight(doc, doc->SelectionAnchor);
+            }
+            else if (user_clicked && !io.KeyShift)
+            {
+                doc->SelectionAnchor = doc->Cursor;
+            }
+            doc->PreferredX = -1.0f;
+            doc->CursorAnim = -0.30f;
+            doc->CursorFollow = !user_clicked;
+        }
+    }
+
+    // Keyboard
+    if (g.ActiveId == id && !g.ActiveIdIsJustActivated && !clear_active_id)
+    {
+        const int cursor_backup = doc->Cursor;
+        const bool is_wordmove_key_down = is_osx ? io.KeyAlt : io.KeyCtrl;
+        const int rows_per_page = ImMax((int)((clip_rect.GetHeight() - style.FramePadding.y) / line_height), 1);
+        const ImGuiInputFlags f_repeat = ImGuiInputFlags_Repeat;
+        const bool is_cut   = (Shortcut(ImGuiMod_Ctrl | ImGuiKey_X, f_repeat, id) || Shortcut(ImGuiMod_Shift | ImGuiKey_Delete, f_repeat, id)) && !is_readonly && doc->HasSelection();
+        const bool is_copy  = (Shortcut(ImGuiMod_Ctrl | ImGuiKey_C, 0, id) || Shortcut(ImGuiMod_Ctrl | ImGuiKey_Insert, 0, id)) && doc->HasSelection();
+        const bool is_paste = (Shortcut(ImGuiMod_Ctrl | ImGuiKey_V, f_repeat, id) || Shortcut(ImGuiMod_Shift | ImGuiKey_Insert, f_repeat, id)) && !is_readonly;
+        const bool is_select_all = Shortcut(ImGuiMod_Ctrl | ImGuiKey_A, 0, id);
+        bool keep_preferred_x = false;
+        bool move_selects = io.KeyShift;
+
+        if (IsKeyPressed(ImGuiKey_LeftArrow))
+            doc->Cursor = (doc->HasSelection() && !io.KeyShift) ? ImMin(doc->Cursor, doc->SelectionAnchor) : is_wordmove_key_down ? TextDocWordLeft(doc, doc->Cursor) : TextDocPrevCharOffset(doc, doc->Cursor);
+        else if (IsKeyPressed(ImGuiKey_RightArrow))
+            doc->Cursor = (doc->HasSelection() && !io.KeyShift) ? ImMax(doc->Cursor, doc->SelectionAnchor) : is_wordmove_key_down ? TextDocWordRight(doc, doc->Cursor) : TextDocNextCharOffset(doc, doc->Cursor);
+        else if (IsKeyPressed(ImGuiKey_UpArrow) || IsKeyPressed(ImGuiKey_DownArrow) || IsKeyPressed(ImGuiKey_PageUp) || IsKeyPressed(ImGuiKey_PageDown))
+        {
+            const int line_no = doc->GetLineFromOffset(doc->Cursor);
+            const int line_delta = IsKeyPressed(ImGuiKey_UpArrow) ? -1 : IsKeyPressed(ImGuiKey_DownArrow) ? +1 : IsKeyPressed(ImGuiKey_PageUp) ? -rows_per_page : +rows_per_page;
+            const int new_line_no = ImClamp(line_no + line_delta, 0, doc->GetLineCount() - 1);
+            if (doc->PreferredX < 0.0f)
+                doc->PreferredX = TextDocCalcOffsetX(doc, doc->GetLineStart(line_no), doc->Cursor);
+            doc->Cursor = TextDocLocateX(doc, new_line_no, doc->PreferredX);
+            keep_preferred_x = true;
+        }
+        else if (IsKeyPressed(ImGuiKey_Home))
+            doc->Cursor = io.KeyCtrl ? 0 : doc->GetLineStart(doc->GetLineFromOffset(doc->Cursor));
+        else if (IsKeyPressed(ImGuiKey_End))
+            doc->Cursor = io.KeyCtrl ? doc->GetLength() : doc->GetLineEnd(doc->GetLineFromOffset(doc->Cursor));
+        else if (IsKeyPressed(ImGuiKey_Delete) && !is_readonly && !is_cut)
+        {
+            if (!doc->HasSelection())
+                doc->SelectionAnchor = is_wordmove_key_down ? TextDocWordRight(doc, doc->Cursor) : TextDocNextCharOffset(doc, doc->Cursor);
+            value_changed |= TextDocDeleteSelection(doc);
+        }
+        else if (IsKeyPressed(ImGuiKey_Backspace) && !is_readonly)
+        {
+            if (!doc->HasSelection())
+                doc->SelectionAnchor = is_wordmove_key_down ? TextDocWordLeft(doc, doc->Cursor) : TextDocPrevCharOffset(doc, doc->Cursor);
+            value_changed |= TextDocDeleteSelection(doc);
+        }
+        else if ((IsKeyPressed(ImGuiKey_Enter) || IsKeyPressed(ImGuiKey_KeypadEnter)) && !is_readonly)
+        {
+            TextDocReplaceSelection(doc, "\n", 1);
+            value_changed = true;
+        }
+        else if ((flags & ImGuiInputTextFlags_AllowTabInput) && !is_readonly && Shortcut(ImGuiKey_Tab, f_repeat, id))
+        {
+            TextDocReplaceSelection(doc, "\t", 1);
+            value_changed = true;
+        }
+        else if (Shortcut(ImGuiKey_Escape, 0, id))
+        {
+            clear_active_id = true;
+        }
+        else if (is_select_all)
+        {
+            doc->SelectionAnchor = 0;
+            doc->Cursor = doc->GetLength();
+            move_selects = true;
+        }
+        else if (is_cut || is_copy)
+        {
+            const int sel_min = ImMin(doc->Cursor, doc->SelectionAnchor);
+            const int sel_max = ImMax(doc->Cursor, doc->SelectionAnchor);
+            if (io.SetClipboardTextFn)
+            {
+                // Not using TextDocFetch(): TempLine would keep the size of the largest selection ever copied
+                char* clipboard_data = (char*)MemAllocFrame((size_t)(sel_max - sel_min) + 1);
+                doc->CopyText(sel_min, sel_max - sel_min, clipboard_data);
+                clipboard_data[sel_max - sel_min] = 0;
+                SetClipboardText(clipboard_data);
+            }
+            if (is_cut)
+                value_changed |= TextDocDeleteSelection(doc);
+        }
+        else if (is_paste)
+        {
+            if (const char* clipboard = GetClipboardText())
+                if (clipboard[0] != 0)
+                {
+                    TextDocReplaceSelection(doc, clipboard, (int)strlen(clipboard));
+                    value_changed = true;
+                }
+        }
+
+        // Process regular text input. We ignore CTRL inputs, but need to allow ALT+CTRL as some keyboards (e.g. German) use AltGR (which _is_ Alt+Ctrl) to input certain characters.
+        const bool ignore_char_inputs = (io.KeyCtrl && !io.KeyAlt) || (is_osx && io.KeyCtrl);
+        if (!ignore_char_inputs && !is_readonly)
+            for (int n = 0; n < io.InputQueueCharacters.Size; n++)
+            {
+                const unsigned int c = (unsigned int)io.InputQueueCharacters[n];
+                if (c < 0x20 || c == 0x7F) // Tab, Enter and control characters are handled above
+                    continue;
+                char utf8[5];
+                ImTextCharToUtf8(utf8, c);
+                TextDocReplaceSelection(doc, utf8, (int)strlen(utf8));
+                value_changed = true;
+            }
+        io.InputQueueCharacters.resize(0);
+
+        if (doc->Cursor != cursor_backup || value_changed)
+        {
+            if (!move_selects && !value_changed)
+                doc->SelectionAnchor = doc->Cursor;
+            if (!keep_preferred_x)
+                doc->PreferredX = -1.0f;
+            doc->CursorAnim = -0.30f;
+            doc->CursorFollow = true;
+        }
+    }
+
+    // Scroll to cursor
+    const int line_count = doc->GetLineCount();
+    const int cursor_line = doc->GetLineFromOffset(doc->Cursor);
+    if (doc->CursorFollow && g.ActiveId == id)
+    {
+        const float cursor_x = TextDocCalcOffsetX(doc, doc->GetLineStart(cursor_line), doc->Cursor);
+        const float cursor_y = cursor_line * line_height;
+        const float visible_w = clip_rect.GetWidth() - style.FramePadding.x * 2.0f;
+        const float visible_h = clip_rect.GetHeight() - style.FramePadding.y * 2.0f;
+        ImVec2 scroll = draw_window->Scroll;
+        if (cursor_y < scroll.y)
+            scroll.y = cursor_y;
+        else if (cursor_y + line_height > scroll.y + visible_h)
+            scroll.y = cursor_y + line_height - visible_h;
+        if (cursor_x < scroll.x)
+            scroll.x = ImMax(0.0f, cursor_x - visible_w * 0.25f);
+        else if (cursor_x > scroll.x + visible_w)
+            scroll.x = cursor_x - visible_w * 0.75f;
+        scroll.x = ImMax(IM_TRUNC(scroll.x), 0.0f);
+        scroll.y = ImMax(IM_TRUNC(scroll.y), 0.0f);
+        draw_pos -= scroll - draw_window->Scroll; // Manipulate cursor pos immediately avoid a frame of lag
+        draw_window->Scroll = scroll;
+        doc->MaxLineWidth = ImMax(doc->MaxLineWidth, cursor_x + style.FramePadding.x);
+        doc->CursorFollow = false;
+    }
+
+    if (g.ActiveId == id && clear_active_id)
+        ClearActiveID();
+    else if (g.ActiveId == id)
+        g.WantTextInputNextFrame = 1;
+
+    // Render visible lines, with selection
+    const int line_visible_min = ImClamp((int)ImFloor((clip_rect.Min.y - draw_pos.y) / line_height), 0, line_count - 1);
+    const int line_visible_max = ImClamp((int)ImCeil((clip_rect.Max.y - draw_pos.y) / line_height), 0, line_count - 1);
+    const bool render_cursor = (g.ActiveId == id);
+    const int sel_min = ImMin(doc->Cursor, doc->SelectionAnchor);
+    const int sel_max = ImMax(doc->Cursor, doc->SelectionAnchor);
+    const ImU32 col_text = GetColorU32(ImGuiCol_Text);
+    const ImU32 col_selection = GetColorU32(ImGuiCol_TextSelectedBg);
+    const ImVec4 clip_rect_v4 = clip_rect.ToVec4();
+    int line_start = doc->GetLineStart(line_visible_min);
+    for (int line_no = line_visible_min; line_no <= line_visible_max; line_no++)
+    {
+        const int line_end = doc->GetLineEnd(line_no);
+        const ImVec2 line_pos(draw_pos.x, draw_pos.y + line_no * line_height);
+        const char* text = TextDocFetch(doc, line_start, line_end - line_start);
+        const char* text_end = text + (line_end - line_start);
+        if (render_cursor && sel_min < sel_max && sel_min <= line_end && sel_max >= line_start)
+        {
+            const int sel_line_min = ImMax(sel_min, line_start);
+            const int sel_line_max = ImMin(sel_max, line_end);
+            float x0 = g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, text, text + (sel_line_min - line_start)).x;
+            float x1 = g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, text, text + (sel_line_max - line_start)).x;
+            if (sel_max > line_end)
+                x1 += IM_TRUNC(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected line breaks
+            draw_window->DrawList->AddRectFilled(ImVec2(line_pos.x + x0, line_pos.y), ImVec2(line_pos.x + x1, line_pos.y + line_height), col_selection);
+        }
+        draw_window->DrawList->AddText(g.Font, g.FontSize, line_pos, col_text, text, text_end, 0.0f, &clip_rect_v4);
+        if (text_end - text < 4096) // Measuring is only for the scrollbar: don't bother with pathological lines
+            doc->MaxLineWidth = ImMax(doc->MaxLineWidth, g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, text, text_end).x + style.FramePadding.x);
+        line_start = line_end + 1;
+    }
+
+    // Render cursor
+    if (render_cursor && cursor_line >= line_visible_min && cursor_line <= line_visible_max)
+    {
+        doc->CursorAnim += io.DeltaTime;
+        const bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (doc->CursorAnim <= 0.0f) || ImFmod(doc->CursorAnim, 1.20f) <= 0.80f;
+        const ImVec2 cursor_screen_pos = ImTrunc(ImVec2(draw_pos.x + TextDocCalcOffsetX(doc, doc->GetLineStart(cursor_line), doc->Cursor), draw_pos.y + cursor_line * line_height));
+        if (cursor_is_visible)
+            draw_window->DrawList->AddLine(ImVec2(cursor_screen_pos.x, cursor_screen_pos.y + 0.5f), ImVec2(cursor_screen_pos.x, cursor_screen_pos.y + line_height - 1.5f), col_text);
+        if (!is_readonly)
+        {
+            g.PlatformImeData.WantVisible = true;
+            g.PlatformImeData.InputPos = ImVec2(cursor_screen_pos.x - 1.0f, cursor_screen_pos.y);
+            g.PlatformImeData.InputLineHeight = line_height;
+            g.PlatformImeViewport = window->Viewport->ID;
+        }
+    }
+
+    // Declare content size for scrolling, then undo the group overriding last item data (same as InputTextEx()).
+    Dummy(ImVec2(doc->MaxLineWidth, line_count * line_height + style.FramePadding.y));
+    g.NextItemData.ItemFlags |= ImGuiItemFlags_Inputable | ImGuiItemFlags_NoTabStop;
+    EndChild();
+    item_data_backup.StatusFlags |= (g.LastItemData.StatusFlags & ImGuiItemStatusFlags_HoveredWindow);
+    EndGroup();
+    if (g.LastItemData.ID == 0)
+    {
+        g.LastItemData.ID = id;
+        g.LastItemData.InFlags = item_data_backup.InFlags;
+        g.LastItemData.StatusFlags = item_data_backup.StatusFlags;
+    }
+
+    if (label_size.x > 0)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, frame_bb.Min.y + style.FramePadding.y), label);
+
+    if (value_changed)
+        MarkItemEdited(id);
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Inputable);
+    return value_changed;
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
+//-------------------------------------------------------------------------
+// - ColorEdit3()
+// - ColorEdit4()
+// - ColorPicker3()
+// - RenderColorRectWithAlphaCheckerboard() [Internal]
+// - ColorPicker4()
+// - ColorButton()
+// - SetColorEditOptions()
+// - ColorTooltip() [Internal]
+// - ColorEditOptionsPopup() [Internal]
+// - ColorPickerOptionsPopup() [Internal]
+//-------------------------------------------------------------------------
+
+bool ImGui::ColorEdit3(const char* label, float col[3], ImGuiColorEditFlags flags)
+{
+    return ColorEdit4(label, col, flags | ImGuiColorEditFlags_NoAlpha);
+}
+
+static void ColorEditRestoreH(const float* col, float* H)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.ColorEditCurrentID != 0);
+    if (g.ColorEditSavedID != g.ColorEditCurrentID || g.ColorEditSavedColor != ImGui::ColorConvertFloat4ToU32(ImVec4(col[0], col[1], col[2], 0)))
+        return;
+    *H = g.ColorEditSavedHue;
+}
+
+// ColorEdit supports RGB and HSV inputs. In case of RGB input resulting color may have undefined hue and/or saturation.
+// Since widget displays both RGB and HSV values we must preserve hue and saturation to prevent these values resetting.
+static void ColorEditRestoreHS(const float* col, float* H, float* S, float* V)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.ColorEditCurrentID != 0);
+    if (g.ColorEditSavedID != g.ColorEditCurrentID || g.ColorEditSavedColor != ImGui::ColorConvertFloat4ToU32(ImVec4(col[0], col[1], col[2], 0)))
+        return;
+
+    // When S == 0, H is undefined.
+    // When H == 1 it wraps around to 0.
+    if (*S == 0.0f || (*H == 0.0f && g.ColorEditSavedHue == 1))
+        *H = g.ColorEditSavedHue;
+
+    // When V == 0, S is undefined.
+    if (*V == 0.0f)
+        *S = g.ColorEditSavedSat;
+}
+
+// Edit colors components (each component in 0.0f..1.0f range).
+// See enum ImGuiColorEditFlags_ for available options. e.g. Only access 3 floats if ImGuiColorEditFlags_NoAlpha flag is set.
+// With typical options: Left-click on color square to open color picker. Right-click to open option menu. CTRL-Click over input fields to edit them and TAB to go to next item.
+bool ImGui::ColorEdit4(const char* label, float col[4], ImGuiColorEditFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+    const float square_sz = GetFrameHeight();
+    const char* label_display_end = FindRenderedTextEnd(label);
+    float w_full = CalcItemWidth();
+    g.NextItemData.ClearFlags();
+
+    BeginGroup();
+    PushID(label);
+    const bool set_current_color_edit_id = (g.ColorEditCurrentID == 0);
+    if (set_current_color_edit_id)
+        g.ColorEditCurrentID = window->IDStack.back();
+
+    // If we're not showing any slider there's no point in doing any HSV conversions
+    const ImGuiColorEditFlags flags_untouched = flags;
+    if (flags & ImGuiColorEditFlags_NoInputs)
+        flags = (flags & (~ImGuiColorEditFlags_DisplayMask_)) | ImGuiColorEditFlags_DisplayRGB | ImGuiColorEditFlags_NoOptions;
+
+    // Context menu: display and modify options (before defaults are applied)
+    if (!(flags & ImGuiColorEditFlags_NoOptions))
+        ColorEditOptionsPopup(col, flags);
+
+    // Read stored options
+    if (!(flags & ImGuiColorEditFlags_DisplayMask_))
+        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_DisplayMask_);
+    if (!(flags & ImGuiColorEditFlags_DataTypeMask_))
+        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_DataTypeMask_);
+    if (!(flags & ImGuiColorEditFlags_PickerMask_))
+        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_PickerMask_);
+    if (!(flags & ImGuiColorEditFlags_InputMask_))
+        flags |= (g.ColorEditOptions & ImGuiColorEditFlags_InputMask_);
+    flags |= (g.ColorEditOptions & ~(ImGuiColorEditFlags_DisplayMask_ | ImGuiColorEditFlags_DataTypeMask_ | ImGuiColorEditFlags_PickerMask_ | ImGuiColorEditFlags_InputMask_));
+    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags_DisplayMask_)); // Check that only 1 is selected
+    IM_ASSERT(ImIsPowerOfTwo(flags & ImGuiColorEditFlags_InputMask_));   // Check that only 1 is selected
+
+    const bool alpha = (flags & ImGuiColorEditFlags_NoAlpha) == 0;
+    const bool hdr = (flags & ImGuiColorEditFlags_HDR) != 0;
+    const int components = alpha ? 4 : 3;
+    const float w_button = (flags & ImGuiColorEditFlags_NoSmallPreview) ? 0.0f : (square_sz + style.ItemInnerSpacing.x);
+    const float w_inputs = ImMax(w_full - w_button, 1.0f);
+    w_full = w_inputs + w_button;
+
+    // Convert to the formats we need
+    float f[4] = { col[0], col[1], col[2], alpha ? col[3] : 1.0f };
+    if ((flags & ImGuiColorEditFlags_InputHSV) && (flags & ImGuiColorEditFlags_DisplayRGB))
+        ColorConvertHSVtoRGB(f[0], f[1], f[2], f[0], f[1], f[2]);
+    else if ((flags & ImGuiColorEditFlags_InputRGB) && (flags & ImGuiColorEditFlags_DisplayHSV))
+    {
+        // Hue is lost when converting from grayscale rgb (saturation=0). Restore it.
+        ColorConvertRGBtoHSV(f[0], f[1], f[2], f[0], f[1], f[2]);
+        ColorEditRestoreHS(col, &f[0], &f[1], &f[2]);
+    }
+    int i[4] = { IM_F32_TO_INT8_UNBOUND(f[0]), IM_F32_TO_INT8_UNBOUND(f[1]), IM_F32_TO_INT8_UNBOUND(f[2]), IM_F32_TO_INT8_UNBOUND(f[3]) };
+
+    bool value_changed = false;
+    bool value_changed_as_float = false;
+
+    const ImVec2 pos = window->DC.CursorPos;
+    const float inputs_offset_x = (style.ColorButtonPosition == ImGuiDir_Left) ? w_button : 0.0f;
+    window->DC.CursorPos.x = pos.x + inputs_offset_x;
+
+    if ((flags & (ImGuiColorEditFlags_DisplayRGB | ImGuiColorEditFlags_DisplayHSV)) != 0 && (flags & ImGuiColorEditFlags_NoInputs) == 0)
+    {
+        // RGB/HSV 0..255 Sliders
+        const float w_items = w_inputs - style.ItemInnerSpacing.x * (components - 1);
+
+        const bool hide_prefix = (IM_TRUNC(w_items / components) <= CalcTextSize((flags & ImGuiColorEditFlags_Float) ? "M:0.000" : "M:000").x);
+        static const char* ids[4] = { "##X", "##Y", "##Z", "##W" };
+        static const char* fmt_table_int[3][4] =
+        {
+            {   "%3d",   "%3d",   "%3d",   "%3d" }, // Short display
+            { "R:%3d", "G:%3d", "B:%3d", "A:%3d" }, // Long display for RGBA
+            { "H:%3d", "S:%3d", "V:%3d", "A:%3d" }  // Long display for HSVA
+        };
+        static const char* fmt_table_float[3][4] =
+        {
+            {   "%0.3f",   "%0.3f",   "%0.3f",   "%0.3f" }, // Short display
+            { "R:%0.3f", "G:%0.3f", "B:%0.3f", "A:%0.3f" }, // Long display for RGBA
+            { "H:%0.3f", "S:%0.3f", "V:%0.3f", "A:%0.3f" }  // Long display for HSVA
+        };
+        const int fmt_idx = hide_prefix ? 0 : (flags & ImGuiColorEditFlags_DisplayHSV) ? 2 : 1;
+
+        float prev_split = 0.0f;
+        for (int n = 0; n < components; n++)
+        {
+            if (n > 0)
+                SameLine(0, style.ItemInnerSpacing.x);
+            float next_split = IM_TRUNC(w_items * (n + 1) / components);
+            SetNextItemWidth(ImMax(next_split - prev_split, 1.0f));
+            prev_split = next_split;
+
+            // FIXME: When ImGuiColorEditFlags_HDR flag is passed HS values snap in weird ways when SV values go below 0.
+            if (flags & ImGuiColorEditFlags_Float)
+            {
+                value_changed |= DragFloat(ids[n], &f[n], 1.0f / 255.0f, 0.0f, hdr ? 0.0f : 1.0f, fmt_table_float[fmt_idx][n]);
+                value_changed_as_float |= value_changed;
+            }
+            else
+            {
+                value_changed |= DragInt(ids[n], &i[n], 1.0f, 0, hdr ? 0 : 255, fmt_table_int[fmt_idx][n]);
+            }
+            if (!(flags & ImGuiColorEditFlags_NoOptions))
+                OpenPopupOnItemClick("context", ImGuiPopupFlags_MouseButtonRight);
+        }
+    }
+    else if ((flags & ImGuiColorEditFlags_DisplayHex) != 0 && (flags & ImGuiColorEditFlags_NoInputs) == 0)
+    {
+        // RGB Hexadecimal Input
+        char buf[64];
+        if (alpha)
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "#%02X%02X%02X%02X", ImClamp(i[0], 0, 255), ImClamp(i[1], 0, 255), ImClamp(i[2], 0, 255), ImClamp(i[3], 0, 255));
+        else
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "#%02X%02X%02X", ImClamp(i[0], 0, 255), ImClamp(i[1], 0, 255), ImClamp(i[2], 0, 255));
+        SetNextItemWidth(w_inputs);
+        if (InputText("##Text", buf, IM_ARRAYSIZE(buf), ImGuiInputTextFlags_CharsUppercase))
+        {
+            value_changed = true;
+            char* p = buf;
             while (*p == '#' || ImCharIsBlankA(*p))
                 p++;
             i[0] = i[1] = i[2] = 0;
@@ -6574,6 +7523,293 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
     return is_open;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: VirtualTree
+//-------------------------------------------------------------------------
+// - ImGuiVirtualTree [Internal]
+// - VirtualTreeRowBehavior() [Internal]
+// - VirtualTree() [Internal]
+//-------------------------------------------------------------------------
+
+void ImGuiVirtualTree::Clear()
+{
+    Nodes.resize(0);
+    VisibleRows.resize(0);
+    VisibleRowsDirty = false;
+    SelectedNode = -1;
+}
+
+int ImGuiVirtualTree::AddChild(int parent_n, ImU64 user_id, bool has_children)
+{
+    ImGuiVirtualTreeNode* parent = &Nodes[parent_n];
+    IM_ASSERT(!parent->IsLoaded && "Children were already loaded!");
+    IM_ASSERT((parent->ChildrenCount == 0 || parent->ChildrenStart + parent->ChildrenCount == Nodes.Size) && "All children of a node need to be added before adding children to another node!");
+    IM_ASSERT(parent->Depth < IM_S16_MAX - 1);
+    if (parent->ChildrenCount == 0)
+        parent->ChildrenStart = Nodes.Size;
+    parent->ChildrenCount++;
+
+    ImGuiVirtualTreeNode node;
+    memset(&node, 0, sizeof(node));
+    node.UserID = user_id;
+    node.Parent = parent_n;
+    node.Depth = (ImS16)(parent->Depth + 1);
+    node.HasChildren = has_children ? 1 : 0;
+    Nodes.push_back(node); // 'parent' is invalidated
+    return Nodes.Size - 1;
+}
+
+bool ImGuiVirtualTree::IsNodeVisible(int node_n) const
+{
+    for (int parent_n = Nodes[node_n].Parent; parent_n != -1; parent_n = Nodes[parent_n].Parent)
+        if (!Nodes[parent_n].IsOpen || !Nodes[parent_n].IsLoaded)
+            return false;
+    return true;
+}
+
+int ImGuiVirtualTree::FindVisibleRow(int node_n)
+{
+    if (node_n == 0 || !IsNodeVisible(node_n))
+        return -1;
+    UpdateVisibleRows();
+    for (int row_n = 0; row_n < VisibleRows.Size; row_n++)
+        if (VisibleRows[row_n] == node_n)
+            return row_n;
+    return -1;
+}
+
+// Insert rows for the children of an open node, and recursively for children of open children (which kept their open state when their parent got closed).
+static void VirtualTreeInsertChildrenRows(ImGuiVirtualTree* tree, int node_n, int row_n)
+{
+    ImVector<int>& rows = tree->TempRows;
+    ImVector<int>& stack = tree->TempStack;
+    rows.resize(0);
+    stack.resize(0);
+    stack.push_back(node_n);
+    while (stack.Size > 0)
+    {
+        const int parent_n = stack.back();
+        stack.pop_back();
+        if (parent_n != node_n)
+            rows.push_back(parent_n);
+        const ImGuiVirtualTreeNode* parent = &tree->Nodes[parent_n];
+        if (parent->IsOpen && parent->IsLoaded)
+            for (int child_n = parent->ChildrenStart + parent->ChildrenCount - 1; child_n >= parent->ChildrenStart; child_n--)
+                stack.push_back(child_n);
+    }
+    if (rows.Size == 0)
+        return;
+
+    ImVector<int>& visible_rows = tree->VisibleRows;
+    const int insert_at = row_n + 1;
+    const int move_count = visible_rows.Size - insert_at;
+    visible_rows.resize(visible_rows.Size + rows.Size);
+    memmove(visible_rows.Data + insert_at + rows.Size, visible_rows.Data + insert_at, (size_t)move_count * sizeof(int));
+    memcpy(visible_rows.Data + insert_at, rows.Data, (size_t)rows.Size * sizeof(int));
+}
+
+// Remove rows following a node which was just closed, up to the next row which isn't one of its descendants.
+static void VirtualTreeRemoveChildrenRows(ImGuiVirtualTree* tree, int node_n, int row_n)
+{
+    ImVector<int>& visible_rows = tree->VisibleRows;
+    const int depth = tree->Nodes[node_n].Depth;
+    const int remove_start = row_n + 1;
+    int remove_end = remove_start;
+    while (remove_end < visible_rows.Size && tree->Nodes[visible_rows[remove_end]].Depth > depth)
+        remove_end++;
+    if (remove_end == remove_start)
+        return;
+    memmove(visible_rows.Data + remove_start, visible_rows.Data + remove_end, (size_t)(visible_rows.Size - remove_end) * sizeof(int));
+    visible_rows.resize(visible_rows.Size - (remove_end - remove_start));
+}
+
+// Rows are inserted by the next UpdateVisibleRows(): looking up the node's row then inserting its children would make
+// each completed load O(visible rows).
+void ImGuiVirtualTree::EndLoadChildren(int node_n)
+{
+    ImGuiVirtualTreeNode* node = &Nodes[node_n];
+    IM_ASSERT(!node->IsLoaded);
+    node->IsLoading = false;
+    node->IsLoaded = true;
+    if (node->IsOpen && IsNodeVisible(node_n))
+        VisibleRowsDirty = true;
+}
+
+void ImGuiVirtualTree::UpdateVisibleRows()
+{
+    if (!VisibleRowsDirty)
+        return;
+    VisibleRowsDirty = false;
+    VisibleRows.resize(0);
+    if (Nodes.Size > 0)
+        VirtualTreeInsertChildrenRows(this, 0, -1);
+}
+
+void ImGuiVirtualTree::SetNodeOpen(int node_n, bool open, int row_n)
+{
+    ImGuiVirtualTreeNode* node = &Nodes[node_n];
+    if (node->IsOpen == (open ? 1 : 0))
+        return;
+    node->IsOpen = open;
+    if (open && !node->IsLoaded)
+    {
+        // Children will be inserted by EndLoadChildren()
+        if (!node->IsLoading)
+        {
+            node->IsLoading = true;
+            if (LoadChildren == NULL || LoadChildren(UserData, this, node_n))
+                EndLoadChildren(node_n);
+        }
+        return;
+    }
+    if (!node->IsLoaded || !IsNodeVisible(node_n))
+        return;
+    if (VisibleRowsDirty)
+    {
+        UpdateVisibleRows(); // Also applies the new open state
+        return;
+    }
+
+    if (node_n == 0)
+        row_n = -1;
+    else if (row_n < 0 || row_n >= VisibleRows.Size || VisibleRows[row_n] != node_n)
+        row_n = FindVisibleRow(node_n);
+    IM_ASSERT(node_n == 0 || row_n != -1);
+    if (open)
+        VirtualTreeInsertChildrenRows(this, node_n, row_n);
+    else
+        VirtualTreeRemoveChildrenRows(this, node_n, row_n);
+}
+
+// Simplified TreeNodeBehavior() for a node of an ImGuiVirtualTree: open state is read from the node instead of ImGuiStorage.
+// - Single-click on arrow, double-click or activation (Enter/Space) toggles open state. Left/Right keys close/open the node.
+// - Single-click selects the node.
+static bool VirtualTreeRowBehavior(ImGuiVirtualTree* tree, int node_n, const char* label, bool* out_toggled)
+{
+    using namespace ImGui;
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    const ImGuiStyle& style = g.Style;
+    const ImGuiVirtualTreeNode* node = &tree->Nodes[node_n];
+    const ImGuiID id = window->GetID(node_n);
+    const bool is_leaf = !node->HasChildren || (node->IsLoaded && node->ChildrenCount == 0);
+    const bool is_open = node->IsOpen && !is_leaf;
+    const bool selected = (tree->SelectedNode == node_n);
+
+    const ImVec2 padding = ImVec2(style.FramePadding.x, ImMin(window->DC.CurrLineTextBaseOffset, style.FramePadding.y));
+    const ImVec2 label_size = CalcTextSize(label, NULL, false);
+    const float text_offset_x = g.FontSize + padding.x * 2;                 // Collapsing arrow width + Spacing
+    const float text_offset_y = ImMax(padding.y, window->DC.CurrLineTextBaseOffset);
+    const float text_width = g.FontSize + label_size.x + padding.x * 2;     // Include collapsing arrow
+    const float frame_height = ImMax(ImMin(window->DC.CurrLineSize.y, g.FontSize + style.FramePadding.y * 2), label_size.y + padding.y * 2);
+
+    // Indent by depth without TreePush(): ItemSize() sets the cursor back to the start of the line.
+    window->DC.CursorPos.x += node->Depth * style.IndentSpacing;
+    ImRect frame_bb(window->WorkRect.Min.x, window->DC.CursorPos.y, window->WorkRect.Max.x, window->DC.CursorPos.y + frame_height);
+    ImVec2 text_pos(window->DC.CursorPos.x + text_offset_x, window->DC.CursorPos.y + text_offset_y);
+    ItemSize(ImVec2(text_width, frame_height), padding.y);
+    *out_toggled = false;
+    if (!ItemAdd(frame_bb, id))
+        return false;
+
+    const float arrow_hit_x1 = (text_pos.x - text_offset_x) - style.TouchExtraPadding.x;
+    const float arrow_hit_x2 = (text_pos.x - text_offset_x) + (g.FontSize + padding.x * 2.0f) + style.TouchExtraPadding.x;
+    const bool is_mouse_x_over_arrow = (g.IO.MousePos.x >= arrow_hit_x1 && g.IO.MousePos.x < arrow_hit_x2);
+    ImGuiButtonFlags button_flags = ImGuiButtonFlags_NoKeyModifiers;
+    if (is_mouse_x_over_arrow && !is_leaf)
+        button_flags |= ImGuiButtonFlags_PressedOnClick;
+    else
+        button_flags |= ImGuiButtonFlags_PressedOnClickRelease | ImGuiButtonFlags_PressedOnDoubleClick;
+
+    bool hovered, held;
+    bool pressed = ButtonBehavior(frame_bb, id, &hovered, &held, button_flags);
+    if (!is_leaf)
+    {
+        bool toggled = false;
+        if (pressed && ((is_mouse_x_over_arrow && !g.NavDisableMouseHover) || g.IO.MouseClickedCount[0] == 2 || g.NavActivateId == id))
+            toggled = true;
+        if (g.NavId == id && ((g.NavMoveDir == ImGuiDir_Left && is_open) || (g.NavMoveDir == ImGuiDir_Right && !is_open)))
+        {
+            toggled = true;
+            NavClearPreferredPosForAxis(ImGuiAxis_X);
+            NavMoveRequestCancel();
+        }
+        if (toggled)
+            g.LastItemData.StatusFlags |= ImGuiItemStatusFlags_ToggledOpen;
+        *out_toggled = toggled;
+    }
+
+    // Render
+    if (hovered || selected)
+    {
+        const ImU32 bg_col = GetColorU32((held && hovered) ? ImGuiCol_HeaderActive : hovered ? ImGuiCol_HeaderHovered : ImGuiCol_Header);
+        RenderFrame(frame_bb.Min, frame_bb.Max, bg_col, false);
+    }
+    RenderNavHighlight(frame_bb, id, ImGuiNavHighlightFlags_Compact);
+    const ImU32 text_col = GetColorU32(ImGuiCol_Text);
+    if (!is_leaf)
+        RenderArrow(window->DrawList, ImVec2(text_pos.x - text_offset_x + padding.x, text_pos.y + g.FontSize * 0.15f), text_col, is_open ? ImGuiDir_Down : ImGuiDir_Right, 0.70f);
+    if (g.LogEnabled)
+        LogSetNextTextDecoration(">", NULL);
+    RenderText(text_pos, label, NULL, false);
+    if (node->IsLoading && node->IsOpen)
+        window->DrawList->AddText(ImVec2(text_pos.x + label_size.x + style.ItemInnerSpacing.x, text_pos.y), GetColorU32(ImGuiCol_TextDisabled), "...");
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | (is_leaf ? 0 : ImGuiItemStatusFlags_Openable) | (is_open ? ImGuiItemStatusFlags_Opened : 0));
+    return pressed;
+}
+
+bool ImGui::VirtualTree(const char* str_id, ImGuiVirtualTree* tree, const ImVec2& size)
+{
+    if (tree->Nodes.Size == 0)
+    {
+        ImGuiVirtualTreeNode root;
+        memset(&root, 0, sizeof(root));
+        root.Parent = -1;
+        root.Depth = -1;
+        root.HasChildren = 1;
+        tree->Nodes.push_back(root);
+    }
+    tree->SetNodeOpen(0, true);
+    tree->UpdateVisibleRows();
+
+    bool selection_changed = false;
+    if (BeginChild(str_id, size))
+    {
+        // Open/close is applied after submitting rows, as it modifies VisibleRows[]
+        int toggled_row_n = -1;
+        ImGuiListClipper clipper;
+        clipper.Begin(tree->VisibleRows.Size);
+        while (clipper.Step())
+            for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+            {
+                const int node_n = tree->VisibleRows[row_n];
+                char buf[256];
+                const char* label = buf;
+                if (tree->GetNodeLabel)
+                    label = tree->GetNodeLabel(tree->UserData, tree->Nodes[node_n].UserID, buf, IM_ARRAYSIZE(buf));
+                else
+                    ImFormatString(buf, IM_ARRAYSIZE(buf), "%" IM_PRIu64, tree->Nodes[node_n].UserID);
+
+                bool toggled = false;
+                if (VirtualTreeRowBehavior(tree, node_n, label, &toggled) && tree->SelectedNode != node_n)
+                {
+                    tree->SelectedNode = node_n;
+                    selection_changed = true;
+                }
+                if (toggled)
+                    toggled_row_n = row_n;
+            }
+        if (toggled_row_n != -1)
+        {
+            const int node_n = tree->VisibleRows[toggled_row_n];
+            tree->SetNodeOpen(node_n, !tree->Nodes[node_n].IsOpen, toggled_row_n);
+        }
+    }
+    EndChild();
+    return selection_changed;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Selectable
 //-------------------------------------------------------------------------
@@ -6924,6 +8160,178 @@ int ImGui::TypingSelectFindBestLeadingMatch(ImGuiTypingSelectRequest* req, int i
     return longest_match_idx;
 }
 
+// Compare names the same way ImStrimatchlen() matches them (ASCII case-insensitive), comparing at most 'n' characters.
+static int TypingSelectStrCompare(const char* s1, const char* s2, int n = INT_MAX)
+{
+    for (; n > 0; n--, s1++, s2++)
+    {
+        const unsigned char c1 = (unsigned char)ImToUpper(*s1);
+        const unsigned char c2 = (unsigned char)ImToUpper(*s2);
+        if (c1 != c2)
+            return (c1 < c2) ? -1 : +1;
+        if (c1 == 0)
+            break;
+    }
+    return 0;
+}
+
+static ImU32 TypingSelectFirstCharKey(const char* name)
+{
+    unsigned int c = 0;
+    if (*name != 0)
+        ImTextCharFromUtf8(&c, name, NULL);
+    return (c < 0x80) ? (ImU32)ImToUpper((char)c) : (ImU32)c;
+}
+
+struct ImGuiTypingSelectIndexSortEntry
+{
+    const char* Name;
+    int         Index;
+};
+
+static int IMGUI_CDECL TypingSelectIndexSortEntryCompare(const void* lhs, const void* rhs)
+{
+    const ImGuiTypingSelectIndexSortEntry* a = (const ImGuiTypingSelectIndexSortEntry*)lhs;
+    const ImGuiTypingSelectIndexSortEntry* b = (const ImGuiTypingSelectIndexSortEntry*)rhs;
+    if (int d = TypingSelectStrCompare(a->Name, b->Name))
+        return d;
+    return (a->Index < b->Index) ? -1 : (a->Index > b->Index) ? +1 : 0;
+}
+
+static int IMGUI_CDECL TypingSelectU64Compare(const void* lhs, const void* rhs)
+{
+    const ImU64 a = *(const ImU64*)lhs;
+    const ImU64 b = *(const ImU64*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static const ImU64* TypingSelectLowerBound(const ImU64* first, const ImU64* last, ImU64 value)
+{
+    size_t count = (size_t)(last - first);
+    while (count > 0)
+    {
+        const size_t step = count >> 1;
+        if (first[step] < value)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first;
+}
+
+void ImGuiTypingSelectIndex::Build(int items_count, const char* (*get_item_name_func)(void*, int), void* user_data)
+{
+    ImVector<ImGuiTypingSelectIndexSortEntry> entries;
+    entries.resize(items_count);
+    FirstCharItems.resize(items_count);
+    for (int idx = 0; idx < items_count; idx++)
+    {
+        const char* item_name = get_item_name_func(user_data, idx);
+        if (item_name == NULL)
+            item_name = "";
+        entries[idx].Name = item_name;
+        entries[idx].Index = idx;
+        FirstCharItems[idx] = ((ImU64)TypingSelectFirstCharKey(item_name) << 32) | (ImU32)idx;
+    }
+    ImQsort(entries.Data, (size_t)entries.Size, sizeof(entries[0]), TypingSelectIndexSortEntryCompare);
+    ImQsort(FirstCharItems.Data, (size_t)FirstCharItems.Size, sizeof(FirstCharItems[0]), TypingSelectU64Compare);
+
+    // Leaves of the segment tree are at [items_count, items_count * 2), each parent holds the smallest index of its two children.
+    SortedItems.resize(items_count);
+    SortedItemsMinTree.resize(items_count * 2);
+    for (int n = 0; n < items_count; n++)
+        SortedItems[n] = SortedItemsMinTree[items_count + n] = entries[n].Index;
+    for (int n = items_count - 1; n > 0; n--)
+        SortedItemsMinTree[n] = ImMin(SortedItemsMinTree[n * 2], SortedItemsMinTree[n * 2 + 1]);
+}
+
+// Return first position in SortedItems for which the name compared to 's' (up to 'n' characters) is >= 0 (or > 0 when 'upper' is set).
+static int TypingSelectIndexBound(const ImGuiTypingSelectIndex* index, const char* (*get_item_name_func)(void*, int), void* user_data, const char* s, int n, bool upper)
+{
+    int lo = 0;
+    int hi = index->SortedItems.Size;
+    while (lo < hi)
+    {
+        const int mid = lo + (hi - lo) / 2;
+        const char* item_name = get_item_name_func(user_data, index->SortedItems[mid]);
+        const int d = TypingSelectStrCompare(item_name ? item_name : "", s, n);
+        if (upper ? (d <= 0) : (d < 0))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+int ImGui::TypingSelectFindMatch(ImGuiTypingSelectRequest* req, const ImGuiTypingSelectIndex* index, const char* (*get_item_name_func)(void*, int), void* user_data, int nav_item_idx)
+{
+    if (req == NULL || req->SelectRequest == false) // Support NULL parameter so both calls can be done from same spot.
+        return -1;
+    int idx = -1;
+    if (req->SingleCharMode && (req->Flags & ImGuiTypingSelectFlags_AllowSingleCharMode))
+        idx = TypingSelectFindNextSingleCharMatch(req, index, get_item_name_func, user_data, nav_item_idx);
+    else
+        idx = TypingSelectFindBestLeadingMatch(req, index, get_item_name_func, user_data);
+    if (idx != -1)
+        NavRestoreHighlightAfterMove();
+    return idx;
+}
+
+// Same as the linear version: next item after 'nav_item_idx' starting with the same character, or first item starting with it.
+int ImGui::TypingSelectFindNextSingleCharMatch(ImGuiTypingSelectRequest* req, const ImGuiTypingSelectIndex* index, const char* (*get_item_name_func)(void*, int), void* user_data, int nav_item_idx)
+{
+    const ImVector<ImU64>& items = index->FirstCharItems;
+    const ImU64 key = (ImU64)TypingSelectFirstCharKey(req->SearchBuffer) << 32;
+    const ImU64* first_match = TypingSelectLowerBound(items.Data, items.Data + items.Size, key);
+    if (first_match == items.Data + items.Size || (*first_match >> 32) != (key >> 32))
+        return -1;
+    if (nav_item_idx >= 0 && nav_item_idx < items.Size)
+    {
+        const char* nav_item_name = get_item_name_func(user_data, nav_item_idx);
+        if (nav_item_name && ((ImU64)TypingSelectFirstCharKey(nav_item_name) << 32) == key)
+        {
+            const ImU64* next_match = TypingSelectLowerBound(first_match, items.Data + items.Size, key | (ImU32)(nav_item_idx + 1));
+            if (next_match != items.Data + items.Size && (*next_match >> 32) == (key >> 32))
+                return (int)(ImU32)*next_match;
+        }
+    }
+    return (int)(ImU32)*first_match;
+}
+
+// Same as the linear version: first item (in list order) with the longest leading match.
+// Names sharing the longest prefix with the search buffer are next to its insertion point in sorted order,
+// and all names sharing that prefix are a contiguous range of SortedItems in which we look for the smallest item index.
+int ImGui::TypingSelectFindBestLeadingMatch(ImGuiTypingSelectRequest* req, const ImGuiTypingSelectIndex* index, const char* (*get_item_name_func)(void*, int), void* user_data)
+{
+    const int count = index->SortedItems.Size;
+    const char* search = req->SearchBuffer;
+    const char* search_end = req->SearchBuffer + req->SearchBufferLen;
+    const int insert_pos = TypingSelectIndexBound(index, get_item_name_func, user_data, search, INT_MAX, false);
+    int match_len = 0;
+    for (int pos = ImMax(insert_pos - 1, 0); pos < ImMin(insert_pos + 1, count); pos++)
+        if (const char* item_name = get_item_name_func(user_data, index->SortedItems[pos]))
+            match_len = ImMax(match_len, ImStrimatchlen(search, search_end, item_name));
+    if (match_len == 0)
+        return -1;
+
+    int lo = TypingSelectIndexBound(index, get_item_name_func, user_data, search, match_len, false) + count;
+    int hi = TypingSelectIndexBound(index, get_item_name_func, user_data, search, match_len, true) + count;
+    int best_idx = INT_MAX;
+    for (const int* tree = index->SortedItemsMinTree.Data; lo < hi; lo >>= 1, hi >>= 1)
+    {
+        if (lo & 1)
+            best_idx = ImMin(best_idx, tree[lo++]);
+        if (hi & 1)
+            best_idx = ImMin(best_idx, tree[--hi]);
+    }
+    return best_idx;
+}
+
 void ImGui::DebugNodeTypingSelectState(ImGuiTypingSelectState* data)
 {
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
@@ -6956,6 +8364,7 @@ void ImGui::SetNextItemSelectionUserData(ImGuiSelectionUserData selection_user_d
 // - BeginListBox()
 // - EndListBox()
 // - ListBox()
+// - ListBoxEx() [Internal]
 //-------------------------------------------------------------------------
 
 // This is essentially a thin wrapper to using BeginChild/EndChild with the ImGuiChildFlags_FrameStyle flag for stylistic changes + displaying a label.
@@ -7022,6 +8431,12 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* const item
 // This is merely a helper around BeginListBox(), EndListBox().
 // Considering using those directly to submit custom data or store selection differently.
 bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count, int height_in_items)
+{
+    return ListBoxEx(label, current_item, getter, user_data, items_count, NULL, height_in_items);
+}
+
+// Per-frame cost only depends on the number of visible items: items are clipped, and typing-select uses 'index' instead of scanning items.
+bool ImGui::ListBoxEx(const char* label, int* current_item, const char* (*getter)(void* user_data, int idx), void* user_data, int items_count, const ImGuiTypingSelectIndex* index, int height_in_items)
 {
     ImGuiContext& g = *GImGui;
 
@@ -7037,9 +8452,12 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
     // Assume all items have even height (= 1 line of text). If you need items of different height,
     // you can create a custom version of ListBox() in your code without using the clipper.
     bool value_changed = false;
+    const int focus_idx = ItemsTypingSelect(index, getter, user_data, items_count);
     ImGuiListClipper clipper;
     clipper.Begin(items_count, GetTextLineHeightWithSpacing()); // We know exactly our line height here so we pass it as a minor optimization, but generally you don't need to.
     clipper.IncludeItemByIndex(*current_item);
+    if (focus_idx != -1)
+        clipper.IncludeItemByIndex(focus_idx);
     while (clipper.Step())
         for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
         {
@@ -7049,6 +8467,8 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 
             PushID(i);
             const bool item_selected = (i == *current_item);
+            if (index != NULL)
+                SetNextItemSelectionUserData(i);
             if (Selectable(item_text, item_selected))
             {
                 *current_item = i;
@@ -7056,6 +8476,11 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
             }
             if (item_selected)
                 SetItemDefaultFocus();
+            if (i == focus_idx)
+            {
+                SetFocusID(g.LastItemData.ID, g.CurrentWindow);
+                ScrollToItem(ImGuiScrollFlags_KeepVisibleCenterY);
+            }
             PopID();
         }
     EndListBox();
@@ -7072,6 +8497,10 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
+// - ImGuiPlotSummary
+// - PlotSummaryEx() [Internal]
+// - ImGuiStreamingPlot
+// - PlotStreamingEx() [Internal]
 //-------------------------------------------------------------------------
 // Plot/Graph widgets are not very good.
 // Consider writing your own, or using a third-party one, see:
@@ -7079,6 +8508,21 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
+struct ImGuiPlotArrayGetterData
+{
+    const float* Values;
+    int Stride;
+
+    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
+};
+
+static float Plot_ArrayGetter(void* data, int idx)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
+    return v;
+}
+
 int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
 {
     ImGuiContext& g = *GImGui;
@@ -7105,13 +8549,21 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        ImGuiPlotArrayGetterData* array_data = (values_getter == &Plot_ArrayGetter) ? (ImGuiPlotArrayGetterData*)data : NULL;
+        if (array_data != NULL && array_data->Stride == sizeof(float))
         {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
+            ImMinMaxF(array_data->Values, values_count, &v_min, &v_max);
+        }
+        else
+        {
+            for (int i = 0; i < values_count; i++)
+            {
+                const float v = values_getter(data, i);
+                if (v != v) // Ignore NaN values
+                    continue;
+                v_min = ImMin(v_min, v);
+                v_max = ImMax(v_max, v);
+            }
         }
         if (scale_min == FLT_MAX)
             scale_min = v_min;
@@ -7194,21 +8646,6 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
-{
-    const float* Values;
-    int Stride;
-
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
-
-static float Plot_ArrayGetter(void* data, int idx)
-{
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
-}
-
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
@@ -7231,6 +8668,550 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGuiPlotSummary::Clear()
+{
+    Values.clear();
+    for (int level = 0; level < IM_PLOT_SUMMARY_LEVELS_MAX; level++)
+        Levels[level].clear();
+    LevelsCount = 0;
+}
+
+// Recompute blocks containing samples >= 'first_sample' on all levels, creating new levels as needed.
+static void PlotSummaryUpdateLevels(ImGuiPlotSummary* summary, int first_sample)
+{
+    const int values_count = summary->Values.Size;
+    int levels_count = 0;
+    for (int level = 0; level < IM_PLOT_SUMMARY_LEVELS_MAX; level++)
+    {
+        const int block_size = ImGuiPlotSummary::GetBlockSize(level);
+        if (values_count <= block_size)
+            break;
+        ImVector<ImVec2>& blocks = summary->Levels[level];
+        const int blocks_count = (int)(((ImS64)values_count + block_size - 1) / block_size);
+        const int block_first = (level < summary->LevelsCount) ? (first_sample / block_size) : 0;
+        blocks.resize(blocks_count);
+        for (int block_n = block_first; block_n < blocks_count; block_n++)
+        {
+            ImVec2 min_max(FLT_MAX, -FLT_MAX);
+            if (level == 0)
+            {
+                const int sample_n = block_n * block_size;
+                ImMinMaxF(summary->Values.Data + sample_n, ImMin(block_size, values_count - sample_n), &min_max.x, &min_max.y);
+            }
+            else
+            {
+                const ImVector<ImVec2>& src_blocks = summary->Levels[level - 1];
+                for (int src_n = block_n * 4, src_end = ImMin(src_n + 4, src_blocks.Size); src_n < src_end; src_n++)
+                {
+                    min_max.x = ImMin(min_max.x, src_blocks.Data[src_n].x);
+                    min_max.y = ImMax(min_max.y, src_blocks.Data[src_n].y);
+                }
+            }
+            blocks.Data[block_n] = min_max;
+        }
+        levels_count = level + 1;
+    }
+    summary->LevelsCount = levels_count;
+}
+
+void ImGuiPlotSummary::Append(float v)
+{
+    Values.push_back(v);
+    const int sample_n = Values.Size - 1;
+    if (LevelsCount < IM_PLOT_SUMMARY_LEVELS_MAX && Values.Size > GetBlockSize(LevelsCount))
+    {
+        PlotSummaryUpdateLevels(this, sample_n);
+        return;
+    }
+
+    // Fast path: extend the last block of each level, stopping at the first level where it didn't change
+    const bool is_nan = (v != v);
+    int block_n = sample_n / IM_PLOT_SUMMARY_BLOCK_SIZE;
+    for (int level = 0; level < LevelsCount; level++, block_n >>= 2)
+    {
+        ImVector<ImVec2>& blocks = Levels[level];
+        if (block_n == blocks.Size)
+            blocks.push_back(ImVec2(FLT_MAX, -FLT_MAX));
+        else if (is_nan)
+            break;
+        if (is_nan)
+            continue;
+        ImVec2& min_max = blocks.Data[block_n];
+        if (v >= min_max.x && v <= min_max.y)
+            break;
+        min_max.x = ImMin(min_max.x, v);
+        min_max.y = ImMax(min_max.y, v);
+    }
+}
+
+void ImGuiPlotSummary::Append(const float* values, int values_count)
+{
+    IM_ASSERT(values_count >= 0);
+    if (values_count == 0)
+        return;
+    const int sample_n = Values.Size;
+    Values.resize(Values.Size + values_count);
+    memcpy(Values.Data + sample_n, values, (size_t)values_count * sizeof(float));
+    PlotSummaryUpdateLevels(this, sample_n);
+}
+
+// Fold min/max of samples [first, last) using blocks of 'level' (-1: raw samples). Bounds are multiple of the level block size.
+static void PlotSummaryFold(const ImGuiPlotSummary* summary, int level, int first, int last, float* v_min, float* v_max)
+{
+    if (first >= last)
+        return;
+    float r_min, r_max;
+    if (level == -1)
+    {
+        ImMinMaxF(summary->Values.Data + first, last - first, &r_min, &r_max);
+    }
+    else
+    {
+        const int block_size = ImGuiPlotSummary::GetBlockSize(level);
+        const ImVec2* blocks = summary->Levels[level].Data;
+        r_min = FLT_MAX;
+        r_max = -FLT_MAX;
+        for (int block_n = first / block_size, block_end = last / block_size; block_n < block_end; block_n++)
+        {
+            r_min = ImMin(r_min, blocks[block_n].x);
+            r_max = ImMax(r_max, blocks[block_n].y);
+        }
+    }
+    *v_min = ImMin(*v_min, r_min);
+    *v_max = ImMax(*v_max, r_max);
+}
+
+// Climb levels while [first, last) still contains whole blocks of the next level, folding the unaligned ends at the current level.
+// This reads at most 2x15 samples then 2x3 blocks per level.
+void ImGuiPlotSummary::GetMinMax(int first, int last, float* out_min, float* out_max) const
+{
+    IM_ASSERT(first >= 0 && first <= last && last <= Values.Size);
+    float v_min = FLT_MAX;
+    float v_max = -FLT_MAX;
+    int level = -1;
+    while (level + 1 < LevelsCount)
+    {
+        const int next_block_size = GetBlockSize(level + 1);
+        const int next_first = (int)(((ImS64)first + next_block_size - 1) / next_block_size * next_block_size);
+        const int next_last = last / next_block_size * next_block_size;
+        if (next_first >= next_last)
+            break;
+        PlotSummaryFold(this, level, first, next_first, &v_min, &v_max);
+        PlotSummaryFold(this, level, next_last, last, &v_min, &v_max);
+        first = next_first;
+        last = next_last;
+        level++;
+    }
+    PlotSummaryFold(this, level, first, last, &v_min, &v_max);
+    *out_min = v_min;
+    *out_max = v_max;
+}
+
+// Plot a range of samples of an ImGuiPlotSummary, decimated to one column per pixel.
+// - Lines: each column draws the vertical min..max extent of its samples, and a segment joining the last sample of the previous column
+//   to the first sample of the column (M4 decimation, which renders the same pixels as drawing every sample).
+// - Histogram: each column draws one bar spanning the zero line and the min..max extent of its samples.
+// Cost is O(width * log N) regardless of the number of samples.
+int ImGui::PlotSummaryEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotSummary* summary, int values_first, int values_count, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
+
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
+
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), label_size.y + style.FramePadding.y * 2.0f);
+
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, 0, &frame_bb))
+        return -1;
+    const bool hovered = ItemHoverable(frame_bb, id, g.LastItemData.InFlags);
+
+    if (values_count < 0)
+        values_count = summary->Values.Size - values_first;
+    IM_ASSERT(values_first >= 0 && values_count >= 0 && values_first + values_count <= summary->Values.Size);
+
+    // Determine scale from values if not specified
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        float v_min, v_max;
+        summary->GetMinMax(values_first, values_first + values_count, &v_min, &v_max);
+        if (scale_min == FLT_MAX)
+            scale_min = v_min;
+        if (scale_max == FLT_MAX)
+            scale_max = v_max;
+    }
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
+    int idx_hovered = -1;
+    int column_hovered = -1;
+    if (values_count >= values_count_min)
+    {
+        // Column N covers samples [values_first + N * values_count / res_w, values_first + (N + 1) * values_count / res_w)
+        const int res_w = ImMax(ImMin((int)inner_bb.GetWidth(), values_count), values_count_min);
+        const float* values = summary->Values.Data + values_first;
+        #define PLOT_COLUMN_FIRST(N) ((int)((ImS64)(N) * values_count / res_w))
+
+        // Tooltip on hover
+        if (hovered && inner_bb.Contains(g.IO.MousePos))
+        {
+            const float t = ImClamp((g.IO.MousePos.x - inner_bb.Min.x) / (inner_bb.Max.x - inner_bb.Min.x), 0.0f, 0.9999f);
+            const int column_n = (plot_type == ImGuiPlotType_Lines) ? (int)(t * (res_w - 1) + 0.5f) : (int)(t * res_w);
+            const int v_idx = PLOT_COLUMN_FIRST(column_n);
+            const int v_idx_last = PLOT_COLUMN_FIRST(column_n + 1) - 1;
+            if (v_idx == v_idx_last)
+            {
+                SetTooltip("%d: %8.4g", v_idx, values[v_idx]);
+            }
+            else
+            {
+                float v_min, v_max;
+                summary->GetMinMax(values_first + v_idx, values_first + v_idx_last + 1, &v_min, &v_max);
+                SetTooltip("%d..%d\nmin: %8.4g\nmax: %8.4g", v_idx, v_idx_last, v_min, v_max);
+            }
+            idx_hovered = v_idx;
+            column_hovered = column_n;
+        }
+
+        const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+        const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
+        const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+        const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+        #define PLOT_VALUE_Y(V) ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate(((V) - scale_min) * inv_scale))
+
+        float prev_x = 0.0f;
+        float prev_v = FLT_MAX;
+        for (int column_n = 0; column_n < res_w; column_n++)
+        {
+            const int v_idx = PLOT_COLUMN_FIRST(column_n);
+            const int v_idx_end = PLOT_COLUMN_FIRST(column_n + 1);
+            float v_min, v_max;
+            if (v_idx_end - v_idx == 1)
+                v_min = v_max = values[v_idx];
+            else
+                summary->GetMinMax(values_first + v_idx, values_first + v_idx_end, &v_min, &v_max);
+            const bool has_values = (v_min <= v_max); // False for NaN values
+            const ImU32 col = (column_hovered == column_n) ? col_hovered : col_base;
+
+            // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
+            if (plot_type == ImGuiPlotType_Lines)
+            {
+                const float x = ImLerp(inner_bb.Min.x, inner_bb.Max.x, (float)column_n / (float)(res_w - 1));
+                const float v_enter = values[v_idx];
+                if (column_n > 0 && prev_v == prev_v && v_enter == v_enter)
+                    window->DrawList->AddLine(ImVec2(prev_x, PLOT_VALUE_Y(prev_v)), ImVec2(x, PLOT_VALUE_Y(v_enter)), col);
+                if (has_values && v_min < v_max)
+                    window->DrawList->AddLine(ImVec2(x, PLOT_VALUE_Y(v_max)), ImVec2(x, PLOT_VALUE_Y(v_min)), col);
+                prev_x = x;
+                prev_v = values[v_idx_end - 1];
+            }
+            else if (plot_type == ImGuiPlotType_Histogram && has_values)
+            {
+                const float y_zero = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+                ImVec2 pos0(ImLerp(inner_bb.Min.x, inner_bb.Max.x, (float)column_n / (float)res_w), ImMin(PLOT_VALUE_Y(v_max), y_zero));
+                ImVec2 pos1(ImLerp(inner_bb.Min.x, inner_bb.Max.x, (float)(column_n + 1) / (float)res_w), ImMax(PLOT_VALUE_Y(v_min), y_zero));
+                if (pos1.x >= pos0.x + 2.0f)
+                    pos1.x -= 1.0f;
+                window->DrawList->AddRectFilled(pos0, pos1, col);
+            }
+        }
+        #undef PLOT_COLUMN_FIRST
+        #undef PLOT_VALUE_Y
+    }
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+
+    // Return index of the first sample of the hovered column (relative to values_first) or -1 if none are hovered.
+    return idx_hovered;
+}
+
+struct ImGuiStreamingPlotCounters
+{
+    std::atomic<ImU32>      WriteCount;             // [Producer] Number of samples pushed so far (wraps around)
+    std::atomic<ImU32>      ReleasedCount;          // [Consumer] Samples before this one may be overwritten
+    std::atomic<ImU32>      DroppedCount;           // [Producer] Number of samples dropped because the ring was full
+
+    ImGuiStreamingPlotCounters() : WriteCount(0), ReleasedCount(0), DroppedCount(0) {}
+};
+
+ImGuiStreamingPlot::ImGuiStreamingPlot(int display_count, int capacity)
+{
+    IM_ASSERT(display_count >= 2);
+    capacity = ImUpperPowerOfTwo(ImMax(capacity, display_count * 2));
+    Samples.resize(capacity, 0.0f);
+    MinQueue.resize(capacity);
+    MaxQueue.resize(capacity);
+    CapacityMask = (ImU32)(capacity - 1);
+    DisplayCount = display_count;
+    Counters = IM_NEW(ImGuiStreamingPlotCounters)();
+    ConsumedCount = 0;
+    DisplaySize = 0;
+    MinQueueHead = MinQueueTail = MaxQueueHead = MaxQueueTail = 0;
+    CacheVtxPerSegment = CacheIdxPerSegment = 0;
+    CacheBegin = CacheEnd = 0;
+    CacheScaleAndSize = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+    CacheCol = 0;
+    CacheFlags = ImDrawListFlags_None;
+    CacheTexUvWhitePixel = ImVec2(0.0f, 0.0f);
+}
+
+ImGuiStreamingPlot::~ImGuiStreamingPlot()
+{
+    IM_DELETE(Counters);
+}
+
+bool ImGuiStreamingPlot::Push(float v)
+{
+    const ImU32 write_n = Counters->WriteCount.load(std::memory_order_relaxed);
+    if (write_n - Counters->ReleasedCount.load(std::memory_order_acquire) > CapacityMask)
+    {
+        Counters->DroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    Samples.Data[write_n & CapacityMask] = v;
+    Counters->WriteCount.store(write_n + 1, std::memory_order_release);
+    return true;
+}
+
+ImU32 ImGuiStreamingPlot::GetDroppedCount() const
+{
+    return Counters->DroppedCount.load(std::memory_order_relaxed);
+}
+
+// Sample indices wrap around, compare them relative to each other.
+static inline bool StreamingPlotIsBefore(ImU32 a, ImU32 b) { return (ImS32)(a - b) < 0; }
+
+void ImGuiStreamingPlot::Consume()
+{
+    const ImU32 write_count = Counters->WriteCount.load(std::memory_order_acquire);
+    const ImU32 new_count = write_count - ConsumedCount;
+    for (ImU32 sample_n = ConsumedCount; sample_n != write_count; sample_n++)
+    {
+        const float v = Samples.Data[sample_n & CapacityMask];
+        if (v != v) // Ignore NaN values
+            continue;
+        while (MinQueueTail != MinQueueHead && GetSample(MinQueue.Data[(MinQueueTail - 1) & CapacityMask]) >= v)
+            MinQueueTail--;
+        MinQueue.Data[MinQueueTail++ & CapacityMask] = sample_n;
+        while (MaxQueueTail != MaxQueueHead && GetSample(MaxQueue.Data[(MaxQueueTail - 1) & CapacityMask]) <= v)
+            MaxQueueTail--;
+        MaxQueue.Data[MaxQueueTail++ & CapacityMask] = sample_n;
+    }
+    ConsumedCount = write_count;
+    DisplaySize = (int)ImMin((ImU32)DisplaySize + new_count, (ImU32)DisplayCount);
+
+    // Drop samples which scrolled out, then let the producer reuse their slots
+    const ImU32 display_begin = GetDisplayBegin();
+    while (MinQueueHead != MinQueueTail && StreamingPlotIsBefore(MinQueue.Data[MinQueueHead & CapacityMask], display_begin))
+        MinQueueHead++;
+    while (MaxQueueHead != MaxQueueTail && StreamingPlotIsBefore(MaxQueue.Data[MaxQueueHead & CapacityMask], display_begin))
+        MaxQueueHead++;
+    Counters->ReleasedCount.store(display_begin, std::memory_order_release);
+}
+
+void ImGuiStreamingPlot::GetMinMax(float* out_min, float* out_max) const
+{
+    *out_min = (MinQueueHead != MinQueueTail) ? GetSample(MinQueue.Data[MinQueueHead & CapacityMask]) : FLT_MAX;
+    *out_max = (MaxQueueHead != MaxQueueTail) ? GetSample(MaxQueue.Data[MaxQueueHead & CapacityMask]) : -FLT_MAX;
+}
+
+static float Plot_StreamingGetter(void* data, int idx)
+{
+    ImGuiStreamingPlot* plot = (ImGuiStreamingPlot*)data;
+    return plot->GetSample(plot->GetDisplayBegin() + (ImU32)idx);
+}
+
+// Plot the last samples pushed to an ImGuiStreamingPlot, scrolling from right to left.
+// Histograms are submitted through PlotEx(). Lines keep their tessellated segments from one frame to the next:
+// only segments which scrolled in since the last frame are tessellated, the others are copied to the draw list with an offset.
+int ImGui::PlotStreamingEx(ImGuiPlotType plot_type, const char* label, ImGuiStreamingPlot* plot, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+{
+    // Consume even when not visible, so the producer doesn't run out of room
+    plot->Consume();
+
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
+
+    // Determine scale from values if not specified
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        float v_min, v_max;
+        plot->GetMinMax(&v_min, &v_max);
+        if (scale_min == FLT_MAX)
+            scale_min = v_min;
+        if (scale_max == FLT_MAX)
+            scale_max = v_max;
+    }
+    if (plot_type != ImGuiPlotType_Lines)
+        return PlotEx(plot_type, label, &Plot_StreamingGetter, (void*)plot, plot->DisplaySize, 0, overlay_text, scale_min, scale_max, size_arg);
+
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
+
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), label_size.y + style.FramePadding.y * 2.0f);
+
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, 0, &frame_bb))
+        return -1;
+    const bool hovered = ItemHoverable(frame_bb, id, g.LastItemData.InFlags);
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    int idx_hovered = -1;
+    const int values_count = plot->DisplaySize;
+    const ImU32 col_base = GetColorU32(ImGuiCol_PlotLines);
+    if (values_count >= 2 && (col_base & IM_COL32_A_MASK) != 0)
+    {
+        // Sample N of the displayed range is at x = N * step, the plot fills up from the left then scrolls.
+        ImDrawList* draw_list = window->DrawList;
+        const ImU32 display_begin = plot->GetDisplayBegin();
+        const float step = inner_bb.GetWidth() / (float)(plot->DisplayCount - 1);
+        const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+
+        // Tooltip on hover
+        if (hovered && inner_bb.Contains(g.IO.MousePos))
+        {
+            const int v_idx = ImClamp((int)((g.IO.MousePos.x - inner_bb.Min.x) / step + 0.5f), 0, values_count - 1);
+            SetTooltip("%d: %8.4g", v_idx, plot->GetSample(display_begin + (ImU32)v_idx));
+            idx_hovered = v_idx;
+        }
+
+        // Invalidate cached segments when their geometry changed, drop the ones which scrolled out
+        const ImU32 seg_begin = display_begin + 1;
+        const ImU32 seg_end = display_begin + (ImU32)values_count;
+        const ImVec4 scale_and_size(scale_min, scale_max, step, inner_bb.GetHeight());
+        const ImDrawListFlags cache_flags = draw_list->Flags & (ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex);
+        const ImVec2 tex_uv_white_pixel = draw_list->_Data->TexUvWhitePixel;
+        if (memcmp(&scale_and_size, &plot->CacheScaleAndSize, sizeof(scale_and_size)) != 0 || plot->CacheCol != col_base || plot->CacheFlags != cache_flags ||
+            plot->CacheTexUvWhitePixel.x != tex_uv_white_pixel.x || plot->CacheTexUvWhitePixel.y != tex_uv_white_pixel.y ||
+            StreamingPlotIsBefore(plot->CacheEnd, seg_begin) || StreamingPlotIsBefore(seg_begin, plot->CacheBegin))
+        {
+            if (plot->CacheFlags != cache_flags)
+                plot->CacheVtxPerSegment = plot->CacheIdxPerSegment = 0;
+            plot->CacheBegin = plot->CacheEnd = seg_begin;
+            plot->CacheScaleAndSize = scale_and_size;
+            plot->CacheCol = col_base;
+            plot->CacheFlags = cache_flags;
+            plot->CacheTexUvWhitePixel = tex_uv_white_pixel;
+        }
+        plot->CacheBegin = seg_begin;
+
+        // Copy cached segments, in batches small enough to stay within 16-bit indices
+        const int vtx_per_seg = plot->CacheVtxPerSegment;
+        const int idx_per_seg = plot->CacheIdxPerSegment;
+        for (ImU32 seg_n = plot->CacheBegin; seg_n != plot->CacheEnd; )
+        {
+            const int batch_count = ImMin((int)(plot->CacheEnd - seg_n), ImMax(32768 / vtx_per_seg, 1));
+            draw_list->PrimReserve(batch_count * idx_per_seg, batch_count * vtx_per_seg);
+            ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+            ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+            unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+            for (int n = 0; n < batch_count; n++, seg_n++)
+            {
+                const ImVec2 origin(inner_bb.Min.x + (float)(int)(seg_n - 1 - display_begin) * step, inner_bb.Min.y);
+                const ImDrawVert* src_vtx = &plot->CacheVtx.Data[(seg_n & plot->CapacityMask) * vtx_per_seg];
+                const ImDrawIdx* src_idx = &plot->CacheIdx.Data[(seg_n & plot->CapacityMask) * idx_per_seg];
+                for (int vtx_n = 0; vtx_n < vtx_per_seg; vtx_n++)
+                {
+                    vtx_write[vtx_n] = src_vtx[vtx_n];
+                    vtx_write[vtx_n].pos.x += origin.x;
+                    vtx_write[vtx_n].pos.y += origin.y;
+                }
+                for (int idx_n = 0; idx_n < idx_per_seg; idx_n++)
+                    idx_write[idx_n] = (ImDrawIdx)(src_idx[idx_n] + vtx_current_idx);
+                vtx_write += vtx_per_seg;
+                idx_write += idx_per_seg;
+                vtx_current_idx += vtx_per_seg;
+            }
+            draw_list->_VtxWritePtr = vtx_write;
+            draw_list->_IdxWritePtr = idx_write;
+            draw_list->_VtxCurrentIdx = vtx_current_idx;
+        }
+
+        // Tessellate segments which scrolled in, and store them relative to their start point.
+        // Segments touching a NaN value are kept with a transparent color so all segments have the same size.
+        for (ImU32 seg_n = plot->CacheEnd; seg_n != seg_end; seg_n++)
+        {
+            const ImVec2 origin(inner_bb.Min.x + (float)(int)(seg_n - 1 - display_begin) * step, inner_bb.Min.y);
+            const float v0 = plot->GetSample(seg_n - 1);
+            const float v1 = plot->GetSample(seg_n);
+            const bool is_gap = (v0 != v0) || (v1 != v1);
+            const ImVec2 pos0(origin.x, is_gap ? inner_bb.Max.y : ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v0 - scale_min) * inv_scale)));
+            const ImVec2 pos1(origin.x + step, is_gap ? inner_bb.Max.y : ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v1 - scale_min) * inv_scale)));
+            const int vtx_begin = draw_list->VtxBuffer.Size;
+            const int idx_begin = draw_list->IdxBuffer.Size;
+            draw_list->AddLine(pos0, pos1, col_base);
+            const int vtx_count = draw_list->VtxBuffer.Size - vtx_begin;
+            const int idx_count = draw_list->IdxBuffer.Size - idx_begin;
+            if (plot->CacheVtxPerSegment == 0)
+            {
+                plot->CacheVtxPerSegment = vtx_count;
+                plot->CacheIdxPerSegment = idx_count;
+                plot->CacheVtx.resize(plot->Samples.Size * vtx_count);
+                plot->CacheIdx.resize(plot->Samples.Size * idx_count);
+            }
+            IM_ASSERT(vtx_count == plot->CacheVtxPerSegment && idx_count == plot->CacheIdxPerSegment);
+
+            ImDrawVert* vtx = &draw_list->VtxBuffer.Data[vtx_begin];
+            ImDrawVert* dst_vtx = &plot->CacheVtx.Data[(seg_n & plot->CapacityMask) * vtx_count];
+            for (int vtx_n = 0; vtx_n < vtx_count; vtx_n++)
+            {
+                if (is_gap)
+                    vtx[vtx_n].col &= ~IM_COL32_A_MASK;
+                dst_vtx[vtx_n] = vtx[vtx_n];
+                dst_vtx[vtx_n].pos.x -= origin.x;
+                dst_vtx[vtx_n].pos.y -= origin.y;
+            }
+            const unsigned int vtx_first_idx = draw_list->_VtxCurrentIdx - (unsigned int)vtx_count;
+            const ImDrawIdx* idx = &draw_list->IdxBuffer.Data[idx_begin];
+            ImDrawIdx* dst_idx = &plot->CacheIdx.Data[(seg_n & plot->CapacityMask) * idx_count];
+            for (int idx_n = 0; idx_n < idx_count; idx_n++)
+                dst_idx[idx_n] = (ImDrawIdx)(idx[idx_n] - vtx_first_idx);
+        }
+        plot->CacheEnd = seg_end;
+
+        // Hovered segment is drawn over
+        if (idx_hovered > 0)
+        {
+            const ImU32 sample_n = display_begin + (ImU32)idx_hovered;
+            const float v0 = plot->GetSample(sample_n - 1);
+            const float v1 = plot->GetSample(sample_n);
+            const float x1 = inner_bb.Min.x + (float)idx_hovered * step;
+            if (v0 == v0 && v1 == v1)
+                draw_list->AddLine(ImVec2(x1 - step, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v0 - scale_min) * inv_scale))),
+                                   ImVec2(x1, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v1 - scale_min) * inv_scale))), GetColorU32(ImGuiCol_PlotLinesHovered));
+        }
+    }
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+
+    return idx_hovered;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
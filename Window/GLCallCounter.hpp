@@ -0,0 +1,90 @@
+#pragma once
+
+// GL call counter
+// ---------------
+// Redefines the GL entry points used by the app and imgui_impl_opengl3.cpp as macros which count calls before calling
+// through, e.g. glClear(mask) -> (GLCallCounter::calls()++, glClear)(mask). Used by the headless benchmark.
+// - Include after the GL prototypes, and before any code issuing GL calls.
+// - Only direct calls are counted. Taking the address of a GL function through these macros won't compile.
+// - Functions missing from the list below are not counted: add them when new GL calls are introduced.
+namespace GLCallCounter {
+
+inline unsigned int& calls() {
+  static unsigned int count = 0;
+  return count;
+}
+
+inline unsigned int& drawCalls() {
+  static unsigned int count = 0;
+  return count;
+}
+
+inline void reset() {
+  calls() = drawCalls() = 0;
+}
+
+} // namespace GLCallCounter
+
+#define GL_CALL_COUNTER(_FUNC)      (GLCallCounter::calls()++, _FUNC)
+#define GL_CALL_COUNTER_DRAW(_FUNC) (GLCallCounter::calls()++, GLCallCounter::drawCalls()++, _FUNC)
+
+#define glActiveTexture            GL_CALL_COUNTER(glActiveTexture)
+#define glAttachShader             GL_CALL_COUNTER(glAttachShader)
+#define glBindBuffer               GL_CALL_COUNTER(glBindBuffer)
+#define glBindSampler              GL_CALL_COUNTER(glBindSampler)
+#define glBindTexture              GL_CALL_COUNTER(glBindTexture)
+#define glBindVertexArray          GL_CALL_COUNTER(glBindVertexArray)
+#define glBlendEquation            GL_CALL_COUNTER(glBlendEquation)
+#define glBlendEquationSeparate    GL_CALL_COUNTER(glBlendEquationSeparate)
+#define glBlendFuncSeparate        GL_CALL_COUNTER(glBlendFuncSeparate)
+#define glBufferData               GL_CALL_COUNTER(glBufferData)
+#define glBufferSubData            GL_CALL_COUNTER(glBufferSubData)
+#define glClear                    GL_CALL_COUNTER(glClear)
+#define glClearColor               GL_CALL_COUNTER(glClearColor)
+#define glClipControl              GL_CALL_COUNTER(glClipControl)
+#define glCompileShader            GL_CALL_COUNTER(glCompileShader)
+#define glCreateProgram            GL_CALL_COUNTER(glCreateProgram)
+#define glCreateShader             GL_CALL_COUNTER(glCreateShader)
+#define glDeleteBuffers            GL_CALL_COUNTER(glDeleteBuffers)
+#define glDeleteProgram            GL_CALL_COUNTER(glDeleteProgram)
+#define glDeleteShader             GL_CALL_COUNTER(glDeleteShader)
+#define glDeleteTextures           GL_CALL_COUNTER(glDeleteTextures)
+#define glDeleteVertexArrays       GL_CALL_COUNTER(glDeleteVertexArrays)
+#define glDetachShader             GL_CALL_COUNTER(glDetachShader)
+#define glDisable                  GL_CALL_COUNTER(glDisable)
+#define glDisableVertexAttribArray GL_CALL_COUNTER(glDisableVertexAttribArray)
+#define glDrawArrays               GL_CALL_COUNTER_DRAW(glDrawArrays)
+#define glDrawElements             GL_CALL_COUNTER_DRAW(glDrawElements)
+#define glDrawElementsBaseVertex   GL_CALL_COUNTER_DRAW(glDrawElementsBaseVertex)
+#define glEnable                   GL_CALL_COUNTER(glEnable)
+#define glEnableVertexAttribArray  GL_CALL_COUNTER(glEnableVertexAttribArray)
+#define glFinish                   GL_CALL_COUNTER(glFinish)
+#define glGenBuffers               GL_CALL_COUNTER(glGenBuffers)
+#define glGenTextures              GL_CALL_COUNTER(glGenTextures)
+#define glGenVertexArrays          GL_CALL_COUNTER(glGenVertexArrays)
+#define glGetAttribLocation        GL_CALL_COUNTER(glGetAttribLocation)
+#define glGetError                 GL_CALL_COUNTER(glGetError)
+#define glGetIntegerv              GL_CALL_COUNTER(glGetIntegerv)
+#define glGetProgramInfoLog        GL_CALL_COUNTER(glGetProgramInfoLog)
+#define glGetProgramiv             GL_CALL_COUNTER(glGetProgramiv)
+#define glGetShaderInfoLog         GL_CALL_COUNTER(glGetShaderInfoLog)
+#define glGetShaderiv              GL_CALL_COUNTER(glGetShaderiv)
+#define glGetString                GL_CALL_COUNTER(glGetString)
+#define glGetStringi               GL_CALL_COUNTER(glGetStringi)
+#define glGetUniformLocation       GL_CALL_COUNTER(glGetUniformLocation)
+#define glGetVertexAttribPointerv  GL_CALL_COUNTER(glGetVertexAttribPointerv)
+#define glGetVertexAttribiv        GL_CALL_COUNTER(glGetVertexAttribiv)
+#define glIsEnabled                GL_CALL_COUNTER(glIsEnabled)
+#define glIsProgram                GL_CALL_COUNTER(glIsProgram)
+#define glLinkProgram              GL_CALL_COUNTER(glLinkProgram)
+#define glPixelStorei              GL_CALL_COUNTER(glPixelStorei)
+#define glPolygonMode              GL_CALL_COUNTER(glPolygonMode)
+#define glScissor                  GL_CALL_COUNTER(glScissor)
+#define glShaderSource             GL_CALL_COUNTER(glShaderSource)
+#define glTexImage2D               GL_CALL_COUNTER(glTexImage2D)
+#define glTexParameteri            GL_CALL_COUNTER(glTexParameteri)
+#define glUniform1i                GL_CALL_COUNTER(glUniform1i)
+#define glUniformMatrix4fv         GL_CALL_COUNTER(glUniformMatrix4fv)
+#define glUseProgram               GL_CALL_COUNTER(glUseProgram)
+#define glVertexAttribPointer      GL_CALL_COUNTER(glVertexAttribPointer)
+#define glViewport                 GL_CALL_COUNTER(glViewport)
@@ -0,0 +1,729 @@
+// Headless render benchmark
+// -------------------------
+// Renders the app's scene and a scripted UI offscreen for a fixed number of frames, then prints JSON for regression tracking.
+// - Uses an EGL pbuffer on Mesa's surfaceless platform when available: no window system or GPU needed (llvmpipe).
+// - Everything is driven by the frame index (fixed DeltaTime, scripted mouse), so counters are reproducible between runs.
+// - GL calls are counted by compiling imgui_impl_opengl3.cpp in this file after GLCallCounter.hpp.
+// - With --viewports N, N extra panels are placed outside the main viewport: each one gets a pbuffer and a context sharing
+//   objects with the main one, like GLFW windows. --present picks how they are rendered and swapped:
+//   'default' (ImGui::RenderPlatformWindowsDefault()), 'serial' or 'thread' (ViewportPresenter.hpp).
+//
+// Usage: HeadlessBench [--frames N] [--warmup N] [--width W] [--height H] [--viewports N] [--present Mode] [--output file.json]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#define GL_GLEXT_PROTOTYPES 1
+#include <GL/glcorearb.h>
+
+#include "GLCallCounter.hpp"
+
+#include "../ImGui/imgui.h"
+#include "../ImGui/imgui_internal.h"
+
+// Compile the renderer backend here so its GL calls go through GLCallCounter.hpp
+#define IMGUI_IMPL_OPENGL_LOADER_CUSTOM
+#include "../ImGui/imgui_impl_opengl3.cpp"
+
+#include "Scene.hpp"
+#include "TreeBenchmark.hpp"
+#include "ViewportPresenter.hpp"
+
+#ifndef SHADERS_DIR
+#define SHADERS_DIR "Window/Shaders"
+#endif
+
+namespace HeadlessBench {
+
+struct Options {
+  int frames;
+  int warmupFrames;
+  int width;
+  int height;
+  int viewports;            // Secondary viewports, -1 to disable multi-viewports
+  const char* presentMode;  // "default", "serial" or "thread"
+  const char* outputFilename;
+
+  Options() {
+    frames = 600;
+    warmupFrames = 60;
+    width = 1280;
+    height = 800;
+    viewports = -1;
+    presentMode = "default";
+    outputFilename = NULL;
+  }
+};
+
+// Per-frame measurements
+struct FrameStats {
+  double newFrameMs;
+  double uiMs;
+  double renderMs;
+  double renderDrawDataMs;
+  double platformWindowsMs; // UpdatePlatformWindows() + rendering and swapping secondary viewports
+  double finishMs;          // glFinish(): with llvmpipe this is where rasterization happens
+  double cpuMs;             // NewFrame() to secondary viewports included
+  double frameMs;           // cpuMs + finishMs
+  unsigned int glCalls;
+  unsigned int drawCalls;
+  unsigned int allocations;
+  unsigned int allocatedBytes;
+  unsigned int makeCurrentCalls;
+  int viewports;
+  int vertices;
+  int indices;
+  int drawLists;
+  int drawCmds;
+};
+
+// Allocators may be called from DataTable() worker threads
+std::atomic<unsigned int> allocationsCount(0);
+std::atomic<unsigned int> allocatedBytes(0);
+
+void* countingAlloc(size_t size, void*) {
+  allocationsCount++;
+  allocatedBytes += (unsigned int)size;
+  return malloc(size);
+}
+
+void countingFree(void* ptr, void*) {
+  free(ptr);
+}
+
+double now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// EGL setup
+// ---------
+
+struct Context {
+  EGLDisplay display;
+  EGLConfig config;
+  EGLSurface surface;
+  EGLContext context;
+};
+
+const EGLint contextAttribs[] = {
+  EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3,
+  EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+  EGL_NONE
+};
+
+bool createContext(Context* ctx, int width, int height) {
+  // Prefer Mesa's surfaceless platform so we never try to connect to a display server
+  ctx->display = EGL_NO_DISPLAY;
+  PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+  const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+  if (getPlatformDisplay != NULL && clientExtensions != NULL && strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != NULL)
+    ctx->display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+  if (ctx->display == EGL_NO_DISPLAY)
+    ctx->display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  EGLint major, minor;
+  if (ctx->display == EGL_NO_DISPLAY || !eglInitialize(ctx->display, &major, &minor)) {
+    fprintf(stderr, "Error: eglInitialize() failed\n");
+    return false;
+  }
+
+  const EGLint configAttribs[] = {
+    EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+    EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_DEPTH_SIZE, 24,
+    EGL_NONE
+  };
+  EGLConfig& config = ctx->config;
+  EGLint configsCount = 0;
+  if (!eglChooseConfig(ctx->display, configAttribs, &config, 1, &configsCount) || configsCount == 0) {
+    fprintf(stderr, "Error: no EGL config with pbuffer + desktop GL support\n");
+    return false;
+  }
+  const EGLint surfaceAttribs[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+  ctx->surface = eglCreatePbufferSurface(ctx->display, config, surfaceAttribs);
+
+  eglBindAPI(EGL_OPENGL_API);
+  ctx->context = eglCreateContext(ctx->display, config, EGL_NO_CONTEXT, contextAttribs);
+  if (ctx->surface == EGL_NO_SURFACE || ctx->context == EGL_NO_CONTEXT || !eglMakeCurrent(ctx->display, ctx->surface, ctx->surface, ctx->context)) {
+    fprintf(stderr, "Error: failed to create a GL 3.3 core context\n");
+    return false;
+  }
+  return true;
+}
+
+void destroyContext(Context* ctx) {
+  eglMakeCurrent(ctx->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+  eglDestroyContext(ctx->display, ctx->context);
+  eglDestroySurface(ctx->display, ctx->surface);
+  eglTerminate(ctx->display);
+}
+
+// Secondary viewports
+// -------------------
+// Minimal platform backend: a pbuffer and a context sharing objects with the main context per viewport, like the GLFW
+// backend creates windows. Contexts are only made current when they aren't already, as the GLFW backend does.
+
+struct ViewportData {
+  EGLSurface surface;
+  EGLContext context;
+  ImVec2 pos;
+  ImVec2 size;
+  bool owned; // False for the main viewport
+};
+
+Context* mainContext = NULL;
+std::atomic<unsigned int> makeCurrentCalls(0); // Also incremented from the present thread
+
+void makeCurrent(const ViewportData* vd) {
+  if (eglGetCurrentContext() == vd->context && eglGetCurrentSurface(EGL_DRAW) == vd->surface)
+    return;
+  makeCurrentCalls++;
+  eglMakeCurrent(mainContext->display, vd->surface, vd->surface, vd->context);
+}
+
+void makeMainContextCurrent() {
+  ViewportData* vd = (ViewportData*)ImGui::GetMainViewport()->PlatformUserData;
+  makeCurrent(vd);
+}
+
+EGLSurface createViewportSurface(ImVec2 size) {
+  const EGLint surfaceAttribs[] = { EGL_WIDTH, ImMax((int)size.x, 1), EGL_HEIGHT, ImMax((int)size.y, 1), EGL_NONE };
+  return eglCreatePbufferSurface(mainContext->display, mainContext->config, surfaceAttribs);
+}
+
+void viewportCreateWindow(ImGuiViewport* viewport) {
+  ViewportData* vd = IM_NEW(ViewportData)();
+  vd->surface = createViewportSurface(viewport->Size);
+  vd->context = eglCreateContext(mainContext->display, mainContext->config, mainContext->context, contextAttribs);
+  vd->pos = viewport->Pos;
+  vd->size = viewport->Size;
+  vd->owned = true;
+  viewport->PlatformUserData = viewport->PlatformHandle = vd;
+}
+
+void viewportDestroyWindow(ImGuiViewport* viewport) {
+  if (ViewportData* vd = (ViewportData*)viewport->PlatformUserData) {
+    if (vd->owned) {
+      if (eglGetCurrentContext() == vd->context)
+        eglMakeCurrent(mainContext->display, mainContext->surface, mainContext->surface, mainContext->context);
+      eglDestroyContext(mainContext->display, vd->context);
+      eglDestroySurface(mainContext->display, vd->surface);
+    }
+    IM_DELETE(vd);
+  }
+  viewport->PlatformUserData = viewport->PlatformHandle = NULL;
+}
+
+ImVec2 viewportGetWindowPos(ImGuiViewport* viewport) {
+  return ((ViewportData*)viewport->PlatformUserData)->pos;
+}
+
+void viewportSetWindowPos(ImGuiViewport* viewport, ImVec2 pos) {
+  ((ViewportData*)viewport->PlatformUserData)->pos = pos;
+}
+
+ImVec2 viewportGetWindowSize(ImGuiViewport* viewport) {
+  return ((ViewportData*)viewport->PlatformUserData)->size;
+}
+
+// Pbuffers can't be resized: recreate the surface
+void viewportSetWindowSize(ImGuiViewport* viewport, ImVec2 size) {
+  ViewportData* vd = (ViewportData*)viewport->PlatformUserData;
+  if (vd->size.x == size.x && vd->size.y == size.y)
+    return;
+  vd->size = size;
+  if (!vd->owned)
+    return;
+  if (eglGetCurrentContext() == vd->context)
+    eglMakeCurrent(mainContext->display, mainContext->surface, mainContext->surface, mainContext->context);
+  eglDestroySurface(mainContext->display, vd->surface);
+  vd->surface = createViewportSurface(size);
+}
+
+// Nothing to show or title offscreen, but ImGui::UpdatePlatformWindows() requires both
+void viewportShowWindow(ImGuiViewport*) {}
+void viewportSetWindowTitle(ImGuiViewport*, const char*) {}
+
+void viewportRenderWindow(ImGuiViewport* viewport, void*) {
+  makeCurrent((ViewportData*)viewport->PlatformUserData);
+}
+
+void viewportSwapBuffers(ImGuiViewport* viewport, void*) {
+  ViewportData* vd = (ViewportData*)viewport->PlatformUserData;
+  makeCurrent(vd);
+  eglSwapBuffers(mainContext->display, vd->surface);
+}
+
+// ViewportPresenter callbacks, called from the present thread
+void presentSwapWindow(void* platformHandle) {
+  ViewportData* vd = (ViewportData*)platformHandle;
+  makeCurrent(vd);
+  eglSwapBuffers(mainContext->display, vd->surface);
+}
+
+void presentReleaseContext() {
+  eglMakeCurrent(mainContext->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+// Call before ImGui_ImplOpenGL3_Init(), which installs the renderer side of the platform interface
+void initViewports(Context* ctx) {
+  mainContext = ctx;
+  ImGuiIO& io = ImGui::GetIO();
+  io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+  io.BackendFlags |= ImGuiBackendFlags_PlatformHasViewports;
+
+  ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+  platformIO.Platform_CreateWindow = viewportCreateWindow;
+  platformIO.Platform_DestroyWindow = viewportDestroyWindow;
+  platformIO.Platform_GetWindowPos = viewportGetWindowPos;
+  platformIO.Platform_SetWindowPos = viewportSetWindowPos;
+  platformIO.Platform_GetWindowSize = viewportGetWindowSize;
+  platformIO.Platform_SetWindowSize = viewportSetWindowSize;
+  platformIO.Platform_ShowWindow = viewportShowWindow;
+  platformIO.Platform_SetWindowTitle = viewportSetWindowTitle;
+  platformIO.Platform_RenderWindow = viewportRenderWindow;
+  platformIO.Platform_SwapBuffers = viewportSwapBuffers;
+
+  // A single large monitor, so panels placed right of the main viewport are on screen
+  ImGuiPlatformMonitor monitor;
+  monitor.MainPos = monitor.WorkPos = ImVec2(0.0f, 0.0f);
+  monitor.MainSize = monitor.WorkSize = ImVec2(io.DisplaySize.x * 4.0f, io.DisplaySize.y * 4.0f);
+  platformIO.Monitors.push_back(monitor);
+
+  ViewportData* vd = IM_NEW(ViewportData)();
+  vd->surface = ctx->surface;
+  vd->context = ctx->context;
+  vd->pos = ImVec2(0.0f, 0.0f);
+  vd->size = io.DisplaySize;
+  vd->owned = false;
+  ImGuiViewport* mainViewport = ImGui::GetMainViewport();
+  mainViewport->PlatformUserData = mainViewport->PlatformHandle = vd;
+}
+
+// Scene
+// -----
+
+GLuint compileShader(GLenum type, const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "Error: can't open '%s'\n", filename);
+    return 0;
+  }
+  std::vector<char> source;
+  char buf[1024];
+  size_t read;
+  while ((read = fread(buf, 1, sizeof(buf), f)) > 0)
+    source.insert(source.end(), buf, buf + read);
+  source.push_back(0);
+  fclose(f);
+
+  GLuint shader = glCreateShader(type);
+  const GLchar* sourcePtr = source.data();
+  glShaderSource(shader, 1, &sourcePtr, NULL);
+  glCompileShader(shader);
+  GLint isCompiled = 0;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
+  if (isCompiled == GL_FALSE) {
+    char log[512] = "";
+    glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+    fprintf(stderr, "Error: compiling '%s' failed:\n%s\n", filename, log);
+    glDeleteShader(shader);
+    return 0;
+  }
+  return shader;
+}
+
+GLuint createSceneProgram() {
+  GLuint vertexShader = compileShader(GL_VERTEX_SHADER, SHADERS_DIR "/basic.vert");
+  GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, SHADERS_DIR "/basic.frag");
+  if (vertexShader == 0 || fragmentShader == 0)
+    return 0;
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertexShader);
+  glAttachShader(program, fragmentShader);
+  glLinkProgram(program);
+  glDetachShader(program, vertexShader);
+  glDetachShader(program, fragmentShader);
+  glDeleteShader(vertexShader);
+  glDeleteShader(fragmentShader);
+  GLint isLinked = 0;
+  glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+  if (isLinked == GL_FALSE) {
+    fprintf(stderr, "Error: linking scene program failed\n");
+    glDeleteProgram(program);
+    return 0;
+  }
+  return program;
+}
+
+// Column-major 4x4 matrices, matching what the app computes with glm
+struct Mat4 {
+  float m[16];
+};
+
+Mat4 identity() {
+  Mat4 r;
+  for (int n = 0; n < 16; n++)
+    r.m[n] = (n % 5 == 0) ? 1.0f : 0.0f;
+  return r;
+}
+
+Mat4 multiply(const Mat4& a, const Mat4& b) {
+  Mat4 r;
+  for (int column = 0; column < 4; column++)
+    for (int row = 0; row < 4; row++) {
+      float sum = 0.0f;
+      for (int k = 0; k < 4; k++)
+        sum += a.m[k * 4 + row] * b.m[column * 4 + k];
+      r.m[column * 4 + row] = sum;
+    }
+  return r;
+}
+
+Mat4 rotation(float angle, int axis) {
+  Mat4 r = identity();
+  const float c = cosf(angle), s = sinf(angle);
+  const int i = (axis + 1) % 3, j = (axis + 2) % 3;
+  r.m[i * 4 + i] = c;
+  r.m[j * 4 + j] = c;
+  r.m[i * 4 + j] = s;
+  r.m[j * 4 + i] = -s;
+  return r;
+}
+
+Mat4 perspective(float fovY, float aspect, float zNear, float zFar) {
+  Mat4 r;
+  memset(r.m, 0, sizeof(r.m));
+  const float f = 1.0f / tanf(fovY * 0.5f);
+  r.m[0] = f / aspect;
+  r.m[5] = f;
+  r.m[10] = -(zFar + zNear) / (zFar - zNear);
+  r.m[11] = -1.0f;
+  r.m[14] = -(2.0f * zFar * zNear) / (zFar - zNear);
+  return r;
+}
+
+// Same as the app's default state: camera at (0,0,-3) looking down +Z, cube animated at 'animationSpeed'
+void drawScene(const Scene::Cube& cube, double time, float aspect) {
+  const float animationSpeed = 0.390f;
+  const float angle = animationSpeed * (float)time;
+  Mat4 model = multiply(multiply(rotation(angle, 0), rotation(angle, 1)), rotation(angle, 2));
+
+  // lookAt(eye = (0,0,-3), center = (0,0,-2), up = (0,1,0)): looking down +Z flips X and Z
+  Mat4 view = identity();
+  view.m[0] = -1.0f;
+  view.m[10] = -1.0f;
+  view.m[14] = -3.0f;
+
+  Mat4 proj = perspective(45.0f * 3.14159265f / 180.0f, aspect, 0.01f, 1000.0f);
+  Scene::drawCube(cube, model.m, view.m, proj.m);
+}
+
+// Scripted UI
+// -----------
+// The mouse follows a Lissajous curve over the windows and scrolls periodically, without clicking.
+
+void feedInputs(ImGuiIO& io, int frame) {
+  const float t = frame * io.DeltaTime;
+  io.AddMousePosEvent(io.DisplaySize.x * (0.5f + 0.45f * sinf(t * 0.7f)), io.DisplaySize.y * (0.5f + 0.45f * sinf(t * 1.1f)));
+  if (frame % 20 == 0)
+    io.AddMouseWheelEvent(0.0f, (frame / 20) % 8 < 4 ? -1.0f : 1.0f);
+}
+
+// TableBenchmark's window isn't used here: it displays its own wall-clock timings, so its geometry changes between runs.
+void showTable() {
+  const int rowsCount = 10000;
+  ImGui::Begin("Table");
+  const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable;
+  if (ImGui::BeginTable("##Rows", 5, flags)) {
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("ID");
+    ImGui::TableSetupColumn("Name");
+    ImGui::TableSetupColumn("Quantity");
+    ImGui::TableSetupColumn("Price");
+    ImGui::TableSetupColumn("Progress");
+    ImGui::TableHeadersRow();
+    ImGuiListClipper clipper;
+    clipper.Begin(rowsCount);
+    while (clipper.Step())
+      for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%05d", row);
+        ImGui::TableNextColumn();
+        ImGui::Text("Item %d", (row * 7919) % rowsCount);
+        ImGui::TableNextColumn();
+        ImGui::Text("%d", (row * 31) % 1000);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.2f", ((row * 131) % 10000) / 100.0f);
+        ImGui::TableNextColumn();
+        ImGui::ProgressBar(((row * 17) % 100) / 100.0f, ImVec2(-FLT_MIN, 0.0f));
+      }
+    ImGui::EndTable();
+  }
+  ImGui::End();
+}
+
+void submitUI(int frame) {
+  static bool showTreeBenchmark = true;
+  ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
+  ImGui::ShowDemoWindow();
+
+  ImGui::SetNextWindowPos(ImVec2(420, 10), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSize(ImVec2(850, 450), ImGuiCond_FirstUseEver);
+  showTable();
+
+  ImGui::SetNextWindowPos(ImVec2(420, 470), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSize(ImVec2(420, 320), ImGuiCond_FirstUseEver);
+  TreeBenchmark::showWindow(&showTreeBenchmark);
+
+  // Same widgets as the app's "Object Attributes" window, with values animated by the script
+  ImGui::SetNextWindowPos(ImVec2(850, 470), ImGuiCond_FirstUseEver);
+  ImGui::Begin("Object Attributes");
+  float values[9];
+  for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+    values[n] = 0.5f + 0.5f * sinf(frame * 0.01f * (n + 1));
+  const char* labels[] = { "XRotate", "YRotate", "ZRotate", "ZAxis", "X", "Y", "Z", "W", "Animation Speed" };
+  for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+    ImGui::SliderFloat(labels[n], &values[n], 0.0f, 1.0f);
+  ImGui::End();
+}
+
+// Panels outside of the main viewport, each in its own platform window
+void submitPanels(int panelsCount, int frame) {
+  const ImVec2 mainSize = ImGui::GetMainViewport()->Size;
+  for (int n = 0; n < panelsCount; n++) {
+    ImGui::SetNextWindowPos(ImVec2(mainSize.x + 20.0f + (n % 4) * 340.0f, 20.0f + (n / 4) * 280.0f));
+    ImGui::SetNextWindowSize(ImVec2(320.0f, 260.0f));
+    char name[32];
+    snprintf(name, sizeof(name), "Panel %d", n);
+    ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+    for (int line = 0; line < 10; line++)
+      ImGui::Text("Line %d: %d", line, (frame + line * 7 + n) % 1000);
+    ImGui::ProgressBar(((frame + n * 13) % 100) / 100.0f);
+    ImGui::End();
+  }
+}
+
+// Report
+// ------
+
+struct Summary {
+  double mean, p50, p95, p99, max;
+};
+
+template<typename T>
+Summary summarize(const std::vector<FrameStats>& frames, T FrameStats::*field) {
+  std::vector<double> values;
+  for (const FrameStats& frame : frames)
+    values.push_back((double)(frame.*field));
+  std::sort(values.begin(), values.end());
+  Summary s = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+  if (values.empty())
+    return s;
+  for (double value : values)
+    s.mean += value / values.size();
+  s.p50 = values[(size_t)(0.50 * (values.size() - 1) + 0.5)];
+  s.p95 = values[(size_t)(0.95 * (values.size() - 1) + 0.5)];
+  s.p99 = values[(size_t)(0.99 * (values.size() - 1) + 0.5)];
+  s.max = values.back();
+  return s;
+}
+
+template<typename T>
+void writeSummary(FILE* f, const char* name, const std::vector<FrameStats>& frames, T FrameStats::*field, bool last = false) {
+  const Summary s = summarize(frames, field);
+  fprintf(f, "    \"%s\": { \"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }%s\n", name, s.mean, s.p50, s.p95, s.p99, s.max, last ? "" : ",");
+}
+
+// Hash of the last frame's geometry: changes whenever what we render changes
+ImU32 hashDrawData(const ImDrawData* drawData) {
+  ImU32 hash = 0;
+  for (const ImDrawList* drawList : drawData->CmdLists) {
+    hash = ImHashData(drawList->VtxBuffer.Data, drawList->VtxBuffer.size_in_bytes(), hash);
+    hash = ImHashData(drawList->IdxBuffer.Data, drawList->IdxBuffer.size_in_bytes(), hash);
+  }
+  return hash;
+}
+
+bool parseOptions(int argc, char** argv, Options* options) {
+  for (int n = 1; n < argc; n++) {
+    const bool hasValue = (n + 1 < argc);
+    if (strcmp(argv[n], "--frames") == 0 && hasValue)
+      options->frames = atoi(argv[++n]);
+    else if (strcmp(argv[n], "--warmup") == 0 && hasValue)
+      options->warmupFrames = atoi(argv[++n]);
+    else if (strcmp(argv[n], "--width") == 0 && hasValue)
+      options->width = atoi(argv[++n]);
+    else if (strcmp(argv[n], "--height") == 0 && hasValue)
+      options->height = atoi(argv[++n]);
+    else if (strcmp(argv[n], "--viewports") == 0 && hasValue)
+      options->viewports = atoi(argv[++n]);
+    else if (strcmp(argv[n], "--present") == 0 && hasValue)
+      options->presentMode = argv[++n];
+    else if (strcmp(argv[n], "--output") == 0 && hasValue)
+      options->outputFilename = argv[++n];
+    else {
+      fprintf(stderr, "Usage: %s [--frames N] [--warmup N] [--width W] [--height H] [--viewports N] [--present default|serial|thread] [--output file.json]\n", argv[0]);
+      return false;
+    }
+  }
+  const bool validPresentMode = strcmp(options->presentMode, "default") == 0 || strcmp(options->presentMode, "serial") == 0 || strcmp(options->presentMode, "thread") == 0;
+  return options->frames > 0 && options->warmupFrames >= 0 && options->width > 0 && options->height > 0 && options->viewports < ViewportPresenter::maxViewports && validPresentMode;
+}
+
+int run(const Options& options) {
+  Context context;
+  if (!createContext(&context, options.width, options.height))
+    return 1;
+
+  ImGui::SetAllocatorFunctions(countingAlloc, countingFree);
+  IMGUI_CHECKVERSION();
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = NULL; // Don't let a previous run's layout change this one
+  io.DisplaySize = ImVec2((float)options.width, (float)options.height);
+  io.DeltaTime = 1.0f / 60.0f;
+  io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+  ImGui::StyleColorsDark();
+  if (options.viewports >= 0)
+    initViewports(&context);
+  ImGui_ImplOpenGL3_Init("#version 330");
+  if (strcmp(options.presentMode, "thread") == 0)
+    ViewportPresenter::startThread(presentSwapWindow, presentReleaseContext);
+
+  GLuint program = createSceneProgram();
+  if (program == 0)
+    return 1;
+  Scene::Cube cube = Scene::createCube(program);
+  glEnable(GL_DEPTH_TEST);
+  glViewport(0, 0, options.width, options.height);
+
+  std::vector<FrameStats> frames;
+  frames.reserve(options.frames);
+  const int totalFrames = options.warmupFrames + options.frames;
+  for (int frame = 0; frame < totalFrames; frame++) {
+    FrameStats stats;
+    GLCallCounter::reset();
+    allocationsCount = allocatedBytes = 0;
+    makeCurrentCalls = 0;
+
+    const double t0 = now();
+    feedInputs(io, frame);
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui::NewFrame();
+    const double t1 = now();
+    submitUI(frame);
+    submitPanels(ImMax(options.viewports, 0), frame);
+    const double t2 = now();
+    ImGui::Render();
+    const double t3 = now();
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    drawScene(cube, frame * io.DeltaTime, (float)options.width / options.height);
+    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    const double t4 = now();
+    if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
+      if (strcmp(options.presentMode, "default") == 0) {
+        ImGui::UpdatePlatformWindows();
+        ImGui::RenderPlatformWindowsDefault();
+        makeMainContextCurrent();
+      } else {
+        ViewportPresenter::wait();
+        ImGui::UpdatePlatformWindows();
+        ViewportPresenter::renderPlatformWindows();
+        makeMainContextCurrent();
+        ViewportPresenter::present();
+      }
+    }
+    const double t5 = now();
+    glFinish();
+    const double t6 = now();
+
+    if (frame < options.warmupFrames)
+      continue;
+    const ImDrawData* drawData = ImGui::GetDrawData();
+    stats.newFrameMs = (t1 - t0) * 1000.0;
+    stats.uiMs = (t2 - t1) * 1000.0;
+    stats.renderMs = (t3 - t2) * 1000.0;
+    stats.renderDrawDataMs = (t4 - t3) * 1000.0;
+    stats.platformWindowsMs = (t5 - t4) * 1000.0;
+    stats.finishMs = (t6 - t5) * 1000.0;
+    stats.cpuMs = (t5 - t0) * 1000.0;
+    stats.frameMs = (t6 - t0) * 1000.0;
+    stats.glCalls = GLCallCounter::calls();
+    stats.drawCalls = GLCallCounter::drawCalls();
+    stats.allocations = allocationsCount;
+    stats.allocatedBytes = allocatedBytes;
+    stats.makeCurrentCalls = makeCurrentCalls;
+    stats.viewports = ImGui::GetPlatformIO().Viewports.Size;
+    stats.vertices = drawData->TotalVtxCount;
+    stats.indices = drawData->TotalIdxCount;
+    stats.drawLists = drawData->CmdListsCount;
+    stats.drawCmds = 0;
+    for (const ImDrawList* drawList : drawData->CmdLists)
+      stats.drawCmds += drawList->CmdBuffer.Size;
+    frames.push_back(stats);
+  }
+
+  FILE* f = options.outputFilename ? fopen(options.outputFilename, "w") : stdout;
+  if (f == NULL) {
+    fprintf(stderr, "Error: can't open '%s'\n", options.outputFilename);
+    return 1;
+  }
+  fprintf(f, "{\n");
+  fprintf(f, "  \"renderer\": \"%s\",\n", (const char*)glGetString(GL_RENDERER));
+  fprintf(f, "  \"imgui_version\": \"%s\",\n", IMGUI_VERSION);
+  fprintf(f, "  \"frames\": %d,\n  \"warmup_frames\": %d,\n  \"width\": %d,\n  \"height\": %d,\n  \"delta_time\": %.6f,\n",
+    options.frames, options.warmupFrames, options.width, options.height, io.DeltaTime);
+  fprintf(f, "  \"viewports\": %d,\n  \"present\": \"%s\",\n", options.viewports, options.presentMode);
+  fprintf(f, "  \"last_frame_draw_data_hash\": \"%08X\",\n", hashDrawData(ImGui::GetDrawData()));
+  fprintf(f, "  \"cpu_ms\": {\n");
+  writeSummary(f, "new_frame", frames, &FrameStats::newFrameMs);
+  writeSummary(f, "ui", frames, &FrameStats::uiMs);
+  writeSummary(f, "render", frames, &FrameStats::renderMs);
+  writeSummary(f, "render_draw_data", frames, &FrameStats::renderDrawDataMs);
+  writeSummary(f, "platform_windows", frames, &FrameStats::platformWindowsMs);
+  writeSummary(f, "gl_finish", frames, &FrameStats::finishMs);
+  writeSummary(f, "cpu", frames, &FrameStats::cpuMs);
+  writeSummary(f, "frame", frames, &FrameStats::frameMs, true);
+  fprintf(f, "  },\n");
+  fprintf(f, "  \"per_frame\": {\n");
+  writeSummary(f, "gl_calls", frames, &FrameStats::glCalls);
+  writeSummary(f, "draw_calls", frames, &FrameStats::drawCalls);
+  writeSummary(f, "make_current_calls", frames, &FrameStats::makeCurrentCalls);
+  writeSummary(f, "platform_viewports", frames, &FrameStats::viewports);
+  writeSummary(f, "draw_lists", frames, &FrameStats::drawLists);
+  writeSummary(f, "draw_cmds", frames, &FrameStats::drawCmds);
+  writeSummary(f, "vertices", frames, &FrameStats::vertices);
+  writeSummary(f, "indices", frames, &FrameStats::indices);
+  writeSummary(f, "allocations", frames, &FrameStats::allocations);
+  writeSummary(f, "allocated_bytes", frames, &FrameStats::allocatedBytes, true);
+  fprintf(f, "  }\n");
+  fprintf(f, "}\n");
+  if (f != stdout)
+    fclose(f);
+
+  ViewportPresenter::stopThread();
+  Scene::destroyCube(cube);
+  glDeleteProgram(program);
+  ImGui_ImplOpenGL3_Shutdown();
+  ImGui::DestroyContext();
+  destroyContext(&context);
+  return 0;
+}
+
+} // namespace HeadlessBench
+
+int main(int argc, char** argv) {
+  HeadlessBench::Options options;
+  if (!HeadlessBench::parseOptions(argc, argv, &options))
+    return 1;
+  return HeadlessBench::run(options);
+}
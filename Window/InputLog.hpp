@@ -0,0 +1,151 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Input log
+// ---------
+// Logs input callbacks to stdout without printing from the callbacks: a 1000 Hz mouse printing every move stalls the main
+// loop on a slow console. Callbacks only update counters or copy a line into a fixed-size ring, under a short lock.
+// A writer thread prints at most maxLinesPerFlush lines every flushIntervalMs.
+// - Consecutive mouse moves are summarized in a single line (count and summed offset). Pending moves are turned into a line
+//   before any other event's line, so lines stay in event order.
+// - When the ring is full, new lines are dropped and counted: logging never blocks on the console nor allocates.
+namespace InputLog {
+
+const int maxLines = 64;
+const int lineSize = 96;
+const int maxLinesPerFlush = 4;
+const int flushIntervalMs = 100;
+
+struct State {
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable condition;
+  char lines[maxLines][lineSize];
+  int linesHead;            // Oldest line
+  int linesCount;
+  int pendingMoves;         // Moves not turned into a line yet
+  float pendingDx, pendingDy;
+  unsigned int movesCount;  // Totals since start()
+  unsigned int linesWritten;
+  unsigned int linesDropped;
+  bool quit;
+  bool running;
+
+  State() {
+    linesHead = linesCount = pendingMoves = 0;
+    pendingDx = pendingDy = 0.0f;
+    movesCount = linesWritten = linesDropped = 0;
+    quit = running = false;
+  }
+};
+
+inline State& state() {
+  static State s;
+  return s;
+}
+
+// Lock must be held
+inline void addLineV(const char* fmt, va_list args) {
+  State& s = state();
+  if (s.linesCount == maxLines) {
+    s.linesDropped++;
+    return;
+  }
+  char* line = s.lines[(s.linesHead + s.linesCount) % maxLines];
+  vsnprintf(line, lineSize, fmt, args);
+  s.linesCount++;
+}
+
+inline void addLine(const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  addLineV(fmt, args);
+  va_end(args);
+}
+
+// Lock must be held
+inline void flushMoves() {
+  State& s = state();
+  if (s.pendingMoves == 0)
+    return;
+  addLine("mouse: %d moves, offset (%+.0f, %+.0f)", s.pendingMoves, s.pendingDx, s.pendingDy);
+  s.pendingMoves = 0;
+  s.pendingDx = s.pendingDy = 0.0f;
+}
+
+inline void threadMain() {
+  State& s = state();
+  char lines[maxLinesPerFlush][lineSize];
+  std::unique_lock<std::mutex> lock(s.mutex);
+  while (!s.quit) {
+    s.condition.wait_for(lock, std::chrono::milliseconds(flushIntervalMs), [&s] { return s.quit; });
+    flushMoves();
+    int count = 0;
+    for (; count < maxLinesPerFlush && s.linesCount > 0; count++) {
+      memcpy(lines[count], s.lines[s.linesHead], lineSize);
+      s.linesHead = (s.linesHead + 1) % maxLines;
+      s.linesCount--;
+    }
+    s.linesWritten += count;
+    lock.unlock();
+    for (int n = 0; n < count; n++)
+      fprintf(stdout, "%s\n", lines[n]);
+    if (count > 0)
+      fflush(stdout);
+    lock.lock();
+  }
+}
+
+inline void start() {
+  State& s = state();
+  if (s.running)
+    return;
+  s.quit = false;
+  s.thread = std::thread(threadMain);
+  s.running = true;
+}
+
+// Lines still queued are discarded
+inline void stop() {
+  State& s = state();
+  if (!s.running)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.quit = true;
+  }
+  s.condition.notify_all();
+  s.thread.join();
+  s.running = false;
+  if (s.linesDropped > 0)
+    fprintf(stdout, "input log: %u lines written, %u dropped\n", s.linesWritten, s.linesDropped);
+}
+
+inline void mouseMove(float dx, float dy) {
+  State& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.pendingMoves++;
+  s.pendingDx += dx;
+  s.pendingDy += dy;
+  s.movesCount++;
+}
+
+// Any other event, printf-style
+inline void event(const char* fmt, ...) {
+  State& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  flushMoves();
+  va_list args;
+  va_start(args, fmt);
+  addLineV(fmt, args);
+  va_end(args);
+}
+
+} // namespace InputLog
@@ -8,12 +8,20 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
-#include "../imgui/imgui.h" 
-#include "../imgui/imgui_impl_glfw.h"
-#include "../imgui/imgui_impl_opengl3.h"
+#include "../ImGui/imgui.h" 
+#include "../ImGui/imgui_impl_glfw.h"
+#include "../ImGui/imgui_impl_opengl3.h"
 
 #include <util.h> 
 
+#include "InputLog.hpp"
+#include "Profiler.hpp"
+#include "Scene.hpp"
+#include "TableBenchmark.hpp"
+#include "TreeBenchmark.hpp"
+#include "ViewportPresenter.hpp"
+#include "Workload.hpp"
+
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
 void mouse_callback(GLFWwindow* window, double xpos, double ypos);
@@ -35,6 +43,17 @@ static void glfw_error_callback(int error, const char* description){
   fprintf(stderr, "GLFW Error %d: %s\n", error, description);
 };
 
+// Called from the viewport present thread
+static void present_swap_window(void* platform_handle) {
+  GLFWwindow* viewport_window = (GLFWwindow*)platform_handle;
+  glfwMakeContextCurrent(viewport_window);
+  glfwSwapBuffers(viewport_window);
+}
+
+static void present_release_context() {
+  glfwMakeContextCurrent(NULL);
+}
+
 int main() {
 
   // glfw initialization and configuration
@@ -79,6 +98,12 @@ int main() {
   io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
   io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;         // Enable Widget Docking
   io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;       // Enable Multi-Viewport
+  io.IniSavingThreaded = true;                              // Write imgui.ini from a worker thread
+  io.ConfigInputCoalesceMouseEvents = true;                 // Merge mouse moves/wheels queued between two frames (high-rate mice)
+
+  // Record ImGui::NewFrame()/EndFrame()/Render() as profiler zones
+  Profiler::setThreadName("Main");
+  Profiler::installImGuiHooks(ImGui::GetCurrentContext());
 
   // Setup Dear ImGui style
   ImGui::StyleColorsDark();
@@ -91,6 +116,11 @@ int main() {
   bool show_demo_window = false;
   bool show_transformation_window = true;
   bool show_app_dockspace = true;
+  bool show_table_benchmark_window = false;
+  bool show_tree_benchmark_window = false;
+  bool show_profiler_window = false;
+  bool show_workload_window = false;
+  bool show_metrics_window = false;
   ImVec4 clear_color = ImVec4(0.0f, 0.0f, 0.0f, 1.0f);
 
   // Initialization and configuration of OpenGL state machine 
@@ -100,83 +130,19 @@ int main() {
   GLuint program = createShaderProgram(pVSFileName, pFSFileName);
   unsigned int vertexPositionLocation = glGetAttribLocation(program, "aPos");
   unsigned int vertexColorLocation = glGetAttribLocation(program, "aColor");
-  unsigned int modelMatrixLocation = glGetUniformLocation(program, "modelMatrix");
-  unsigned int projMatrixLocation = glGetUniformLocation(program, "projMatrix");
-  unsigned int viewMatrixLocation = glGetUniformLocation(program, "viewMatrix");
 
   std::cout << "[" << vertexPositionLocation << ", " << vertexColorLocation << "]" << std::endl;
 
   // set up vertex data (and buffer(s)) and configure vertex attributes
   // ------------------------------------------------------------------
-  float vertices[] = {
-    // Vertex Data            // Color Data
-    // back face (z: -1) 
-    -0.5f, -0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
-    0.5f, -0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
-    0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
-    0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
-    -0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
-    -0.5f, -0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
-
-    // front face (z: +1) 
-    -0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
-    0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
-    0.5f,  0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
-    0.5f,  0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
-    -0.5f,  0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
-    -0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
-
-    -0.5f,  0.5f,  0.5f,  0.0f, 0.0f, 1.0f,
-    -0.5f,  0.5f, -0.5f,  0.0f, 0.0f, 1.0f,
-    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f, 1.0f,
-    -0.5f, -0.5f, -0.5f,  0.0f, 0.0f, 1.0f,
-    -0.5f, -0.5f,  0.5f,  0.0f, 0.0f, 1.0f,
-    -0.5f,  0.5f,  0.5f,  0.0f, 0.0f, 1.0f,
-
-    0.5f,  0.5f,  0.5f,  1.0f, 1.0f, 0.0f,
-    0.5f,  0.5f, -0.5f,  1.0f, 1.0f, 0.0f,
-    0.5f, -0.5f, -0.5f,  1.0f, 1.0f, 0.0f,
-    0.5f, -0.5f, -0.5f,  1.0f, 1.0f, 0.0f,
-    0.5f, -0.5f,  0.5f,  1.0f, 1.0f, 0.0f,
-    0.5f,  0.5f,  0.5f,  1.0f, 1.0f, 0.0f,
-
-    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 1.0f,
-    0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 1.0f,
-    0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 1.0f,
-    0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 1.0f,
-    -0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 1.0f,
-    -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 1.0f,
-
-    -0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 1.0f,
-    0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 1.0f,
-    0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 1.0f,
-    0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 1.0f,
-    -0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 1.0f,
-    -0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 1.0f,
-  };
-
-  unsigned int VBO, VAO;
-  glGenVertexArrays(1, &VAO);
-  glGenBuffers(1, &VBO);
-
-  // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-  glBindVertexArray(VAO);
-
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-  // position attribute
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-  glEnableVertexAttribArray(0);
-  // color attribute
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-  glEnableVertexAttribArray(1);
-
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  Scene::Cube cube = Scene::createCube(program);
 
 
   //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
+  // Mouse callbacks log through a writer thread, rate-limited
+  InputLog::start();
+
   while (!glfwWindowShouldClose(window)) {
 
 
@@ -186,20 +152,39 @@ int main() {
     // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
     // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
 
+    Profiler::beginFrame();
+
     float currentFrame = glfwGetTime();
     deltaTime = currentFrame - lastFrame;
     lastFrame = currentFrame;
 
-    glfwPollEvents();
-    processInput(window);
+    {
+      Profiler::CpuZone zone("PollEvents");
+      glfwPollEvents();
+      processInput(window);
+    }
 
-    ImGui_ImplOpenGL3_NewFrame();
-    ImGui_ImplGlfw_NewFrame();
-    ImGui::NewFrame();
+    {
+      Profiler::CpuZone zone("NewFrame");
+      ImGui_ImplOpenGL3_NewFrame();
+      ImGui_ImplGlfw_NewFrame();
+      ImGui::NewFrame();
+    }
+    Profiler::pushZone("UI");
 
     // 1. Show the big demo window (Most of the sample code is in ImGui::ShowDemoWindow()! You can browse its code to learn more about Dear ImGui!).
     if (show_demo_window)
       ImGui::ShowDemoWindow(&show_demo_window);
+    if (show_table_benchmark_window)
+      TableBenchmark::showWindow(&show_table_benchmark_window);
+    if (show_tree_benchmark_window)
+      TreeBenchmark::showWindow(&show_tree_benchmark_window);
+    if (show_profiler_window)
+      Profiler::showWindow(&show_profiler_window);
+    if (show_workload_window)
+      Workload::showWindow(&show_workload_window);
+    if (show_metrics_window)
+      ImGui::ShowMetricsWindow(&show_metrics_window);
 
     static float xRotationf = 0.0f;
     static float yRotationf = 0.0f;
@@ -279,6 +264,23 @@ int main() {
           if (ImGui::MenuItem("Flag: NoResize",               "", (dockspace_flags & ImGuiDockNodeFlags_NoResize) != 0))                   { dockspace_flags ^= ImGuiDockNodeFlags_NoResize; }
           if (ImGui::MenuItem("Flag: AutoHideTabBar",         "", (dockspace_flags & ImGuiDockNodeFlags_AutoHideTabBar) != 0))             { dockspace_flags ^= ImGuiDockNodeFlags_AutoHideTabBar; }
           if (ImGui::MenuItem("Flag: PassthruCentralNode",    "", (dockspace_flags & ImGuiDockNodeFlags_PassthruCentralNode) != 0, opt_fullscreen)) { dockspace_flags ^= ImGuiDockNodeFlags_PassthruCentralNode; }
+          ImGui::Separator();
+
+          if (ImGui::MenuItem("Present viewports from a thread", "", ViewportPresenter::threadRunning())) {
+            if (ViewportPresenter::threadRunning())
+              ViewportPresenter::stopThread();
+            else
+              ViewportPresenter::startThread(present_swap_window, present_release_context);
+          }
+          ImGui::EndMenu();
+        }
+        if (ImGui::BeginMenu("Tools"))
+        {
+          ImGui::MenuItem("Table Benchmark", NULL, &show_table_benchmark_window);
+          ImGui::MenuItem("Tree Benchmark", NULL, &show_tree_benchmark_window);
+          ImGui::MenuItem("Profiler", NULL, &show_profiler_window);
+          ImGui::MenuItem("Workloads", NULL, &show_workload_window);
+          ImGui::MenuItem("Metrics/Debugger", NULL, &show_metrics_window);
           ImGui::EndMenu();
         }
         ImGui::EndMenuBar();
@@ -310,54 +312,80 @@ int main() {
 
 
     // ImGui::ColorEdit3("clear color", (float*)&clear_color); // Edit 3 floats representing a color
+    Profiler::popZone(); // UI
 
 
 
 
     int display_w, display_h;
     glfwGetFramebufferSize(window, &display_w, &display_h);
-    glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     glm::mat4 modelMatrix = glm::mat4(1.0f);
-    modelMatrix = glm::translate(modelMatrix, glm::vec3(0.0, 0.0f, 1.0f * zAxisf));
-    modelMatrix = glm::rotate(modelMatrix, animationSpeed * (float)glfwGetTime() + xRotationf, glm::vec3(1.0f, 0.0f, 0.0f));
-    modelMatrix = glm::rotate(modelMatrix, animationSpeed * (float)glfwGetTime() + yRotationf, glm::vec3(0.0f, 1.0f, 0.0f));
-    modelMatrix = glm::rotate(modelMatrix, animationSpeed * (float)glfwGetTime() + zRotationf, glm::vec3(0.0f, 0.0f, 1.0f));
-    glUniformMatrix4fv(modelMatrixLocation, 1, GL_FALSE, glm::value_ptr(modelMatrix));
-
     glm::mat4 projMatrix = glm::mat4(1.0f);
-    projMatrix = glm::perspective(glm::radians(fov), (float) width/ (float) height, 0.01f, 1000.0f);
-    glUniformMatrix4fv(projMatrixLocation, 1, GL_FALSE, glm::value_ptr(projMatrix));
-
     glm::mat4 view;
-    view = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
-    glUniformMatrix4fv(viewMatrixLocation, 1, GL_FALSE, glm::value_ptr(view));
-
+    {
+      Profiler::CpuZone zone("Scene update");
+      modelMatrix = glm::translate(modelMatrix, glm::vec3(0.0, 0.0f, 1.0f * zAxisf));
+      modelMatrix = glm::rotate(modelMatrix, animationSpeed * (float)glfwGetTime() + xRotationf, glm::vec3(1.0f, 0.0f, 0.0f));
+      modelMatrix = glm::rotate(modelMatrix, animationSpeed * (float)glfwGetTime() + yRotationf, glm::vec3(0.0f, 1.0f, 0.0f));
+      modelMatrix = glm::rotate(modelMatrix, animationSpeed * (float)glfwGetTime() + zRotationf, glm::vec3(0.0f, 0.0f, 1.0f));
+      projMatrix = glm::perspective(glm::radians(fov), (float) width/ (float) height, 0.01f, 1000.0f);
+      view = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
+    }
 
-    glUseProgram(program);
-    glBindVertexArray(VAO);
-    glDrawArrays(GL_TRIANGLES, 0, 36); 
+    {
+      Profiler::CpuZone zone("Scene draw");
+      Profiler::GpuZone gpuZone("Scene draw");
+      glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
+      glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+      Scene::drawCube(cube, glm::value_ptr(modelMatrix), glm::value_ptr(view), glm::value_ptr(projMatrix));
+    }
 
-    ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    {
+      Profiler::CpuZone zone("Render");
+      ImGui::Render();
+    }
+    {
+      Profiler::CpuZone zone("RenderDrawData");
+      Profiler::GpuZone gpuZone("RenderDrawData");
+      ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    }
 
     // Update and Render additional Platform Windows
-    // (Platform functions may change the current OpenGL context, so we save/restore it to make it easier to paste this code elsewhere.
-    //  For this specific demo app we could also call glfwMakeContextCurrent(window) directly)
+    // (Rendering a viewport makes its context current: switch back to the main window's context, only if one was rendered.
+    //  With the present thread, secondary viewports are swapped from there while we swap the main window.)
+    // GPU zones can't be used here: queries belong to the main window's context.
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
     {
-      GLFWwindow* backup_current_context = glfwGetCurrentContext();
+      Profiler::CpuZone zone("Platform windows");
+      ViewportPresenter::wait();
       ImGui::UpdatePlatformWindows();
-      ImGui::RenderPlatformWindowsDefault();
-      glfwMakeContextCurrent(backup_current_context);
+      ViewportPresenter::renderPlatformWindows();
+      if (glfwGetCurrentContext() != window)
+        glfwMakeContextCurrent(window);
+      ViewportPresenter::present();
+    }
+
+    {
+      Profiler::CpuZone zone("SwapBuffers");
+      glfwSwapBuffers(window);
     }
 
-    glfwSwapBuffers(window);
+    // Workload scenarios use their own ImGui context, so they run between frames
+    {
+      Profiler::CpuZone zone("Workloads");
+      Workload::runPending();
+    }
+    Profiler::endFrame();
   }
 
 
   // Cleanup
+  Scene::destroyCube(cube);
+  ViewportPresenter::stopThread();
+  InputLog::stop();
+  Profiler::shutdown();
+  Workload::shutdown();
   ImGui_ImplOpenGL3_Shutdown();
   ImGui_ImplGlfw_Shutdown();
   ImGui::DestroyContext();
@@ -402,7 +430,7 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
 // --------------------------------------------------------------------------------------
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
   if (button == GLFW_MOUSE_BUTTON_RIGHT && action == GLFW_PRESS)
-    printf("pressed");
+    InputLog::event("mouse: right button pressed");
 };
 
 
@@ -412,5 +440,5 @@ void mouse_callback(GLFWwindow* window, double xpos, double ypos){
   lastX = xpos;
   lastY = ypos;
 
-  std::cout << "(" << xoffset << "," << yoffset << ")" << std::endl;
+  InputLog::mouseMove(xoffset, yoffset);
 }
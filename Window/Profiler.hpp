@@ -0,0 +1,693 @@
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#include <glad/glad.h>
+
+#include "../ImGui/imgui.h"
+#include "../ImGui/imgui_internal.h"
+
+// Frame profiler: hierarchical CPU zones + GPU timer queries
+// ----------------------------------------------------------
+// Call beginFrame() at the top of the main loop and endFrame() after swapping buffers, everything in between
+// is recorded under a root "Frame" zone. Scope CPU work with Profiler::CpuZone and GL work with Profiler::GpuZone.
+// - GPU zones use GL_TIME_ELAPSED queries, which can't be nested: GpuZone scopes must not overlap.
+// - Query results are read gpuQueryFrames frames later, and only if available, so the CPU never waits on the GPU.
+// - The last historySize frames are kept to compute per-zone percentiles.
+// Zones can also be captured to a Chrome trace file (chrome://tracing, https://ui.perfetto.dev), see startCapture().
+namespace Profiler {
+
+const int historySize = 300;
+const int maxCpuZones = 64;
+const int maxGpuZones = 8;
+const int maxDepth = 16;
+const int gpuQueryFrames = 3; // Drivers commonly queue 2 frames ahead, reading results 3 frames later doesn't stall
+
+struct CpuZoneRecord {
+  const char* name;
+  int depth;
+  float startMs; // Relative to the start of the frame
+  float endMs;
+};
+
+struct GpuZoneRecord {
+  const char* name;
+  float ms;
+};
+
+struct FrameRecord {
+  CpuZoneRecord cpuZones[maxCpuZones];
+  GpuZoneRecord gpuZones[maxGpuZones];
+  int cpuZonesCount;
+  int gpuZonesCount;
+  bool gpuResolved; // GPU zones have their timings
+};
+
+struct GpuQueryFrame {
+  GLuint queries[maxGpuZones];
+  int queriesCount;
+  int historyIdx; // Frame that issued the queries, -1 when nothing is pending
+};
+
+struct State {
+  FrameRecord history[historySize];
+  int historyIdx;    // Frame being recorded
+  int framesCount;   // Number of recorded frames, up to historySize
+  double frameStartTime;
+  int stack[maxDepth];
+  const char* stackNames[maxDepth];
+  int stackSize;
+  int captureFramesLeft;     // Capture started from the window: stop and write after this many frames
+  char captureFilename[256];
+  char captureStatus[320];
+  GpuQueryFrame gpuFrames[gpuQueryFrames];
+  int gpuFrameIdx;
+  bool gpuZoneOpen;
+  bool gpuInitialized;
+
+  State() {
+    memset(this, 0, sizeof(*this));
+    for (int n = 0; n < gpuQueryFrames; n++)
+      gpuFrames[n].historyIdx = -1;
+  }
+};
+
+inline State& state() {
+  static State s;
+  return s;
+}
+
+inline double now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline float frameTimeMs() {
+  return (float)((now() - state().frameStartTime) * 1000.0);
+}
+
+// Trace capture
+// -------------
+// Each thread appends events to its own chunked buffer, so recording is a timestamp and a few stores, without locks.
+// - A thread registers its buffer on first use (lock-free push to a global list). Buffers are never freed.
+// - Events are published with a release store of the chunk count, a reader only sees complete events.
+// - Starting a capture bumps the capture generation, each thread resets its own buffer when it notices.
+// - Buffers are read by writeCapture() after stopCapture(), from the thread that started the capture.
+
+const int traceChunkSize = 4096;
+
+struct TraceEvent {
+  const char* name; // Needs to be a string literal or otherwise persist until the capture is written
+  ImU64 timeNs;
+  char phase;       // 'B' or 'E'
+};
+
+struct TraceChunk {
+  TraceEvent events[traceChunkSize];
+  std::atomic<int> count;
+  std::atomic<TraceChunk*> next;
+  TraceChunk() : count(0), next(NULL) {}
+};
+
+struct TraceThreadBuffer {
+  TraceChunk firstChunk;
+  TraceChunk* currentChunk;
+  std::atomic<int> generation;
+  int threadId;
+  const char* threadName;
+  TraceThreadBuffer* next;
+  TraceThreadBuffer() : currentChunk(&firstChunk), generation(0), threadId(0), threadName(NULL), next(NULL) {}
+};
+
+struct TraceState {
+  std::atomic<bool> capturing;
+  std::atomic<int> generation;
+  std::atomic<int> threadsCount;
+  std::atomic<TraceThreadBuffer*> threads;
+  ImU64 startTimeNs;
+  ImU64 stopTimeNs;
+  double eventCostNs;  // Measured by startCapture(), to estimate the overhead of a capture
+  TraceState() : capturing(false), generation(0), threadsCount(0), threads(NULL), startTimeNs(0), stopTimeNs(0), eventCostNs(0.0) {}
+};
+
+inline TraceState& traceState() {
+  static TraceState s;
+  return s;
+}
+
+inline ImU64 nowNs() {
+  return (ImU64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline TraceThreadBuffer* traceThreadBuffer() {
+  static thread_local TraceThreadBuffer* buffer = NULL;
+  if (buffer == NULL) {
+    TraceState& ts = traceState();
+    buffer = new TraceThreadBuffer();
+    buffer->threadId = ++ts.threadsCount;
+    TraceThreadBuffer* head = ts.threads.load(std::memory_order_relaxed);
+    do {
+      buffer->next = head;
+    } while (!ts.threads.compare_exchange_weak(head, buffer, std::memory_order_release, std::memory_order_relaxed));
+  }
+  return buffer;
+}
+
+inline void traceEvent(char phase, const char* name) {
+  TraceState& ts = traceState();
+  if (!ts.capturing.load(std::memory_order_relaxed))
+    return;
+  TraceThreadBuffer* buffer = traceThreadBuffer();
+  const int generation = ts.generation.load(std::memory_order_acquire);
+  if (buffer->generation.load(std::memory_order_relaxed) != generation) {
+    for (TraceChunk* chunk = &buffer->firstChunk; chunk != NULL; chunk = chunk->next.load(std::memory_order_relaxed))
+      chunk->count.store(0, std::memory_order_relaxed);
+    buffer->currentChunk = &buffer->firstChunk;
+    buffer->generation.store(generation, std::memory_order_release);
+  }
+  TraceChunk* chunk = buffer->currentChunk;
+  int count = chunk->count.load(std::memory_order_relaxed);
+  if (count == traceChunkSize) {
+    TraceChunk* nextChunk = chunk->next.load(std::memory_order_relaxed);
+    if (nextChunk == NULL) {
+      nextChunk = new TraceChunk();
+      chunk->next.store(nextChunk, std::memory_order_release);
+    }
+    chunk = buffer->currentChunk = nextChunk;
+    count = 0;
+  }
+  TraceEvent& event = chunk->events[count];
+  event.name = name;
+  event.timeNs = nowNs();
+  event.phase = phase;
+  chunk->count.store(count + 1, std::memory_order_release);
+}
+
+inline void traceBegin(const char* name) { traceEvent('B', name); }
+inline void traceEnd(const char* name)   { traceEvent('E', name); }
+
+// Name the calling thread in captures. 'name' needs to persist.
+inline void setThreadName(const char* name) {
+  traceThreadBuffer()->threadName = name;
+}
+
+// Trace-only zone, can be used from any thread
+struct TraceZone {
+  const char* name;
+  TraceZone(const char* name) : name(name) { traceBegin(name); }
+  ~TraceZone() { traceEnd(name); }
+};
+
+inline void startCapture() {
+  TraceState& ts = traceState();
+  if (ts.capturing)
+    return;
+
+  // Measure what recording an event costs on this machine, in a buffer that isn't part of the capture
+  TraceThreadBuffer* buffer = traceThreadBuffer();
+  ts.generation++;
+  ts.capturing = true;
+  const int calibrationEventsCount = 2000;
+  const ImU64 calibrationStartNs = nowNs();
+  for (int n = 0; n < calibrationEventsCount; n++)
+    traceEvent((n & 1) ? 'E' : 'B', "Calibration");
+  ts.eventCostNs = (double)(nowNs() - calibrationStartNs) / calibrationEventsCount;
+  buffer->generation.store(-1, std::memory_order_relaxed); // Drop calibration events
+
+  ts.startTimeNs = nowNs();
+  ts.generation++;
+}
+
+inline void stopCapture() {
+  TraceState& ts = traceState();
+  ts.capturing = false;
+  ts.stopTimeNs = nowNs();
+}
+
+inline int countCaptureEvents() {
+  TraceState& ts = traceState();
+  int eventsCount = 0;
+  for (TraceThreadBuffer* buffer = ts.threads.load(std::memory_order_acquire); buffer != NULL; buffer = buffer->next)
+    if (buffer->generation.load(std::memory_order_acquire) == ts.generation)
+      for (TraceChunk* chunk = &buffer->firstChunk; chunk != NULL; chunk = chunk->next.load(std::memory_order_acquire))
+        eventsCount += chunk->count.load(std::memory_order_acquire);
+  return eventsCount;
+}
+
+inline void writeJsonString(FILE* f, const char* str) {
+  fputc('"', f);
+  for (const char* p = str; *p; p++) {
+    if (*p == '"' || *p == '\\')
+      fputc('\\', f);
+    if ((unsigned char)*p >= 0x20)
+      fputc(*p, f);
+  }
+  fputc('"', f);
+}
+
+// Write the last capture in Chrome trace JSON format. Returns the number of events written, -1 on error.
+inline int writeCapture(const char* filename) {
+  TraceState& ts = traceState();
+  IM_ASSERT(!ts.capturing && "Call stopCapture() first!");
+  FILE* f = fopen(filename, "wb");
+  if (f == NULL)
+    return -1;
+  int eventsCount = 0;
+  fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  for (TraceThreadBuffer* buffer = ts.threads.load(std::memory_order_acquire); buffer != NULL; buffer = buffer->next) {
+    if (buffer->generation.load(std::memory_order_acquire) != ts.generation)
+      continue;
+    fprintf(f, "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", eventsCount > 0 ? ",\n" : "", buffer->threadId);
+    if (buffer->threadName != NULL)
+      writeJsonString(f, buffer->threadName);
+    else
+      fprintf(f, "\"Thread %d\"", buffer->threadId);
+    fprintf(f, "}}");
+    for (TraceChunk* chunk = &buffer->firstChunk; chunk != NULL; chunk = chunk->next.load(std::memory_order_acquire)) {
+      const int count = chunk->count.load(std::memory_order_acquire);
+      for (int n = 0; n < count; n++) {
+        const TraceEvent& event = chunk->events[n];
+        const double timeUs = event.timeNs >= ts.startTimeNs ? (event.timeNs - ts.startTimeNs) / 1000.0 : 0.0;
+        fprintf(f, ",\n{\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":", event.phase, buffer->threadId, timeUs);
+        writeJsonString(f, event.name);
+        fputc('}', f);
+      }
+      eventsCount += count;
+    }
+  }
+  fprintf(f, "\n]}\n");
+  const bool ok = (ferror(f) == 0);
+  fclose(f);
+  return ok ? eventsCount : -1;
+}
+
+// Capture 'framesCount' frames then write them to 'filename', from endFrame()
+inline void captureFrames(int framesCount, const char* filename) {
+  State& s = state();
+  ImStrncpy(s.captureFilename, filename, IM_ARRAYSIZE(s.captureFilename));
+  s.captureFramesLeft = framesCount;
+  snprintf(s.captureStatus, sizeof(s.captureStatus), "Capturing %d frames...", framesCount);
+  startCapture();
+}
+
+// Emit ImGui::NewFrame()/EndFrame()/Render() as zones, using the context hooks
+inline void imguiContextHook(ImGuiContext*, ImGuiContextHook* hook);
+
+inline void installImGuiHooks(ImGuiContext* ctx) {
+  const ImGuiContextHookType types[] = {
+    ImGuiContextHookType_NewFramePre, ImGuiContextHookType_NewFramePost,
+    ImGuiContextHookType_EndFramePre, ImGuiContextHookType_EndFramePost,
+    ImGuiContextHookType_RenderPre, ImGuiContextHookType_RenderPost,
+  };
+  for (int n = 0; n < IM_ARRAYSIZE(types); n++) {
+    ImGuiContextHook hook;
+    hook.Type = types[n];
+    hook.Callback = imguiContextHook;
+    ImGui::AddContextHook(ctx, &hook);
+  }
+}
+
+inline void pushZone(const char* name) {
+  State& s = state();
+  FrameRecord& frame = s.history[s.historyIdx];
+  if (s.stackSize < maxDepth) {
+    int zoneIdx = -1;
+    if (frame.cpuZonesCount < maxCpuZones) {
+      zoneIdx = frame.cpuZonesCount++;
+      CpuZoneRecord& zone = frame.cpuZones[zoneIdx];
+      zone.name = name;
+      zone.depth = s.stackSize;
+      zone.startMs = zone.endMs = frameTimeMs();
+    }
+    s.stack[s.stackSize] = zoneIdx;
+    s.stackNames[s.stackSize] = name;
+  }
+  s.stackSize++; // Zones past maxDepth/maxCpuZones are dropped but we keep push/pop balanced
+  traceBegin(name);
+}
+
+inline void popZone() {
+  State& s = state();
+  IM_ASSERT(s.stackSize > 0 && "Unbalanced profiler zones!");
+  s.stackSize--;
+  if (s.stackSize < maxDepth && s.stack[s.stackSize] != -1)
+    s.history[s.historyIdx].cpuZones[s.stack[s.stackSize]].endMs = frameTimeMs();
+  traceEnd(s.stackSize < maxDepth ? s.stackNames[s.stackSize] : "");
+}
+
+inline void imguiContextHook(ImGuiContext*, ImGuiContextHook* hook) {
+  switch (hook->Type) {
+  case ImGuiContextHookType_NewFramePre: pushZone("ImGui::NewFrame"); break;
+  case ImGuiContextHookType_EndFramePre: pushZone("ImGui::EndFrame"); break;
+  case ImGuiContextHookType_RenderPre:   pushZone("ImGui::Render"); break;
+  default:                               popZone(); break;
+  }
+}
+
+// Read back the queries issued gpuQueryFrames ago, if the GPU is done with them.
+inline void resolveGpuQueries(GpuQueryFrame& gpuFrame) {
+  State& s = state();
+  if (gpuFrame.historyIdx == -1)
+    return;
+  if (gpuFrame.queriesCount > 0) {
+    GLint available = 0;
+    glGetQueryObjectiv(gpuFrame.queries[gpuFrame.queriesCount - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+      gpuFrame.historyIdx = -1; // Drop the sample rather than stall
+      return;
+    }
+  }
+  // Some drivers report garbage for the very first queries of a context: drop samples longer than a second
+  FrameRecord& frame = s.history[gpuFrame.historyIdx];
+  bool valid = true;
+  for (int n = 0; n < gpuFrame.queriesCount; n++) {
+    GLuint64 ns = 0;
+    glGetQueryObjectui64v(gpuFrame.queries[n], GL_QUERY_RESULT, &ns);
+    frame.gpuZones[n].ms = (float)(ns / 1000000.0);
+    valid &= (ns < 1000000000);
+  }
+  frame.gpuResolved = valid;
+  gpuFrame.historyIdx = -1;
+}
+
+inline void beginFrame() {
+  State& s = state();
+  if (!s.gpuInitialized) {
+    for (int n = 0; n < gpuQueryFrames; n++)
+      glGenQueries(maxGpuZones, s.gpuFrames[n].queries);
+    s.gpuInitialized = true;
+  }
+  s.gpuFrameIdx = (s.gpuFrameIdx + 1) % gpuQueryFrames;
+  GpuQueryFrame& gpuFrame = s.gpuFrames[s.gpuFrameIdx];
+  resolveGpuQueries(gpuFrame);
+
+  FrameRecord& frame = s.history[s.historyIdx];
+  frame.cpuZonesCount = frame.gpuZonesCount = 0;
+  frame.gpuResolved = false;
+  gpuFrame.queriesCount = 0;
+  gpuFrame.historyIdx = s.historyIdx;
+  s.frameStartTime = now();
+  s.stackSize = 0;
+  pushZone("Frame");
+}
+
+inline void endFrame() {
+  State& s = state();
+  popZone();
+  IM_ASSERT(s.stackSize == 0 && "Unbalanced profiler zones!");
+  s.historyIdx = (s.historyIdx + 1) % historySize;
+  if (s.framesCount < historySize)
+    s.framesCount++;
+
+  if (s.captureFramesLeft > 0 && --s.captureFramesLeft == 0) {
+    stopCapture();
+    TraceState& ts = traceState();
+    const int eventsCount = writeCapture(s.captureFilename);
+    const double captureMs = (ts.stopTimeNs - ts.startTimeNs) / 1000000.0;
+    if (eventsCount < 0)
+      snprintf(s.captureStatus, sizeof(s.captureStatus), "Error writing '%.200s'", s.captureFilename);
+    else
+      snprintf(s.captureStatus, sizeof(s.captureStatus), "Wrote %d events to '%.200s'. Estimated overhead: %.3g%% (%.0f ns/event)",
+        eventsCount, s.captureFilename, captureMs > 0.0 ? eventsCount * ts.eventCostNs / (captureMs * 10000.0) : 0.0, ts.eventCostNs);
+  }
+}
+
+inline void beginGpuZone(const char* name) {
+  State& s = state();
+  IM_ASSERT(!s.gpuZoneOpen && "GPU zones can't be nested!");
+  GpuQueryFrame& gpuFrame = s.gpuFrames[s.gpuFrameIdx];
+  FrameRecord& frame = s.history[s.historyIdx];
+  if (frame.gpuZonesCount >= maxGpuZones)
+    return;
+  frame.gpuZones[frame.gpuZonesCount].name = name;
+  frame.gpuZones[frame.gpuZonesCount].ms = 0.0f;
+  glBeginQuery(GL_TIME_ELAPSED, gpuFrame.queries[gpuFrame.queriesCount]);
+  frame.gpuZonesCount++;
+  gpuFrame.queriesCount++;
+  s.gpuZoneOpen = true;
+}
+
+inline void endGpuZone() {
+  State& s = state();
+  if (!s.gpuZoneOpen)
+    return;
+  glEndQuery(GL_TIME_ELAPSED);
+  s.gpuZoneOpen = false;
+}
+
+// Needs to be called while the GL context is still alive
+inline void shutdown() {
+  State& s = state();
+  if (!s.gpuInitialized)
+    return;
+  for (int n = 0; n < gpuQueryFrames; n++)
+    glDeleteQueries(maxGpuZones, s.gpuFrames[n].queries);
+  s.gpuInitialized = false;
+}
+
+struct CpuZone {
+  CpuZone(const char* name) { pushZone(name); }
+  ~CpuZone() { popZone(); }
+};
+
+struct GpuZone {
+  GpuZone(const char* name) { beginGpuZone(name); }
+  ~GpuZone() { endGpuZone(); }
+};
+
+// Window
+// ------
+
+struct ZoneStats {
+  const char* name;
+  int depth;
+  bool gpu;
+  float lastMs;
+  float avgMs;
+  float p50Ms;
+  float p95Ms;
+  float p99Ms;
+  float maxMs;
+};
+
+inline ImU32 zoneColor(const char* name, bool gpu) {
+  float r, g, b;
+  const float hue = (ImHashStr(name) & 0xFFFF) / 65535.0f;
+  ImGui::ColorConvertHSVtoRGB(hue, gpu ? 0.35f : 0.55f, 0.75f, r, g, b);
+  return ImGui::GetColorU32(ImVec4(r, g, b, 1.0f));
+}
+
+// Returns the frame recorded 'framesAgo' frames before the last complete one
+inline const FrameRecord& getFrame(int framesAgo) {
+  State& s = state();
+  return s.history[(s.historyIdx - 1 - framesAgo + historySize * 2) % historySize];
+}
+
+inline float percentile(const float* sortedValues, int count, float p) {
+  return count > 0 ? sortedValues[(int)(p * (count - 1) + 0.5f)] : 0.0f;
+}
+
+// Gather per-frame totals of each zone name over the recorded history.
+// Zone names are string literals so we compare pointers.
+inline int computeStats(ZoneStats* out, int outSize) {
+  State& s = state();
+  static float samples[historySize];
+  const FrameRecord& last = getFrame(0);
+  int statsCount = 0;
+  for (int pass = 0; pass < 2; pass++) {
+    const bool gpu = (pass == 1);
+    const int zonesCount = gpu ? last.gpuZonesCount : last.cpuZonesCount;
+    for (int zoneN = 0; zoneN < zonesCount && statsCount < outSize; zoneN++) {
+      const char* name = gpu ? last.gpuZones[zoneN].name : last.cpuZones[zoneN].name;
+      bool seen = false;
+      for (int n = 0; n < statsCount; n++)
+        seen |= (out[n].name == name && out[n].gpu == gpu);
+      if (seen)
+        continue;
+
+      int samplesCount = 0;
+      float sum = 0.0f;
+      for (int frameN = 0; frameN < s.framesCount; frameN++) {
+        const FrameRecord& frame = getFrame(frameN);
+        if (gpu && !frame.gpuResolved)
+          continue;
+        float total = 0.0f;
+        bool found = false;
+        const int frameZonesCount = gpu ? frame.gpuZonesCount : frame.cpuZonesCount;
+        for (int n = 0; n < frameZonesCount; n++) {
+          if (gpu && frame.gpuZones[n].name == name) {
+            total += frame.gpuZones[n].ms;
+            found = true;
+          } else if (!gpu && frame.cpuZones[n].name == name) {
+            total += frame.cpuZones[n].endMs - frame.cpuZones[n].startMs;
+            found = true;
+          }
+        }
+        if (!found)
+          continue;
+        if (samplesCount == 0)
+          out[statsCount].lastMs = total;
+        samples[samplesCount++] = total;
+        sum += total;
+      }
+      if (samplesCount == 0)
+        continue;
+      std::sort(samples, samples + samplesCount);
+      ZoneStats& stats = out[statsCount++];
+      stats.name = name;
+      stats.depth = gpu ? 0 : last.cpuZones[zoneN].depth;
+      stats.gpu = gpu;
+      stats.avgMs = sum / samplesCount;
+      stats.p50Ms = percentile(samples, samplesCount, 0.50f);
+      stats.p95Ms = percentile(samples, samplesCount, 0.95f);
+      stats.p99Ms = percentile(samples, samplesCount, 0.99f);
+      stats.maxMs = samples[samplesCount - 1];
+    }
+  }
+  return statsCount;
+}
+
+// Flame graph of one frame: CPU zones stacked by depth, GPU zones laid out one after the other below them.
+inline void showFlameGraph(const FrameRecord& frame) {
+  const float rowHeight = ImGui::GetFrameHeight();
+  int depthsCount = 1;
+  for (int n = 0; n < frame.cpuZonesCount; n++)
+    depthsCount = ImMax(depthsCount, frame.cpuZones[n].depth + 1);
+  const float frameMs = ImMax(frame.cpuZones[0].endMs - frame.cpuZones[0].startMs, 0.001f);
+
+  const ImVec2 size(ImGui::GetContentRegionAvail().x, rowHeight * (depthsCount + 1));
+  const ImVec2 pos = ImGui::GetCursorScreenPos();
+  ImGui::InvisibleButton("##FlameGraph", size);
+  const float msToPixels = size.x / frameMs;
+  ImDrawList* drawList = ImGui::GetWindowDrawList();
+  const ImVec2 mousePos = ImGui::GetIO().MousePos;
+  const bool hovered = ImGui::IsItemHovered();
+
+  // CPU zones, then GPU zones in the last row
+  for (int pass = 0; pass < 2; pass++) {
+    const bool gpu = (pass == 1);
+    if (gpu && !frame.gpuResolved)
+      break;
+    const int zonesCount = gpu ? frame.gpuZonesCount : frame.cpuZonesCount;
+    float gpuX = 0.0f;
+    for (int n = 0; n < zonesCount; n++) {
+      const char* name;
+      float x0, x1, y0, ms;
+      if (gpu) {
+        name = frame.gpuZones[n].name;
+        ms = frame.gpuZones[n].ms;
+        x0 = gpuX;
+        x1 = gpuX = gpuX + ms * msToPixels;
+        y0 = depthsCount * rowHeight;
+      } else {
+        const CpuZoneRecord& zone = frame.cpuZones[n];
+        name = zone.name;
+        ms = zone.endMs - zone.startMs;
+        x0 = zone.startMs * msToPixels;
+        x1 = zone.endMs * msToPixels;
+        y0 = zone.depth * rowHeight;
+      }
+      const ImRect rect(pos.x + x0, pos.y + y0, pos.x + ImMax(x1, x0 + 1.0f), pos.y + y0 + rowHeight - 1.0f);
+      drawList->AddRectFilled(rect.Min, rect.Max, zoneColor(name, gpu));
+      if (rect.GetWidth() > ImGui::GetFontSize()) {
+        char label[64];
+        snprintf(label, sizeof(label), "%s%s %.2f ms", gpu ? "GPU " : "", name, ms);
+        ImGui::RenderTextClipped(ImVec2(rect.Min.x + ImGui::GetStyle().FramePadding.x, rect.Min.y), rect.Max, label, NULL, NULL, ImVec2(0.0f, 0.5f), &rect);
+      }
+      if (hovered && rect.Contains(mousePos))
+        ImGui::SetTooltip("%s%s: %.3f ms (%.1f%% of frame)", gpu ? "GPU " : "", name, ms, ms * 100.0f / frameMs);
+    }
+  }
+}
+
+inline void showWindow(bool* open) {
+  static bool paused = false;
+  static int framesAgo = 0;
+  static ZoneStats stats[maxCpuZones + maxGpuZones];
+  static int statsCount = 0;
+  static float frameTimes[historySize];
+
+  if (!ImGui::Begin("Profiler", open)) {
+    ImGui::End();
+    return;
+  }
+  State& s = state();
+  if (s.framesCount == 0) {
+    ImGui::TextUnformatted("No frames recorded yet.");
+    ImGui::End();
+    return;
+  }
+
+  // Stats and plot are frozen while paused so a given frame can be inspected
+  if (!paused) {
+    statsCount = computeStats(stats, IM_ARRAYSIZE(stats));
+    for (int n = 0; n < s.framesCount; n++) {
+      const CpuZoneRecord& root = getFrame(s.framesCount - 1 - n).cpuZones[0];
+      frameTimes[n] = root.endMs - root.startMs;
+    }
+  }
+
+  ImGui::Checkbox("Pause", &paused);
+  ImGui::SameLine();
+  ImGui::BeginDisabled(!paused);
+  ImGui::SetNextItemWidth(ImGui::GetFontSize() * 12);
+  ImGui::SliderInt("Frames ago", &framesAgo, 0, s.framesCount - 1);
+  ImGui::EndDisabled();
+  if (!paused)
+    framesAgo = 0;
+
+  static int captureFramesCount = 300;
+  static char captureFilename[256] = "profile_trace.json";
+  ImGui::BeginDisabled(s.captureFramesLeft > 0);
+  if (ImGui::Button("Capture trace"))
+    captureFrames(captureFramesCount, captureFilename);
+  ImGui::EndDisabled();
+  ImGui::SameLine();
+  ImGui::SetNextItemWidth(ImGui::GetFontSize() * 6);
+  ImGui::DragInt("frames to", &captureFramesCount, 1.0f, 1, 100000);
+  ImGui::SameLine();
+  ImGui::SetNextItemWidth(-FLT_MIN);
+  ImGui::InputText("##Filename", captureFilename, IM_ARRAYSIZE(captureFilename));
+  if (s.captureStatus[0] != 0)
+    ImGui::TextUnformatted(s.captureStatus);
+
+  char overlay[64];
+  snprintf(overlay, sizeof(overlay), "Frame: %.2f ms", frameTimes[s.framesCount - 1 - framesAgo]);
+  ImGui::PlotLines("##FrameTimes", frameTimes, s.framesCount, 0, overlay, 0.0f, FLT_MAX, ImVec2(-FLT_MIN, 60.0f));
+
+  showFlameGraph(getFrame(framesAgo));
+
+  const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+  if (ImGui::BeginTable("##Zones", 7, flags)) {
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+    ImGui::TableSetupColumn("Last");
+    ImGui::TableSetupColumn("Avg");
+    ImGui::TableSetupColumn("p50");
+    ImGui::TableSetupColumn("p95");
+    ImGui::TableSetupColumn("p99");
+    ImGui::TableSetupColumn("Max");
+    ImGui::TableHeadersRow();
+    for (int n = 0; n < statsCount; n++) {
+      const ZoneStats& zone = stats[n];
+      ImGui::TableNextColumn();
+      ImGui::Indent(zone.depth * ImGui::GetStyle().IndentSpacing + 1.0f);
+      ImGui::Text("%s%s", zone.gpu ? "GPU " : "", zone.name);
+      ImGui::Unindent(zone.depth * ImGui::GetStyle().IndentSpacing + 1.0f);
+      ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.lastMs);
+      ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.avgMs);
+      ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.p50Ms);
+      ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.p95Ms);
+      ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.p99Ms);
+      ImGui::TableNextColumn(); ImGui::Text("%.3f", zone.maxMs);
+    }
+    ImGui::EndTable();
+  }
+
+  ImGui::End();
+}
+
+} // namespace Profiler
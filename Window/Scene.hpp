@@ -0,0 +1,107 @@
+#pragma once
+
+// Scene: the colored cube drawn behind the UI
+// -------------------------------------------
+// Shared by the app and the headless benchmark. Include your GL loader before this header.
+// Matrices are column-major float[16], e.g. glm::value_ptr(matrix).
+namespace Scene {
+
+// Vertex Data            // Color Data
+const float cubeVertices[] = {
+  // back face (z: -1)
+  -0.5f, -0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
+  0.5f, -0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
+  0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
+  0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
+  -0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
+  -0.5f, -0.5f, -0.5f,  1.0f, 0.0f, 0.0f,
+
+  // front face (z: +1)
+  -0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
+  0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
+  0.5f,  0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
+  0.5f,  0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
+  -0.5f,  0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
+  -0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 0.0f,
+
+  -0.5f,  0.5f,  0.5f,  0.0f, 0.0f, 1.0f,
+  -0.5f,  0.5f, -0.5f,  0.0f, 0.0f, 1.0f,
+  -0.5f, -0.5f, -0.5f,  0.0f, 0.0f, 1.0f,
+  -0.5f, -0.5f, -0.5f,  0.0f, 0.0f, 1.0f,
+  -0.5f, -0.5f,  0.5f,  0.0f, 0.0f, 1.0f,
+  -0.5f,  0.5f,  0.5f,  0.0f, 0.0f, 1.0f,
+
+  0.5f,  0.5f,  0.5f,  1.0f, 1.0f, 0.0f,
+  0.5f,  0.5f, -0.5f,  1.0f, 1.0f, 0.0f,
+  0.5f, -0.5f, -0.5f,  1.0f, 1.0f, 0.0f,
+  0.5f, -0.5f, -0.5f,  1.0f, 1.0f, 0.0f,
+  0.5f, -0.5f,  0.5f,  1.0f, 1.0f, 0.0f,
+  0.5f,  0.5f,  0.5f,  1.0f, 1.0f, 0.0f,
+
+  -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 1.0f,
+  0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 1.0f,
+  0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 1.0f,
+  0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 1.0f,
+  -0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 1.0f,
+  -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 1.0f,
+
+  -0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 1.0f,
+  0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 1.0f,
+  0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 1.0f,
+  0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 1.0f,
+  -0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 1.0f,
+  -0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 1.0f,
+};
+
+struct Cube {
+  GLuint program;
+  GLuint VAO;
+  GLuint VBO;
+  GLint modelMatrixLocation;
+  GLint projMatrixLocation;
+  GLint viewMatrixLocation;
+};
+
+// 'program' is built from Shaders/basic.vert and Shaders/basic.frag
+inline Cube createCube(GLuint program) {
+  Cube cube;
+  cube.program = program;
+  cube.modelMatrixLocation = glGetUniformLocation(program, "modelMatrix");
+  cube.projMatrixLocation = glGetUniformLocation(program, "projMatrix");
+  cube.viewMatrixLocation = glGetUniformLocation(program, "viewMatrix");
+
+  glGenVertexArrays(1, &cube.VAO);
+  glGenBuffers(1, &cube.VBO);
+
+  // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
+  glBindVertexArray(cube.VAO);
+
+  glBindBuffer(GL_ARRAY_BUFFER, cube.VBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
+
+  // position attribute
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+  // color attribute
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+  glEnableVertexAttribArray(1);
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  return cube;
+}
+
+inline void drawCube(const Cube& cube, const float* modelMatrix, const float* viewMatrix, const float* projMatrix) {
+  glUseProgram(cube.program);
+  glUniformMatrix4fv(cube.modelMatrixLocation, 1, GL_FALSE, modelMatrix);
+  glUniformMatrix4fv(cube.projMatrixLocation, 1, GL_FALSE, projMatrix);
+  glUniformMatrix4fv(cube.viewMatrixLocation, 1, GL_FALSE, viewMatrix);
+  glBindVertexArray(cube.VAO);
+  glDrawArrays(GL_TRIANGLES, 0, 36);
+}
+
+inline void destroyCube(Cube& cube) {
+  glDeleteVertexArrays(1, &cube.VAO);
+  glDeleteBuffers(1, &cube.VBO);
+}
+
+} // namespace Scene
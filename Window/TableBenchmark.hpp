@@ -0,0 +1,119 @@
+#pragma once
+
+#include <stdio.h>
+#include <chrono>
+
+#include "../ImGui/imgui.h"
+#include "../ImGui/imgui_internal.h"
+
+// Table benchmark: 5M rows x 20 columns submitted with ImGui::DataTable()
+// ------------------------------------------------------------------------
+// Cells are generated from (row, column) so the data set doesn't need to be stored.
+// Shows the time spent in DataTable() every frame and how long sorts take to be published.
+namespace TableBenchmark {
+
+const int initialRowsCount = 5000000;
+const int columnsCount = 20;
+
+inline unsigned int hashCell(int row, int column) {
+  unsigned int x = (unsigned int)row * 0x9E3779B1u + (unsigned int)column * 0x85EBCA77u;
+  x ^= x >> 16; x *= 0x7FEB352Du;
+  x ^= x >> 15; x *= 0x846CA68Bu;
+  x ^= x >> 16;
+  return x;
+}
+
+// Column 0 is the row id, other columns have different ranges so multi-column sorts have ties to break
+inline int cellValue(int row, int column) {
+  if (column == 0)
+    return row;
+  static const unsigned int ranges[4] = { 10u, 1000u, 100000u, 100000000u };
+  return (int)(hashCell(row, column) % ranges[column % 4]);
+}
+
+inline const char* getCellText(void*, int row, int column, char* buf, int bufSize) {
+  snprintf(buf, bufSize, "%d", cellValue(row, column));
+  return buf;
+}
+
+inline double getCellSortKey(void*, int row, int column) {
+  return (double)cellValue(row, column);
+}
+
+struct State {
+  ImGuiTableDataSource source;
+  char columnNamesData[columnsCount][16];
+  const char* columnNames[columnsCount];
+  float frameTimeMs[120];
+  int frameTimeOffset;
+  double sortStartTime;
+  double lastSortTimeMs;
+  bool wasSorting;
+
+  State() {
+    for (int column = 0; column < columnsCount; column++) {
+      snprintf(columnNamesData[column], sizeof(columnNamesData[column]), column == 0 ? "Id" : "Value%d", column);
+      columnNames[column] = columnNamesData[column];
+    }
+    source.RowsCount = initialRowsCount;
+    source.ColumnsCount = columnsCount;
+    source.ColumnNames = columnNames;
+    source.GetCellText = getCellText;
+    source.GetCellSortKey = getCellSortKey;
+    for (int n = 0; n < IM_ARRAYSIZE(frameTimeMs); n++)
+      frameTimeMs[n] = 0.0f;
+    frameTimeOffset = 0;
+    sortStartTime = 0.0;
+    lastSortTimeMs = 0.0;
+    wasSorting = false;
+  }
+};
+
+inline double now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline void showWindow(bool* open) {
+  static State* state = NULL;
+  if (!ImGui::Begin("Table Benchmark", open)) {
+    ImGui::End();
+    return;
+  }
+  if (state == NULL)
+    state = IM_NEW(State)();
+  ImGuiTableDataSource& source = state->source;
+
+  ImGui::Text("%d rows x %d columns", source.RowsCount, source.ColumnsCount);
+  ImGui::SameLine();
+  if (ImGui::Button("Append 100k rows"))
+    source.RowsCount += 100000;
+  ImGui::SameLine();
+  if (ImGui::Button("Reset rows")) {
+    source.RowsCount = initialRowsCount;
+    source.MarkDirty();
+  }
+
+  float frameTimeAverage = 0.0f;
+  for (int n = 0; n < IM_ARRAYSIZE(state->frameTimeMs); n++)
+    frameTimeAverage += state->frameTimeMs[n] / IM_ARRAYSIZE(state->frameTimeMs);
+  ImGui::Text("DataTable(): %.3f ms/frame. Last sort: %.0f ms%s", frameTimeAverage, state->lastSortTimeMs, source.IsSorting() ? " (sorting...)" : "");
+  ImGui::PlotLines("##FrameTimes", state->frameTimeMs, IM_ARRAYSIZE(state->frameTimeMs), state->frameTimeOffset, NULL, 0.0f, FLT_MAX, ImVec2(-FLT_MIN, 40.0f));
+
+  const ImGuiTableFlags flags = ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+    ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti;
+  const double startTime = now();
+  ImGui::DataTable("##Rows", &source, flags);
+  state->frameTimeMs[state->frameTimeOffset] = (float)((now() - startTime) * 1000.0);
+  state->frameTimeOffset = (state->frameTimeOffset + 1) % IM_ARRAYSIZE(state->frameTimeMs);
+
+  // A sort is published by DataTable() on the first frame after the worker thread finished
+  if (source.IsSorting() && !state->wasSorting)
+    state->sortStartTime = startTime;
+  if (!source.IsSorting() && state->wasSorting)
+    state->lastSortTimeMs = (now() - state->sortStartTime) * 1000.0;
+  state->wasSorting = source.IsSorting();
+
+  ImGui::End();
+}
+
+} // namespace TableBenchmark
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "../ImGui/imgui.h"
+#include "../ImGui/imgui_internal.h"
+
+// Tree benchmark: ~1.1M nodes displayed with ImGui::VirtualTree()
+// ----------------------------------------------------------------
+// Nodes are generated from their id (10 children per node, 6 levels) when their parent is opened.
+// With "Slow loading", children are added a few frames later to exercise asynchronous loading.
+namespace TreeBenchmark {
+
+const int childrenCount = 10;
+const int levelsCount = 6;
+const int slowLoadingFrames = 30;
+
+struct PendingLoad {
+  int node;
+  int frame;
+};
+
+struct State {
+  ImGuiVirtualTree tree;
+  ImVector<PendingLoad> pendingLoads;
+  bool slowLoading;
+
+  State() {
+    slowLoading = false;
+  }
+};
+
+inline void addChildren(ImGuiVirtualTree* tree, int node) {
+  const ImU64 firstId = tree->Nodes[node].UserID * childrenCount + 1;
+  const bool hasChildren = tree->Nodes[node].Depth + 2 < levelsCount;
+  for (int n = 0; n < childrenCount; n++)
+    tree->AddChild(node, firstId + n, hasChildren);
+}
+
+inline bool loadChildren(void* userData, ImGuiVirtualTree* tree, int node) {
+  State* state = (State*)userData;
+  if (state->slowLoading && node != 0) {
+    PendingLoad load = { node, ImGui::GetFrameCount() + slowLoadingFrames };
+    state->pendingLoads.push_back(load);
+    return false;
+  }
+  addChildren(tree, node);
+  return true;
+}
+
+inline const char* getNodeLabel(void*, ImU64 id, char* buf, int bufSize) {
+  snprintf(buf, bufSize, "Process %llu", (unsigned long long)id);
+  return buf;
+}
+
+inline void showWindow(bool* open) {
+  static State* state = NULL;
+  if (!ImGui::Begin("Tree Benchmark", open)) {
+    ImGui::End();
+    return;
+  }
+  if (state == NULL) {
+    state = IM_NEW(State)();
+    state->tree.LoadChildren = loadChildren;
+    state->tree.GetNodeLabel = getNodeLabel;
+    state->tree.UserData = state;
+  }
+  ImGuiVirtualTree& tree = state->tree;
+
+  // Children of a node need to be added in one go, so pending loads complete one at a time
+  for (int n = 0; n < state->pendingLoads.Size; n++) {
+    if (state->pendingLoads[n].frame > ImGui::GetFrameCount())
+      continue;
+    addChildren(&tree, state->pendingLoads[n].node);
+    tree.EndLoadChildren(state->pendingLoads[n].node);
+    state->pendingLoads.erase(state->pendingLoads.Data + n);
+    n--;
+  }
+
+  ImGui::Text("%d nodes loaded, %d visible rows, %d loading", tree.Nodes.Size, tree.VisibleRows.Size, state->pendingLoads.Size);
+  ImGui::SameLine();
+  ImGui::Checkbox("Slow loading", &state->slowLoading);
+  ImGui::SameLine();
+  if (ImGui::Button("Reset")) {
+    tree.Clear();
+    state->pendingLoads.clear();
+  }
+  if (tree.SelectedNode > 0)
+    ImGui::Text("Selected: Process %llu (depth %d)", (unsigned long long)tree.Nodes[tree.SelectedNode].UserID, tree.Nodes[tree.SelectedNode].Depth);
+  else
+    ImGui::TextDisabled("No selection");
+
+  ImGui::VirtualTree("##Tree", &tree, ImVec2(0.0f, 0.0f));
+  ImGui::End();
+}
+
+} // namespace TreeBenchmark
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "../ImGui/imgui.h"
+
+// Multi-viewport rendering and presentation
+// -----------------------------------------
+// Replaces ImGui::RenderPlatformWindowsDefault(). Secondary viewports already share the main context's GL objects and swap
+// with interval 0 (see the GLFW backend): only the main window waits for vsync.
+// - Each viewport is rendered then swapped before moving to the next one. RenderPlatformWindowsDefault() renders all of them
+//   then swaps all of them, which makes every context current twice per frame.
+// - With the present thread, swaps of secondary viewports are handed to a dedicated thread by present(), after the caller made
+//   its main context current again. The thread makes each context current, swaps, then releases its context.
+// - The thread only sees platform handles and the callbacks given to startThread(): it never touches the ImGui context, so
+//   the main thread is free to switch ImGui contexts meanwhile.
+// - Call wait() before anything which may create, resize or destroy platform windows: ImGui::UpdatePlatformWindows(), shutdown.
+namespace ViewportPresenter {
+
+const int maxViewports = 64;
+
+typedef void (*SwapWindowFunc)(void* platformHandle); // Make the window's context current and swap
+typedef void (*ReleaseContextFunc)();                 // Make no context current on the calling thread
+
+struct State {
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable condition;
+  SwapWindowFunc swapWindow;
+  ReleaseContextFunc releaseContext;
+  void* queued[maxViewports];  // Platform handles, written by the main thread while the present thread is idle
+  int queuedCount;
+  bool busy;                   // Present thread owns queued[] and the secondary contexts
+  bool quit;
+  bool threadRunning;
+
+  State() {
+    swapWindow = NULL;
+    releaseContext = NULL;
+    queuedCount = 0;
+    busy = quit = threadRunning = false;
+  }
+};
+
+inline State& state() {
+  static State s;
+  return s;
+}
+
+inline void threadMain() {
+  State& s = state();
+  std::unique_lock<std::mutex> lock(s.mutex);
+  while (true) {
+    s.condition.wait(lock, [&s] { return s.busy || s.quit; });
+    if (s.quit)
+      break;
+    const int count = s.queuedCount;
+    lock.unlock();
+    for (int n = 0; n < count; n++)
+      s.swapWindow(s.queued[n]);
+    s.releaseContext();
+    lock.lock();
+    s.queuedCount = 0;
+    s.busy = false;
+    s.condition.notify_all();
+  }
+}
+
+inline bool threadRunning() {
+  return state().threadRunning;
+}
+
+inline void wait() {
+  State& s = state();
+  if (!s.threadRunning)
+    return;
+  std::unique_lock<std::mutex> lock(s.mutex);
+  s.condition.wait(lock, [&s] { return !s.busy; });
+}
+
+inline void startThread(SwapWindowFunc swapWindow, ReleaseContextFunc releaseContext) {
+  State& s = state();
+  if (s.threadRunning)
+    return;
+  s.swapWindow = swapWindow;
+  s.releaseContext = releaseContext;
+  s.quit = s.busy = false;
+  s.queuedCount = 0;
+  s.thread = std::thread(threadMain);
+  s.threadRunning = true;
+}
+
+inline void stopThread() {
+  State& s = state();
+  if (!s.threadRunning)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.quit = true;
+  }
+  s.condition.notify_all();
+  s.thread.join();
+  s.threadRunning = false;
+  s.queuedCount = 0;
+  s.busy = false;
+}
+
+// Render secondary viewports. Swaps right away without the present thread, queues swaps for present() otherwise.
+// Leaves the last rendered viewport's context current: restore the main one before calling present().
+inline void renderPlatformWindows(void* platformArg = NULL, void* rendererArg = NULL) {
+  State& s = state();
+  wait(); // The present thread must have released the contexts we are about to use
+  ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+  for (int n = 1; n < platformIO.Viewports.Size; n++) {
+    ImGuiViewport* viewport = platformIO.Viewports[n];
+    if (viewport->Flags & ImGuiViewportFlags_IsMinimized)
+      continue;
+    if (platformIO.Platform_RenderWindow) platformIO.Platform_RenderWindow(viewport, platformArg);
+    if (platformIO.Renderer_RenderWindow) platformIO.Renderer_RenderWindow(viewport, rendererArg);
+    if (s.threadRunning && s.queuedCount < maxViewports) {
+      s.queued[s.queuedCount++] = viewport->PlatformHandle;
+      continue;
+    }
+    if (platformIO.Platform_SwapBuffers) platformIO.Platform_SwapBuffers(viewport, platformArg);
+    if (platformIO.Renderer_SwapBuffers) platformIO.Renderer_SwapBuffers(viewport, rendererArg);
+  }
+}
+
+// Hand the swaps queued by renderPlatformWindows() to the present thread. No-op without the thread.
+inline void present() {
+  State& s = state();
+  if (!s.threadRunning || s.queuedCount == 0)
+    return;
+  {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.busy = true;
+  }
+  s.condition.notify_all();
+}
+
+} // namespace ViewportPresenter
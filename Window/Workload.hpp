@@ -0,0 +1,1281 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "../ImGui/imgui.h"
+#include "../ImGui/imgui_internal.h"
+#include "TableBenchmark.hpp"
+
+// Workloads: scripted heavy UIs for performance regression tests
+// ----------------------------------------------------------------
+// Each scenario runs in its own headless ImGui context with a null renderer (draw data is built but not rendered).
+// Inputs are synthetic: AddMousePosEvent()/AddMouseButtonEvent()/AddKeyEvent() feed the context's InputEventsQueue.
+// Time only advances by a fixed DeltaTime, so the UI and its draw data are the same on every run.
+// In the app, runs are queued by the window and executed by runPending() between frames, never inside one.
+namespace Workload {
+
+struct Scenario {
+  const char* name;
+  const char* description;
+  int frames;
+  void (*input)(ImGuiIO& io, int frame);
+  void (*submit)(int frame);
+  void (*shutdown)();     // Optional: frees the scenario's state, called before its context is destroyed
+};
+
+struct Options {
+  int warmupFrames;
+  float frameScale;       // Multiplies each scenario's frame count
+  ImVec2 displaySize;
+  bool coalesceInput;     // io.ConfigInputCoalesceMouseEvents, as set by the app
+
+  Options() {
+    warmupFrames = 10;
+    frameScale = 1.0f;
+    displaySize = ImVec2(1280.0f, 800.0f);
+    coalesceInput = true;
+  }
+};
+
+struct Stats {
+  double mean;
+  double p95;
+  double max;
+};
+
+struct Result {
+  const char* name;
+  int frames;
+  int inputEvents;       // Events queued
+  int inputEventsMerged; // Mouse pos/wheel events merged into a queued one instead
+  Stats newFrameMs;
+  Stats submitMs;        // Widget submission, from NewFrame() to Render()
+  Stats renderMs;
+  Stats frameMs;
+  Stats vertices;        // ImDrawData totals
+  Stats indices;
+  Stats drawLists;
+  Stats drawCmds;
+  Stats heapAllocs;      // Allocations reaching malloc() from NewFrame() to Render(): all MemAlloc() calls, or ImTieredAllocator backend allocations
+  int warmupHeapAllocs;  // Same, summed over warm-up frames
+  int errors;            // Checks failed by the scenario, see scenarioError()
+};
+
+struct SettingsResult {
+  int windows;
+  int tables;
+  int iniSize;
+  bool roundTrip;             // Loading the .ini data into a fresh context and saving it gives the same text
+  double saveFullMs;          // First SaveIniSettingsToMemory(), every entry is formatted
+  double saveIncrementalMs;   // SaveIniSettingsToMemory() after moving one window
+  double loadMs;              // LoadIniSettingsFromMemory() into a fresh context
+  double newFrameMs;          // NewFrame() without saving
+  double autoSaveMs;          // NewFrame() doing the automatic save to disk
+  double autoSaveThreadedMs;  // Same with io.IniSavingThreaded
+};
+
+inline double now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Checks failed by the running scenario, counted in Result::errors. Only the first one is printed: a regression usually
+// fails on every frame. May be called from worker threads (e.g. a DataTable callback).
+inline std::atomic<int>& scenarioErrorsCount() {
+  static std::atomic<int> count(0);
+  return count;
+}
+
+inline void scenarioError(const char* fmt, ...) {
+  if (scenarioErrorsCount().fetch_add(1) > 0)
+    return;
+  va_list args;
+  va_start(args, fmt);
+  fprintf(stderr, "Error: ");
+  vfprintf(stderr, fmt, args);
+  fprintf(stderr, "\n");
+  va_end(args);
+}
+
+inline Stats computeStats(ImVector<double>& samples) {
+  Stats stats = { 0.0, 0.0, 0.0 };
+  if (samples.Size == 0)
+    return stats;
+  std::sort(samples.begin(), samples.end());
+  for (int n = 0; n < samples.Size; n++)
+    stats.mean += samples[n] / samples.Size;
+  stats.p95 = samples[(int)(0.95 * (samples.Size - 1) + 0.5)];
+  stats.max = samples.back();
+  return stats;
+}
+
+// ImHashStr() backend ImGui was compiled with (imconfig.h IMGUI_USE_HASH_xxx), told apart by the ID of a known string
+inline const char* hashBackendName() {
+  switch (ImHashStr("Workload")) {
+  case 0xEB75C82D: return "crc32";
+  case 0x63F98406: return "crc32c";
+  case 0xC30394C0: return "word";
+  default: return "unknown";
+  }
+}
+
+// ImTieredAllocator installed with ImGui::SetAllocatorFunctions(), or NULL
+inline ImTieredAllocator* tieredAllocator() {
+  ImGuiMemAllocFunc allocFunc;
+  ImGuiMemFreeFunc freeFunc;
+  void* userData;
+  ImGui::GetAllocatorFunctions(&allocFunc, &freeFunc, &userData);
+  return (allocFunc == ImTieredAllocator::AllocFunc) ? (ImTieredAllocator*)userData : NULL;
+}
+
+// Mouse follows a Lissajous curve over the whole display
+// With io.ConfigInputTrickleEventQueue, a wheel or button event following a mouse move is only processed on the next frame:
+// scenarios don't move the mouse on frames where they scroll or click, so the queue doesn't grow.
+inline void sweepMouse(ImGuiIO& io, int frame) {
+  const float t = frame * io.DeltaTime;
+  io.AddMousePosEvent(io.DisplaySize.x * (0.5f + 0.48f * sinf(t * 1.3f)), io.DisplaySize.y * (0.5f + 0.48f * sinf(t * 1.7f)));
+}
+
+inline void beginFullscreenWindow(const char* name) {
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+  ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+  ImGui::Begin(name, NULL, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings);
+}
+
+// Scenarios
+// ---------
+
+// 2000 overlapping windows, hovered by the mouse and brought to front by a click every 30 frames
+inline void manyWindowsInput(ImGuiIO& io, int frame) {
+  if (frame % 30 == 0)
+    io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+  else if (frame % 30 == 1)
+    io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+  else
+    sweepMouse(io, frame);
+}
+
+inline void manyWindowsSubmit(int) {
+  const int windowsCount = 2000;
+  static float values[windowsCount];
+  for (int n = 0; n < windowsCount; n++) {
+    char name[32];
+    snprintf(name, sizeof(name), "Window %04d", n);
+    ImGui::SetNextWindowPos(ImVec2((float)((n * 37) % 1100), (float)((n * 23) % 700)), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImVec2(170.0f, 90.0f), ImGuiCond_Once);
+    ImGui::Begin(name);
+    ImGui::Text("Window %d", n);
+    ImGui::Button("Button");
+    ImGui::SliderFloat("Value", &values[n], 0.0f, 1.0f);
+    ImGui::End();
+  }
+}
+
+// Fully open binary tree of 4095 nodes followed by 16 sibling chains 24 levels deep, scrolled by the mouse wheel.
+// Tree depth stays below 32: TreePop() tracks nodes to jump back from in a 32 bits mask indexed by depth.
+inline void deepTreeInput(ImGuiIO& io, int frame) {
+  if (frame % 2 == 0)
+    sweepMouse(io, frame);
+  else
+    io.AddMouseWheelEvent(0.0f, (frame / 60) % 2 == 0 ? -4.0f : 4.0f);
+}
+
+inline void submitBinaryTree(int id, int depth) {
+  const ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_DefaultOpen | (depth == 0 ? ImGuiTreeNodeFlags_Leaf : 0);
+  if (!ImGui::TreeNodeEx((void*)(intptr_t)id, flags, "Node %d", id))
+    return;
+  if (depth > 0) {
+    submitBinaryTree(id * 2, depth - 1);
+    submitBinaryTree(id * 2 + 1, depth - 1);
+  }
+  ImGui::TreePop();
+}
+
+inline void deepTreeSubmit(int) {
+  beginFullscreenWindow("Deep Tree");
+  submitBinaryTree(1, 11);
+  const int chainsCount = 16;
+  const int chainDepth = 24;
+  for (int chain = 0; chain < chainsCount; chain++) {
+    ImGui::PushID(chain);
+    int opened = 0;
+    while (opened < chainDepth && ImGui::TreeNodeEx((void*)(intptr_t)opened, ImGuiTreeNodeFlags_DefaultOpen, "Chain %d level %d", chain, opened))
+      opened++;
+    while (opened-- > 0)
+      ImGui::TreePop();
+    ImGui::PopID();
+  }
+  ImGui::End();
+}
+
+// Growing tree whose open state lives in the window storage, in sorted (default) or hashed mode (ImGuiStorage::SetUseHashIndex()).
+// 25 groups of 1000 nodes appear every 30 frames, up to 100 groups: each new node stores its open state once (SetNextItemOpen()
+// with ImGuiCond_Once), in the order of its hashed ID. Every node is submitted without a clipper, so every frame looks them all up.
+inline void submitTreeState(int frame, bool hashed) {
+  const int groupsCount = 25 * ImMin(frame / 30 + 1, 4);
+  const int nodesPerGroup = 1000;
+  beginFullscreenWindow(hashed ? "Tree State Hashed" : "Tree State");
+  ImGui::GetStateStorage()->SetUseHashIndex(hashed);
+  for (int group = 0; group < groupsCount; group++) {
+    ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+    if (!ImGui::TreeNode((void*)(intptr_t)group, "Group %d", group))
+      continue;
+    for (int node = 0; node < nodesPerGroup; node++) {
+      ImGui::SetNextItemOpen(node % 3 != 0, ImGuiCond_Once);
+      if (ImGui::TreeNode((void*)(intptr_t)node, "Node %d.%d", group, node))
+        ImGui::TreePop();
+    }
+    ImGui::TreePop();
+  }
+  ImGui::End();
+}
+
+inline void treeStateSubmit(int frame) {
+  submitTreeState(frame, false);
+}
+
+inline void treeStateHashedSubmit(int frame) {
+  submitTreeState(frame, true);
+}
+
+// 1M rows x 8 columns table with clipping and frozen header, scrolled by the mouse wheel
+inline void largeTableInput(ImGuiIO& io, int frame) {
+  if (frame % 2 == 0)
+    sweepMouse(io, frame);
+  else
+    io.AddMouseWheelEvent(0.0f, -50.0f);
+}
+
+inline void largeTableSubmit(int) {
+  const int rowsCount = 1000000;
+  const int columnsCount = 8;
+  beginFullscreenWindow("Large Table");
+  const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+  if (ImGui::BeginTable("##Rows", columnsCount, flags)) {
+    ImGui::TableSetupScrollFreeze(1, 1);
+    for (int column = 0; column < columnsCount; column++) {
+      char name[16];
+      snprintf(name, sizeof(name), "Column %d", column);
+      ImGui::TableSetupColumn(name);
+    }
+    ImGui::TableHeadersRow();
+    ImGuiListClipper clipper;
+    clipper.Begin(rowsCount);
+    while (clipper.Step())
+      for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%07d", row);
+        for (int column = 1; column < columnsCount; column++) {
+          ImGui::TableNextColumn();
+          ImGui::Text("%u", (unsigned int)(row * 2654435761u + column * 40503u) % 100000u);
+        }
+      }
+    ImGui::EndTable();
+  }
+  ImGui::End();
+}
+
+// ~1 MB of text, shown with TextUnformatted() and a read-only multi-line InputText
+inline const ImGuiTextBuffer& getLongText() {
+  static ImGuiTextBuffer text;
+  if (text.empty()) {
+    const char* words[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit" };
+    text.Buf.reserve(1100 * 1024);
+    for (int line = 0; text.size() < 1024 * 1024; line++) {
+      text.appendf("%06d:", line);
+      for (int word = 0; word < 8; word++)
+        text.appendf(" %s", words[(line * 5 + word * 3) % IM_ARRAYSIZE(words)]);
+      text.append("\n");
+    }
+  }
+  return text;
+}
+
+inline void longTextInput(ImGuiIO& io, int frame) {
+  if (frame % 2 == 0)
+    sweepMouse(io, frame);
+  else
+    io.AddMouseWheelEvent(0.0f, -20.0f);
+}
+
+inline void longTextSubmit(int) {
+  const ImGuiTextBuffer& text = getLongText();
+  beginFullscreenWindow("Long Text");
+  const ImVec2 size(ImGui::GetContentRegionAvail().x * 0.5f, -FLT_MIN);
+  ImGui::BeginChild("##Text", size);
+  ImGui::TextUnformatted(text.begin(), text.end());
+  ImGui::EndChild();
+  ImGui::SameLine();
+  ImGui::InputTextMultiline("##Input", (char*)text.begin(), text.size() + 1, ImVec2(-FLT_MIN, -FLT_MIN), ImGuiInputTextFlags_ReadOnly);
+  ImGui::End();
+}
+
+// Log viewer over three 256 KB corpora side by side: ASCII, Latin-1 (2 bytes characters) and CJK (3 bytes characters) UTF-8.
+// Every line is measured for the horizontal scroll extent and characters are counted, visible lines are rendered with a clipper.
+// The default font has no CJK glyphs: they are measured and rendered with the fallback glyph, decoding is the same.
+struct Utf8Corpus {
+  const char* name;
+  ImGuiTextBuffer text;
+  ImVector<int> lineStarts;
+};
+
+inline const Utf8Corpus& getUtf8Corpus(int script) {
+  static Utf8Corpus corpora[3];
+  Utf8Corpus& corpus = corpora[script];
+  if (corpus.text.empty()) {
+    static const char* asciiWords[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit" };
+    static const char* latin1Words[] = { "caf\xC3\xA9", "na\xC3\xAFve", "\xC3\xBC" "ber", "fa\xC3\xA7" "ade", "\xC3\x86r\xC3\xB8", "se\xC3\xB1or", "d\xC3\xA9j\xC3\xA0", "\xC3\xA9t\xC3\xA9" };
+    static const char* cjkWords[] = { "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E", "\xE4\xB8\xAD\xE6\x96\x87", "\xE6\xBC\xA2\xE5\xAD\x97", "\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88",
+                                      "\xE6\x96\x87\xE5\xAD\x97\xE5\x88\x97", "\xE8\xA1\xA8\xE7\xA4\xBA", "\xE8\xA8\x88\xE7\xAE\x97", "\xE5\x85\xA5\xE5\x8A\x9B" };
+    const char** words = (script == 0) ? asciiWords : (script == 1) ? latin1Words : cjkWords;
+    corpus.name = (script == 0) ? "ASCII" : (script == 1) ? "Latin-1" : "CJK";
+    corpus.text.Buf.reserve(260 * 1024);
+    for (int line = 0; corpus.text.size() < 256 * 1024; line++) {
+      corpus.lineStarts.push_back(corpus.text.size());
+      corpus.text.appendf("%06d:", line);
+      for (int word = 0; word < 10 + line % 7; word++)
+        corpus.text.appendf(" %s", words[(line * 5 + word * 3) % 8]);
+      corpus.text.append("\n");
+    }
+    corpus.lineStarts.push_back(corpus.text.size());
+  }
+  return corpus;
+}
+
+inline void utf8TextSubmit(int) {
+  beginFullscreenWindow("UTF-8 Text");
+  const float width = (ImGui::GetContentRegionAvail().x - ImGui::GetStyle().ItemSpacing.x * 2.0f) / 3.0f;
+  for (int script = 0; script < 3; script++) {
+    const Utf8Corpus& corpus = getUtf8Corpus(script);
+    const int linesCount = corpus.lineStarts.Size - 1;
+    float maxWidth = 0.0f;
+    for (int line = 0; line < linesCount; line++)
+      maxWidth = ImMax(maxWidth, ImGui::CalcTextSize(corpus.text.begin() + corpus.lineStarts[line], corpus.text.begin() + corpus.lineStarts[line + 1] - 1).x);
+    const int charsCount = ImTextCountCharsFromUtf8(corpus.text.begin(), corpus.text.end());
+
+    if (script > 0)
+      ImGui::SameLine();
+    ImGui::SetNextWindowContentSize(ImVec2(maxWidth, 0.0f));
+    ImGui::BeginChild(corpus.name, ImVec2(width, -FLT_MIN), ImGuiChildFlags_Border, ImGuiWindowFlags_HorizontalScrollbar);
+    ImGui::Text("%s: %d lines, %d characters", corpus.name, linesCount, charsCount);
+    ImGuiListClipper clipper;
+    clipper.Begin(linesCount);
+    while (clipper.Step())
+      for (int line = clipper.DisplayStart; line < clipper.DisplayEnd; line++)
+        ImGui::TextUnformatted(corpus.text.begin() + corpus.lineStarts[line], corpus.text.begin() + corpus.lineStarts[line + 1] - 1);
+    ImGui::EndChild();
+  }
+  ImGui::End();
+}
+
+// Property editor of 400 objects x 10 properties, submitted without a clipper: every widget ID is hashed every frame,
+// only the visible ones are rendered. Labels are typical: a visible name followed by "##" or "###" and a unique suffix,
+// inside string (object names) and integer (property index) ID scopes. Scrolled by the mouse wheel.
+inline void widgetIdsSubmit(int) {
+  const int objectsCount = 400;
+  static const char* properties[] = { "Position##x", "Position##y", "Rotation", "Scale", "Enabled", "Visible", "Cast shadows", "Layer mask", "Material", "Rename###rename" };
+  static float values[objectsCount][IM_ARRAYSIZE(properties)];
+  static bool flags[objectsCount][IM_ARRAYSIZE(properties)];
+  beginFullscreenWindow("Widget IDs");
+  char name[48];
+  for (int object = 0; object < objectsCount; object++) {
+    snprintf(name, sizeof(name), "SceneObject_%03d/MeshRenderer", object);
+    ImGui::PushID(name);
+    ImGui::SeparatorText(name);
+    for (int property = 0; property < IM_ARRAYSIZE(properties); property++) {
+      ImGui::PushID(property);
+      if (property % 5 == 4)
+        ImGui::Checkbox(properties[property], &flags[object][property]);
+      else if (property % 5 == 3)
+        ImGui::Button(properties[property]);
+      else
+        ImGui::DragFloat(properties[property], &values[object][property]);
+      ImGui::PopID();
+    }
+    ImGui::PopID();
+  }
+  ImGui::End();
+}
+
+// 8 line plots of 100k values each and a histogram, scrolling through the data
+inline const ImVector<float>& getPlotValues() {
+  static ImVector<float> values;
+  if (values.empty()) {
+    values.resize(100000);
+    for (int n = 0; n < values.Size; n++)
+      values[n] = sinf(n * 0.01f) + 0.3f * sinf(n * 0.37f) + 0.1f * sinf(n * 3.1f);
+  }
+  return values;
+}
+
+inline void plotsSubmit(int frame) {
+  const ImVector<float>& values = getPlotValues();
+  beginFullscreenWindow("Plots");
+  const float height = (ImGui::GetContentRegionAvail().y - ImGui::GetStyle().ItemSpacing.y * 9) / 9.0f;
+  for (int n = 0; n < 8; n++) {
+    ImGui::PushID(n);
+    ImGui::PlotLines("##Lines", values.Data, values.Size, (frame * 97 + n * 1000) % values.Size, NULL, -1.5f, 1.5f, ImVec2(-FLT_MIN, height));
+    ImGui::PopID();
+  }
+  ImGui::PlotHistogram("##Histogram", values.Data, 2000, frame % values.Size, NULL, -1.5f, 1.5f, ImVec2(-FLT_MIN, height));
+  ImGui::End();
+}
+
+// Recorded and live signals: 4 x PlotSummaryEx() over a 4M samples recording growing by 2000 samples per frame (whole recording,
+// then a 100k samples window scrolling through it), and 8 x PlotStreamingEx() of 2000 samples with 16 samples pushed per frame.
+// Samples are pushed by the frame itself rather than by a sampling thread, to keep the frames deterministic.
+const int plotStreamsRecordedCount = 4 * 1024 * 1024;
+
+inline const ImVector<float>& getPlotStreamsRecording() {
+  static ImVector<float> recorded;
+  if (recorded.empty()) {
+    recorded.resize(plotStreamsRecordedCount);
+    for (int n = 0; n < recorded.Size; n++)
+      recorded[n] = sinf(n * 0.0001f) + 0.3f * sinf(n * 0.037f) + 0.1f * sinf(n * 3.1f);
+  }
+  return recorded;
+}
+
+// Allocated with the scenario's context, deleted by plotStreamsShutdown()
+struct PlotStreamsState {
+  ImGuiPlotSummary summary;
+  ImGuiStreamingPlot* streams[8];
+
+  PlotStreamsState() {
+    for (int n = 0; n < IM_ARRAYSIZE(streams); n++)
+      streams[n] = IM_NEW(ImGuiStreamingPlot)(2000);
+  }
+  ~PlotStreamsState() {
+    for (int n = 0; n < IM_ARRAYSIZE(streams); n++)
+      IM_DELETE(streams[n]);
+  }
+};
+
+inline PlotStreamsState*& plotStreamsState() {
+  static PlotStreamsState* state = NULL;
+  return state;
+}
+
+inline void plotStreamsShutdown() {
+  IM_DELETE(plotStreamsState());
+  plotStreamsState() = NULL;
+}
+
+inline void plotStreamsSubmit(int frame) {
+  const int recordedCount = plotStreamsRecordedCount;
+  const int appendedPerFrame = 2000;
+  const int pushedPerFrame = 16;
+  const ImVector<float>& recorded = getPlotStreamsRecording();
+  if (plotStreamsState() == NULL) {
+    plotStreamsState() = IM_NEW(PlotStreamsState)();
+    plotStreamsState()->summary.Append(recorded.Data, recorded.Size);
+  }
+  ImGuiPlotSummary& summary = plotStreamsState()->summary;
+  ImGuiStreamingPlot** streams = plotStreamsState()->streams;
+  for (int n = 0; n < appendedPerFrame; n++)
+    summary.Append(recorded[(frame * appendedPerFrame + n) % recorded.Size]);
+  for (int stream = 0; stream < IM_ARRAYSIZE(PlotStreamsState::streams); stream++)
+    for (int n = 0; n < pushedPerFrame; n++)
+      streams[stream]->Push(sinf((frame * pushedPerFrame + n) * 0.02f + stream) + 0.2f * sinf((frame * pushedPerFrame + n) * 0.7f));
+
+  beginFullscreenWindow("Plot Streams");
+  const float height = (ImGui::GetContentRegionAvail().y - ImGui::GetStyle().ItemSpacing.y * 11) / 12.0f;
+  for (int n = 0; n < 4; n++) {
+    ImGui::PushID(n);
+    if (n % 2 == 0)
+      ImGui::PlotSummaryEx(ImGuiPlotType_Lines, "##Recording", &summary, 0, -1, NULL, -1.5f, 1.5f, ImVec2(-FLT_MIN, height));
+    else
+      ImGui::PlotSummaryEx(ImGuiPlotType_Histogram, "##Window", &summary, (frame * 997 + n * 100000) % (recordedCount - 100000), 100000, NULL, -1.5f, 1.5f, ImVec2(-FLT_MIN, height));
+    ImGui::PopID();
+  }
+  for (int n = 0; n < IM_ARRAYSIZE(PlotStreamsState::streams); n++) {
+    ImGui::PushID(n);
+    const bool autoScale = (n % 2 == 0);
+    ImGui::PlotStreamingEx(ImGuiPlotType_Lines, "##Stream", streams[n], NULL, autoScale ? FLT_MAX : -1.5f, autoScale ? FLT_MAX : 1.5f, ImVec2(-FLT_MIN, height));
+    ImGui::PopID();
+  }
+  ImGui::End();
+}
+
+// Typing into a multi-line InputText, after clicking it (once the window exists):
+// a character per frame, Enter every 60 frames, 5 x Backspace every 90 frames,
+// Ctrl+Shift+Left then Ctrl+C and Ctrl+V every 150 frames (copy the previous word and paste it over itself)
+inline void typingInput(ImGuiIO& io, int frame) {
+  const char* text = "The quick brown fox jumps over the lazy dog. ";
+  if (frame < 2) {
+    io.AddMousePosEvent(100.0f, 50.0f);
+  } else if (frame == 2) {
+    io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+  } else if (frame == 3) {
+    io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+  } else if (frame % 150 == 75) {
+    io.AddKeyEvent(ImGuiMod_Ctrl, true);
+    io.AddKeyEvent(ImGuiMod_Shift, true);
+    io.AddKeyEvent(ImGuiKey_LeftArrow, true);
+    io.AddKeyEvent(ImGuiKey_LeftArrow, false);
+    io.AddKeyEvent(ImGuiMod_Shift, false);
+    io.AddKeyEvent(ImGuiKey_C, true);
+    io.AddKeyEvent(ImGuiKey_C, false);
+    io.AddKeyEvent(ImGuiKey_V, true);
+    io.AddKeyEvent(ImGuiKey_V, false);
+    io.AddKeyEvent(ImGuiMod_Ctrl, false);
+  } else if (frame % 90 == 0) {
+    for (int n = 0; n < 5; n++) {
+      io.AddKeyEvent(ImGuiKey_Backspace, true);
+      io.AddKeyEvent(ImGuiKey_Backspace, false);
+    }
+  } else if (frame % 60 == 0) {
+    io.AddKeyEvent(ImGuiKey_Enter, true);
+    io.AddKeyEvent(ImGuiKey_Enter, false);
+  } else {
+    io.AddInputCharacter((unsigned int)text[frame % strlen(text)]);
+  }
+}
+
+inline void typingSubmit(int frame) {
+  static char buf[64 * 1024] = "";
+  if (frame == 0)
+    buf[0] = 0;
+  beginFullscreenWindow("Typing");
+  ImGui::InputTextMultiline("##Text", buf, sizeof(buf), ImVec2(-FLT_MIN, -FLT_MIN));
+  ImGui::End();
+}
+
+// Same typing into InputTextDocument() over the 1 MB long text, with a PageDown every 40 frames:
+// edits land further and further into the document, whose visible lines are located from the pieces tree every frame
+inline void documentInput(ImGuiIO& io, int frame) {
+  if (frame > 3 && frame % 40 == 20) {
+    io.AddKeyEvent(ImGuiKey_PageDown, true);
+    io.AddKeyEvent(ImGuiKey_PageDown, false);
+  } else {
+    typingInput(io, frame);
+  }
+}
+
+inline void documentSubmit(int frame) {
+  static ImGuiTextDocument doc;
+  if (frame == 0) {
+    const ImGuiTextBuffer& text = getLongText();
+    doc.SetText(text.begin(), text.end());
+  }
+  beginFullscreenWindow("Document");
+  ImGui::InputTextDocument("##Document", &doc, ImVec2(-FLT_MIN, -FLT_MIN));
+  ImGui::End();
+}
+
+// Dock space split into 64 nodes holding 4 tabs each, built once with the DockBuilder API and left idle under a hovering mouse
+inline void dockingInput(ImGuiIO& io, int frame) {
+  io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+  sweepMouse(io, frame);
+}
+
+inline void splitDockNode(ImGuiID id, int depth, ImVector<ImGuiID>* leaves) {
+  if (depth == 0) {
+    leaves->push_back(id);
+    return;
+  }
+  ImGuiID other;
+  const ImGuiID first = ImGui::DockBuilderSplitNode(id, (depth % 2) ? ImGuiDir_Left : ImGuiDir_Up, 0.5f, NULL, &other);
+  splitDockNode(first, depth - 1, leaves);
+  splitDockNode(other, depth - 1, leaves);
+}
+
+inline void dockingSubmit(int) {
+  const int tabsPerNode = 4;
+  static ImVector<ImGuiID> leaves;
+  char name[32];
+  beginFullscreenWindow("Docking");
+  const ImGuiID dockspaceId = ImGui::GetID("Dockspace");
+  if (ImGui::DockBuilderGetNode(dockspaceId) == NULL) {
+    ImGui::DockBuilderAddNode(dockspaceId, ImGuiDockNodeFlags_DockSpace);
+    ImGui::DockBuilderSetNodeSize(dockspaceId, ImGui::GetIO().DisplaySize);
+    leaves.resize(0);
+    splitDockNode(dockspaceId, 6, &leaves);
+    for (int n = 0; n < leaves.Size * tabsPerNode; n++) {
+      snprintf(name, sizeof(name), "Panel %03d", n);
+      ImGui::DockBuilderDockWindow(name, leaves[n / tabsPerNode]);
+    }
+    ImGui::DockBuilderFinish(dockspaceId);
+  }
+  ImGui::DockSpace(dockspaceId);
+  ImGui::End();
+  for (int n = 0; n < leaves.Size * tabsPerNode; n++) {
+    snprintf(name, sizeof(name), "Panel %03d", n);
+    ImGui::Begin(name);
+    ImGui::Text("Panel %d", n);
+    ImGui::End();
+  }
+}
+
+// 1000 Hz mouse at 60 FPS: 16 moves per frame, split by a click every 30 frames and a burst of wheel notches every 20 frames
+inline void mouseFloodInput(ImGuiIO& io, int frame) {
+  const int movesPerFrame = 16;
+  const float t = frame * io.DeltaTime;
+  for (int n = 0; n < movesPerFrame; n++) {
+    const float tn = t + io.DeltaTime * n / movesPerFrame;
+    io.AddMousePosEvent(io.DisplaySize.x * (0.5f + 0.48f * sinf(tn * 1.3f)), io.DisplaySize.y * (0.5f + 0.48f * sinf(tn * 1.7f)));
+    if (n == movesPerFrame / 2 && frame % 30 == 0)
+      io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+    if (n == movesPerFrame / 2 && frame % 30 == 1)
+      io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+  }
+  if (frame % 20 == 10)
+    for (int n = 0; n < 8; n++)
+      io.AddMouseWheelEvent(0.0f, (frame / 20) % 4 < 2 ? -0.25f : 0.25f);
+}
+
+inline void mouseFloodSubmit(int) {
+  const int rowsCount = 100000;
+  static int selected = -1;
+  beginFullscreenWindow("MouseFlood");
+  ImGuiListClipper clipper;
+  clipper.Begin(rowsCount);
+  while (clipper.Step())
+    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+      char label[32];
+      snprintf(label, sizeof(label), "Row %06d", row);
+      if (ImGui::Selectable(label, selected == row))
+        selected = row;
+    }
+  ImGui::End();
+}
+
+// 5M rows x 20 columns DataTable (the Table Benchmark data set), sorted on a worker thread.
+// Clicks on headers start sorts, and rows are removed then appended while a sort is running: the previous order must not be
+// displayed once it refers to removed rows. Waits for sorts at fixed frames, draw data of other frames depends on sort times.
+inline ImGuiTableDataSource& dataTableSource() {
+  static ImGuiTableDataSource source;
+  return source;
+}
+
+inline const char* dataTableGetCellText(void* userData, int row, int column, char* buf, int bufSize) {
+  const ImGuiTableDataSource* source = (const ImGuiTableDataSource*)userData;
+  if (row < 0 || row >= source->RowsCount)
+    scenarioError("DataTable() displayed removed row %d (%d rows)", row, source->RowsCount);
+  return TableBenchmark::getCellText(NULL, row, column, buf, bufSize);
+}
+
+inline void dataTableWaitSort(ImGuiTableDataSource& source) {
+  while (source.IsSorting()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ImGui::TableDataSourceUpdateSort(&source);
+  }
+}
+
+inline void dataTableSortInput(ImGuiIO& io, int frame) {
+  const int shrunkRowsCount = TableBenchmark::initialRowsCount - 1000000;
+  const ImVec2 header0(40.0f, 16.0f), header1(100.0f, 16.0f);
+  ImGuiTableDataSource& source = dataTableSource();
+  if (frame == 0) {
+    dataTableWaitSort(source); // From a previous run
+    source.RowsCount = TableBenchmark::initialRowsCount;
+    source.ColumnsCount = TableBenchmark::columnsCount;
+    source.GetCellText = dataTableGetCellText;
+    source.GetCellSortKey = TableBenchmark::getCellSortKey;
+    source.UserData = &source;
+    source.MarkDirty();
+    io.AddMousePosEvent(io.DisplaySize.x * 0.5f, io.DisplaySize.y * 0.5f);
+  } else if (frame == 1) {
+    dataTableWaitSort(source); // Default sort: Id ascending
+    io.AddMousePosEvent(header0.x, header0.y);
+  } else if (frame == 2 || frame == 5) {
+    io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+  } else if (frame == 3 || frame == 6) {
+    io.AddMouseButtonEvent(ImGuiMouseButton_Left, false); // Id descending (reversed in place), then Value1 (on a worker thread)
+  } else if (frame == 4) {
+    io.AddMousePosEvent(header1.x, header1.y);
+  } else if (frame == 7) {
+    source.RowsCount = shrunkRowsCount; // While sorting by Value1, displaying rows 4999999.. in the previous order
+  } else if ((frame - 8) % 60 == 0) {
+    dataTableWaitSort(source);
+    source.RowsCount = TableBenchmark::initialRowsCount; // Appended rows are sorted then merged
+  } else if ((frame - 8) % 60 == 30) {
+    dataTableWaitSort(source);
+    source.RowsCount = shrunkRowsCount;
+  } else if ((frame - 8) % 60 == 31) {
+    source.MarkDirty(); // Rows modified while sorting: displayed unsorted until sorted again
+  } else if (frame % 2 == 0) {
+    sweepMouse(io, frame);
+  } else {
+    io.AddMouseWheelEvent(0.0f, -20.0f);
+  }
+}
+
+inline void dataTableSortSubmit(int) {
+  beginFullscreenWindow("DataTable Sort");
+  ImGui::DataTable("##Rows", &dataTableSource(), ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersV | ImGuiTableFlags_Sortable);
+  ImGui::End();
+}
+
+inline const Scenario* getScenarios(int* count) {
+  static const Scenario scenarios[] = {
+    { "ManyWindows", "2000 overlapping windows, hovered and clicked", 120, manyWindowsInput, manyWindowsSubmit, NULL },
+    { "DeepTree", "4095 open tree nodes and 16 chains 24 levels deep", 120, deepTreeInput, deepTreeSubmit, NULL },
+    { "TreeState", "Tree growing to 100k nodes, open state in a sorted ImGuiStorage", 120, longTextInput, treeStateSubmit, NULL },
+    { "TreeStateHashed", "Same tree, open state in a hashed ImGuiStorage", 120, longTextInput, treeStateHashedSubmit, NULL },
+    { "LargeTable", "1M x 8 clipped table, scrolled", 240, largeTableInput, largeTableSubmit, NULL },
+    { "LongText", "1 MB of text and read-only multi-line InputText", 120, longTextInput, longTextSubmit, NULL },
+    { "Utf8Text", "3 x 256 KB ASCII, Latin-1 and CJK logs, every line measured", 120, longTextInput, utf8TextSubmit, NULL },
+    { "WidgetIds", "400 objects x 10 properties without clipper, IDs hashed every frame", 120, longTextInput, widgetIdsSubmit, NULL },
+    { "Plots", "8 x 100k points PlotLines and a histogram", 120, sweepMouse, plotsSubmit, NULL },
+    { "PlotStreams", "4 summary plots over a growing 4M samples recording, 8 streaming plots", 240, sweepMouse, plotStreamsSubmit, plotStreamsShutdown },
+    { "Typing", "Key and character events into a multi-line InputText", 600, typingInput, typingSubmit, NULL },
+    { "Document", "Typing and paging through a 1 MB InputTextDocument", 600, documentInput, documentSubmit, NULL },
+    { "Docking", "64 docked nodes x 4 tabs, idle with a hovering mouse", 240, dockingInput, dockingSubmit, NULL },
+    { "MouseFlood", "1000 Hz mouse: 16 moves per frame, clicks and wheel bursts", 240, mouseFloodInput, mouseFloodSubmit, NULL },
+    { "DataTableSort", "5M x 20 DataTable, rows removed and appended while sorting", 120, dataTableSortInput, dataTableSortSubmit, NULL },
+  };
+  *count = IM_ARRAYSIZE(scenarios);
+  return scenarios;
+}
+
+inline const Scenario* findScenario(const char* name) {
+  int count;
+  const Scenario* scenarios = getScenarios(&count);
+  for (int n = 0; n < count; n++)
+    if (strcmp(scenarios[n].name, name) == 0)
+      return &scenarios[n];
+  return NULL;
+}
+
+// Running
+// -------
+
+// Built once and shared by all scenario contexts
+inline ImFontAtlas*& fontAtlas() {
+  static ImFontAtlas* atlas = NULL;
+  return atlas;
+}
+
+inline void shutdown() {
+  if (fontAtlas() != NULL)
+    IM_DELETE(fontAtlas());
+  fontAtlas() = NULL;
+}
+
+// Must be called outside of any ImGui frame. Restores the current context when done.
+inline Result runScenario(const Scenario& scenario, const Options& options) {
+  if (fontAtlas() == NULL) {
+    fontAtlas() = IM_NEW(ImFontAtlas)();
+    fontAtlas()->AddFontDefault();
+    fontAtlas()->Build();
+  }
+  ImGuiContext* previousContext = ImGui::GetCurrentContext();
+  ImGuiContext* context = ImGui::CreateContext(fontAtlas());
+  ImGui::SetCurrentContext(context);
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = NULL;
+  io.LogFilename = NULL;
+  io.DisplaySize = options.displaySize;
+  io.DeltaTime = 1.0f / 60.0f;
+  io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset; // Same as the OpenGL3 backend
+  io.ConfigInputCoalesceMouseEvents = options.coalesceInput;
+
+  const int frames = ImMax(1, (int)(scenario.frames * options.frameScale));
+  ImTieredAllocator* allocator = tieredAllocator();
+  ImVector<double> newFrameMs, submitMs, renderMs, frameMs, vertices, indices, drawLists, drawCmds, heapAllocs;
+  Result result;
+  result.name = scenario.name;
+  result.frames = frames;
+  result.inputEvents = result.inputEventsMerged = 0;
+  result.warmupHeapAllocs = 0;
+  scenarioErrorsCount() = 0;
+  for (int frame = 0; frame < options.warmupFrames + frames; frame++) {
+    const int queuedEvents = context->InputEventsQueue.Size;
+    const int mergedEvents = context->InputEventsMergedMousePos + context->InputEventsMergedMouseWheel;
+    if (scenario.input != NULL)
+      scenario.input(io, frame);
+    const int inputEvents = context->InputEventsQueue.Size - queuedEvents;
+    const int inputEventsMerged = context->InputEventsMergedMousePos + context->InputEventsMergedMouseWheel - mergedEvents;
+
+    const int allocCount = context->DebugAllocInfo.TotalAllocCount;
+    const double t0 = now();
+    ImGui::NewFrame();
+    const double t1 = now();
+    scenario.submit(frame);
+    const double t2 = now();
+    ImGui::Render();
+    const double t3 = now();
+    const int frameHeapAllocs = allocator ? allocator->GetFrameStats().BackendAllocCount : context->DebugAllocInfo.TotalAllocCount - allocCount;
+
+    if (frame < options.warmupFrames) {
+      result.warmupHeapAllocs += frameHeapAllocs;
+      continue;
+    }
+    const ImDrawData* drawData = ImGui::GetDrawData();
+    int cmdsCount = 0;
+    for (const ImDrawList* drawList : drawData->CmdLists)
+      cmdsCount += drawList->CmdBuffer.Size;
+    result.inputEvents += inputEvents;
+    result.inputEventsMerged += inputEventsMerged;
+    newFrameMs.push_back((t1 - t0) * 1000.0);
+    submitMs.push_back((t2 - t1) * 1000.0);
+    renderMs.push_back((t3 - t2) * 1000.0);
+    frameMs.push_back((t3 - t0) * 1000.0);
+    vertices.push_back(drawData->TotalVtxCount);
+    indices.push_back(drawData->TotalIdxCount);
+    drawLists.push_back(drawData->CmdListsCount);
+    drawCmds.push_back(cmdsCount);
+    heapAllocs.push_back(frameHeapAllocs);
+  }
+  if (scenario.shutdown != NULL)
+    scenario.shutdown();
+  ImGui::DestroyContext(context);
+  ImGui::SetCurrentContext(previousContext);
+
+  result.errors = scenarioErrorsCount();
+  result.newFrameMs = computeStats(newFrameMs);
+  result.submitMs = computeStats(submitMs);
+  result.renderMs = computeStats(renderMs);
+  result.frameMs = computeStats(frameMs);
+  result.vertices = computeStats(vertices);
+  result.indices = computeStats(indices);
+  result.drawLists = computeStats(drawLists);
+  result.drawCmds = computeStats(drawCmds);
+  result.heapAllocs = computeStats(heapAllocs);
+  return result;
+}
+
+inline void writeStats(FILE* f, const char* name, const Stats& stats, bool last = false) {
+  fprintf(f, "      \"%s\": { \"mean\": %.4f, \"p95\": %.4f, \"max\": %.4f }%s\n", name, stats.mean, stats.p95, stats.max, last ? "" : ",");
+}
+
+inline void writeJson(FILE* f, const ImVector<Result>& results, const SettingsResult* settings = NULL) {
+  fprintf(f, "{\n  \"imgui_version\": \"%s\",\n  \"allocator\": \"%s\",\n  \"hash\": \"%s\",\n  \"scenarios\": [\n", IMGUI_VERSION, tieredAllocator() ? "tiered" : "default", hashBackendName());
+  for (int n = 0; n < results.Size; n++) {
+    const Result& result = results[n];
+    fprintf(f, "    {\n      \"name\": \"%s\",\n      \"frames\": %d,\n      \"input_events\": %d,\n      \"input_events_merged\": %d,\n      \"warmup_heap_allocs\": %d,\n      \"errors\": %d,\n",
+            result.name, result.frames, result.inputEvents, result.inputEventsMerged, result.warmupHeapAllocs, result.errors);
+    writeStats(f, "new_frame_ms", result.newFrameMs);
+    writeStats(f, "submit_ms", result.submitMs);
+    writeStats(f, "render_ms", result.renderMs);
+    writeStats(f, "frame_ms", result.frameMs);
+    writeStats(f, "vertices", result.vertices);
+    writeStats(f, "indices", result.indices);
+    writeStats(f, "draw_lists", result.drawLists);
+    writeStats(f, "draw_cmds", result.drawCmds);
+    writeStats(f, "heap_allocs", result.heapAllocs, true);
+    fprintf(f, "    }%s\n", n + 1 < results.Size ? "," : "");
+  }
+  fprintf(f, "  ]");
+  if (settings != NULL) {
+    fprintf(f, ",\n  \"settings\": {\n");
+    fprintf(f, "    \"windows\": %d,\n    \"tables\": %d,\n    \"ini_size\": %d,\n    \"round_trip\": %s,\n",
+            settings->windows, settings->tables, settings->iniSize, settings->roundTrip ? "true" : "false");
+    fprintf(f, "    \"save_full_ms\": %.4f,\n    \"save_incremental_ms\": %.4f,\n    \"load_ms\": %.4f,\n",
+            settings->saveFullMs, settings->saveIncrementalMs, settings->loadMs);
+    fprintf(f, "    \"new_frame_ms\": %.4f,\n    \"auto_save_ms\": %.4f,\n    \"auto_save_threaded_ms\": %.4f\n  }",
+            settings->newFrameMs, settings->autoSaveMs, settings->autoSaveThreadedMs);
+  }
+  fprintf(f, "\n}\n");
+}
+
+// Settings
+// --------
+// Save and load of the .ini data of many windows, some of them holding a table.
+// The incremental save moves one window: other entries are copied from the previous write instead of being formatted again.
+
+
+inline void settingsWindowsSubmit(int windowsCount) {
+  char name[32];
+  for (int n = 0; n < windowsCount; n++) {
+    snprintf(name, sizeof(name), "Window %05d", n);
+    ImGui::SetNextWindowPos(ImVec2(20.0f + (float)(n % 100) * 10.0f, 20.0f + (float)(n / 100 % 50) * 10.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(200.0f, 100.0f), ImGuiCond_FirstUseEver);
+    ImGui::Begin(name);
+    if (n % 10 == 0 && ImGui::BeginTable("##Table", 3, ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable)) {
+      ImGui::TableSetupColumn("A");
+      ImGui::TableSetupColumn("B");
+      ImGui::TableSetupColumn("C");
+      ImGui::TableHeadersRow();
+      ImGui::EndTable();
+    }
+    ImGui::End();
+  }
+}
+
+// Must be called outside of any ImGui frame. Restores the current context when done.
+// Writes "workload_settings.ini" in the working directory for the automatic saves, and removes it.
+inline SettingsResult runSettings(int windowsCount) {
+  const char* iniFilename = "workload_settings.ini";
+  const int repeats = 5;
+  if (fontAtlas() == NULL) {
+    fontAtlas() = IM_NEW(ImFontAtlas)();
+    fontAtlas()->AddFontDefault();
+    fontAtlas()->Build();
+  }
+  ImGuiContext* previousContext = ImGui::GetCurrentContext();
+  ImGuiContext* context = ImGui::CreateContext(fontAtlas());
+  ImGui::SetCurrentContext(context);
+  ImGuiIO& io = ImGui::GetIO();
+  io.IniFilename = NULL;
+  io.LogFilename = NULL;
+  io.DisplaySize = ImVec2(1280.0f, 800.0f);
+  io.DeltaTime = 1.0f / 60.0f;
+  io.IniSavingRate = io.DeltaTime * 0.5f; // Save on the frame following a change
+  for (int frame = 0; frame < 2; frame++) {
+    ImGui::NewFrame();
+    settingsWindowsSubmit(windowsCount);
+    ImGui::Render();
+  }
+
+  SettingsResult result;
+  result.windows = windowsCount;
+  result.tables = 0;
+  for (ImGuiTableSettings* settings = context->SettingsTables.begin(); settings != NULL; settings = context->SettingsTables.next_chunk(settings))
+    result.tables++;
+
+  double t0 = now();
+  size_t iniSize = 0;
+  const char* iniData = ImGui::SaveIniSettingsToMemory(&iniSize);
+  result.saveFullMs = (now() - t0) * 1000.0;
+  result.iniSize = (int)iniSize;
+
+  result.saveIncrementalMs = 0.0;
+  for (int n = 0; n < repeats; n++) {
+    ImGui::SetWindowPos("Window 00000", ImVec2(21.0f + n, 20.0f));
+    t0 = now();
+    ImGui::SaveIniSettingsToMemory();
+    result.saveIncrementalMs += (now() - t0) * 1000.0 / repeats;
+  }
+  ImGui::SetWindowPos("Window 00000", ImVec2(20.0f, 20.0f));
+  iniData = ImGui::SaveIniSettingsToMemory(&iniSize);
+  ImVector<char> ini;
+  ini.resize((int)iniSize + 1);
+  memcpy(ini.Data, iniData, iniSize + 1);
+
+  // Automatic saves: each frame follows a change
+  io.IniFilename = iniFilename;
+  result.newFrameMs = result.autoSaveMs = result.autoSaveThreadedMs = 0.0;
+  for (int n = 0; n < repeats * 3; n++) {
+    const int mode = n % 3; // 0: no save, 1: save, 2: threaded save
+    io.IniSavingThreaded = (mode == 2);
+    if (mode != 0)
+      ImGui::MarkIniSettingsDirty();
+    t0 = now();
+    ImGui::NewFrame();
+    const double ms = (now() - t0) * 1000.0 / repeats;
+    (mode == 0 ? result.newFrameMs : mode == 1 ? result.autoSaveMs : result.autoSaveThreadedMs) += ms;
+    settingsWindowsSubmit(windowsCount);
+    ImGui::Render();
+    ImGui::WaitIniSettingsSaved();
+  }
+  io.IniFilename = NULL;
+  ImGui::DestroyContext(context);
+  remove(iniFilename);
+
+  // Load into a fresh context, save again and compare
+  context = ImGui::CreateContext(fontAtlas());
+  ImGui::SetCurrentContext(context);
+  ImGui::GetIO().IniFilename = NULL;
+  t0 = now();
+  ImGui::LoadIniSettingsFromMemory(ini.Data, (size_t)ini.Size - 1);
+  result.loadMs = (now() - t0) * 1000.0;
+  iniData = ImGui::SaveIniSettingsToMemory(&iniSize);
+  result.roundTrip = (iniSize == (size_t)ini.Size - 1 && memcmp(iniData, ini.Data, iniSize) == 0);
+  ImGui::DestroyContext(context);
+  ImGui::SetCurrentContext(previousContext);
+  return result;
+}
+
+// Query check
+// -----------
+// Compares the rows of ImGuiTableQuery with a filtered std::sort() of the same data: radix sort (numeric keys of every type,
+// both directions, several keys), merge sort (text keys), filters, several worker counts. Then submits requests in a row,
+// each one canceling the previous one, and checks the last one.
+
+struct QueryCheckData {
+  ImVector<ImS32> ints;
+  ImVector<float> floats;
+  ImVector<ImU8> bytes;
+  ImVector<double> doubles;
+  ImVector<ImS64> longs;
+  ImVector<const char*> texts;
+};
+
+inline double queryCheckValue(const ImGuiTableQueryColumn& column, int row) {
+  switch (column.DataType) {
+  case ImGuiDataType_S32: return (double)((const ImS32*)column.Data)[row];
+  case ImGuiDataType_Float: return (double)((const float*)column.Data)[row];
+  case ImGuiDataType_U8: return (double)((const ImU8*)column.Data)[row];
+  case ImGuiDataType_Double: return ((const double*)column.Data)[row];
+  case ImGuiDataType_S64: return (double)((const ImS64*)column.Data)[row]; // Values fit in a double mantissa
+  }
+  IM_ASSERT(0);
+  return 0.0;
+}
+
+inline bool queryCheckContains(const char* text, const char* needleLower) {
+  for (; *text; text++) {
+    int n = 0;
+    while (needleLower[n] && text[n] && (text[n] >= 'A' && text[n] <= 'Z' ? text[n] + ('a' - 'A') : text[n]) == needleLower[n])
+      n++;
+    if (needleLower[n] == 0)
+      return true;
+  }
+  return needleLower[0] == 0;
+}
+
+// Expected result of the query's current request
+inline void queryCheckExpected(const ImGuiTableQuery& query, ImVector<int>* rows) {
+  rows->resize(0);
+  for (int row = 0; row < query.RowsCount; row++) {
+    bool pass = true;
+    for (const ImGuiTableQueryFilter& filter : query.Filters) {
+      const ImGuiTableQueryColumn& column = query.Columns[filter.ColumnIndex];
+      if (filter.Type == ImGuiTableQueryFilterType_Substring)
+        pass &= queryCheckContains(((const char* const*)column.Data)[row], filter.Text);
+      else
+        pass &= queryCheckValue(column, row) >= filter.Min && queryCheckValue(column, row) <= filter.Max;
+    }
+    if (pass)
+      rows->push_back(row);
+  }
+  std::sort(rows->begin(), rows->end(), [&query](int a, int b) {
+    for (const ImGuiTableDataSortKey& key : query.SortKeys) {
+      const ImGuiTableQueryColumn& column = query.Columns[key.ColumnIndex];
+      int delta;
+      if (column.DataType == ImGuiDataType_String) {
+        delta = strcmp(((const char* const*)column.Data)[a], ((const char* const*)column.Data)[b]);
+      } else {
+        const double va = queryCheckValue(column, a), vb = queryCheckValue(column, b);
+        delta = (va < vb) ? -1 : (va > vb) ? 1 : 0;
+      }
+      if (delta != 0)
+        return key.SortDirection == ImGuiSortDirection_Descending ? delta > 0 : delta < 0;
+    }
+    return a < b;
+  });
+}
+
+inline void queryCheckWait(ImGuiTableQuery& query) {
+  while (query.IsRunning() || query.HasCanceledJobs()) {
+    query.Update();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+inline void querySetSortKeys(ImGuiTableQuery& query, const int* keys, int keysCount) {
+  query.SortKeys.resize(keysCount);
+  for (int n = 0; n < keysCount; n++) {
+    query.SortKeys[n].ColumnIndex = (ImGuiTableColumnIdx)(keys[n] < 0 ? ~keys[n] : keys[n]);
+    query.SortKeys[n].SortDirection = keys[n] < 0 ? ImGuiSortDirection_Descending : ImGuiSortDirection_Ascending;
+  }
+}
+
+// Return the number of failed checks, each one printed to 'log'
+inline int runQueryCheck(FILE* log, int* checksCount) {
+  const int rowsCount = 50021;
+  static const char* words[] = { "alpha", "Beta", "GAMMA", "delta", "alphabet", "epsilon", "zeta", "", "Alpha beta", "betamax" };
+  QueryCheckData data;
+  data.ints.resize(rowsCount);
+  data.floats.resize(rowsCount);
+  data.bytes.resize(rowsCount);
+  data.doubles.resize(rowsCount);
+  data.longs.resize(rowsCount);
+  data.texts.resize(rowsCount);
+  for (int row = 0; row < rowsCount; row++) {
+    const unsigned int h = TableBenchmark::hashCell(row, 1), h2 = TableBenchmark::hashCell(row, 2);
+    data.ints[row] = (ImS32)(h % 2001) - 1000;
+    data.floats[row] = ((float)(h2 % 20001) - 10000.0f) * 0.37f + 0.5f; // No zero, so no -0.0f tie
+    data.bytes[row] = (ImU8)(h >> 24);
+    data.doubles[row] = (double)(h2 % 100003) * -1.25e-3;
+    data.longs[row] = ((ImS64)(h2 % 1000) - 500) * ((ImS64)1 << 40) + (ImS64)(h % 7);
+    data.texts[row] = words[(h ^ h2) % IM_ARRAYSIZE(words)];
+  }
+
+  ImGuiTableQuery query;
+  query.RowsCount = rowsCount;
+  query.AddColumn(ImGuiDataType_S32, data.ints.Data);
+  query.AddColumn(ImGuiDataType_Float, data.floats.Data);
+  query.AddColumn(ImGuiDataType_U8, data.bytes.Data);
+  query.AddColumn(ImGuiDataType_Double, data.doubles.Data);
+  query.AddColumn(ImGuiDataType_S64, data.longs.Data);
+  query.AddColumn(ImGuiDataType_String, data.texts.Data);
+
+  // Column indices, ~index for descending: radix sorts, then merge sorts (any text key)
+  static const int sorts[][3] = {
+    { 0 }, { ~0 }, { 1 }, { ~1 }, { 2, ~4 }, { ~3, 0 }, { 4, 2, ~0 },
+    { 5 }, { ~5 }, { 5, ~0 }, { ~2, 5 }, { 0, ~5, 1 },
+  };
+  static const int sortsKeysCount[] = { 1, 1, 1, 1, 2, 2, 3, 1, 1, 2, 2, 3 };
+  static const int workersCounts[] = { 1, 3, 8 };
+  int failures = 0;
+  *checksCount = 0;
+  ImVector<int> expected;
+  for (int filters = 0; filters < 3; filters++) {
+    query.ClearFilters();
+    if (filters >= 1)
+      query.AddFilterRange(0, -500.0, 600.0);
+    if (filters >= 2)
+      query.AddFilterSubstring(5, "ALPHA");
+    for (int sortIndex = 0; sortIndex < IM_ARRAYSIZE(sorts); sortIndex++) {
+      querySetSortKeys(query, sorts[sortIndex], sortsKeysCount[sortIndex]);
+      queryCheckExpected(query, &expected);
+      for (int workersCount : workersCounts) {
+        query.WorkersCount = workersCount;
+        query.Submit();
+        queryCheckWait(query);
+        (*checksCount)++;
+        if (!query.HasResult || query.Rows.Size != expected.Size || memcmp(query.Rows.Data, expected.Data, sizeof(int) * expected.Size) != 0) {
+          fprintf(log, "Query check failed: filters %d, sort %d, %d workers (%d rows, expected %d)\n", filters, sortIndex, workersCount, query.Rows.Size, expected.Size);
+          failures++;
+        }
+      }
+    }
+  }
+
+  // Requests in a row: each Submit() cancels the job in progress without waiting for it
+  query.ClearFilters();
+  query.WorkersCount = 4;
+  for (int sortIndex = 0; sortIndex < IM_ARRAYSIZE(sorts); sortIndex++) {
+    querySetSortKeys(query, sorts[sortIndex], sortsKeysCount[sortIndex]);
+    query.Submit();
+  }
+  queryCheckExpected(query, &expected);
+  queryCheckWait(query);
+  (*checksCount)++;
+  if (query.Rows.Size != expected.Size || memcmp(query.Rows.Data, expected.Data, sizeof(int) * expected.Size) != 0) {
+    fprintf(log, "Query check failed: last of %d requests in a row\n", (int)IM_ARRAYSIZE(sorts));
+    failures++;
+  }
+  return failures;
+}
+
+// Window
+// ------
+
+struct State {
+  bool selected[16];
+  bool runRequested;
+  Options options;
+  ImVector<Result> results;
+  bool settingsRunRequested;
+  int settingsWindows;
+  bool hasSettingsResult;
+  SettingsResult settingsResult;
+
+  State() {
+    for (int n = 0; n < IM_ARRAYSIZE(selected); n++)
+      selected[n] = true;
+    runRequested = false;
+    settingsRunRequested = false;
+    settingsWindows = 10000;
+    hasSettingsResult = false;
+    options.frameScale = 0.25f; // Runs block the app, keep them short by default
+  }
+};
+
+inline State& state() {
+  static State state;
+  return state;
+}
+
+// Call after the app's frame was rendered
+inline void runPending() {
+  State& s = state();
+  if (s.settingsRunRequested) {
+    s.settingsRunRequested = false;
+    s.settingsResult = runSettings(s.settingsWindows);
+    s.hasSettingsResult = true;
+  }
+  if (!s.runRequested)
+    return;
+  s.runRequested = false;
+  s.results.clear();
+  int count;
+  const Scenario* scenarios = getScenarios(&count);
+  for (int n = 0; n < count && n < IM_ARRAYSIZE(s.selected); n++)
+    if (s.selected[n])
+      s.results.push_back(runScenario(scenarios[n], s.options));
+}
+
+inline void showWindow(bool* open) {
+  if (!ImGui::Begin("Workloads", open)) {
+    ImGui::End();
+    return;
+  }
+  State& s = state();
+  int count;
+  const Scenario* scenarios = getScenarios(&count);
+  for (int n = 0; n < count && n < IM_ARRAYSIZE(s.selected); n++) {
+    ImGui::Checkbox(scenarios[n].name, &s.selected[n]);
+    ImGui::SameLine(160.0f);
+    ImGui::TextDisabled("%s (%d frames)", scenarios[n].description, scenarios[n].frames);
+  }
+  ImGui::SliderFloat("Frames scale", &s.options.frameScale, 0.05f, 4.0f, "%.2f", ImGuiSliderFlags_Logarithmic);
+  ImGui::SliderInt("Warm-up frames", &s.options.warmupFrames, 0, 60);
+  if (ImGui::Button("Run"))
+    s.runRequested = true;
+  ImGui::SameLine();
+  ImGui::TextDisabled("The app is blocked while scenarios run");
+
+  const ImGuiTableFlags flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit;
+  if (s.results.Size > 0 && ImGui::BeginTable("##Results", 10, flags)) {
+    ImGui::TableSetupColumn("Scenario");
+    ImGui::TableSetupColumn("NewFrame (ms)");
+    ImGui::TableSetupColumn("Submit (ms)");
+    ImGui::TableSetupColumn("Render (ms)");
+    ImGui::TableSetupColumn("Frame p95 (ms)");
+    ImGui::TableSetupColumn("Vertices");
+    ImGui::TableSetupColumn("Draw cmds");
+    ImGui::TableSetupColumn("Heap allocs");
+    ImGui::TableSetupColumn("Input events");
+    ImGui::TableSetupColumn("Merged");
+    ImGui::TableHeadersRow();
+    for (const Result& result : s.results) {
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::TextUnformatted(result.name);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", result.newFrameMs.mean);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", result.submitMs.mean);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", result.renderMs.mean);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", result.frameMs.p95);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.0f", result.vertices.mean);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.0f", result.drawCmds.mean);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.2f", result.heapAllocs.mean);
+      ImGui::TableNextColumn();
+      ImGui::Text("%d", result.inputEvents);
+      ImGui::TableNextColumn();
+      ImGui::Text("%d", result.inputEventsMerged);
+    }
+    ImGui::EndTable();
+  }
+  if (s.results.Size > 0 && ImGui::Button("Save JSON")) {
+    if (FILE* f = fopen("workloads.json", "w")) {
+      writeJson(f, s.results, s.hasSettingsResult ? &s.settingsResult : NULL);
+      fclose(f);
+    }
+  }
+
+  ImGui::SeparatorText("Settings (.ini)");
+  ImGui::SetNextItemWidth(120.0f);
+  ImGui::InputInt("Windows", &s.settingsWindows, 1000);
+  s.settingsWindows = ImClamp(s.settingsWindows, 1, 100000);
+  ImGui::SameLine();
+  if (ImGui::Button("Run##Settings"))
+    s.settingsRunRequested = true;
+  if (s.hasSettingsResult) {
+    const SettingsResult& r = s.settingsResult;
+    ImGui::Text("%d windows, %d tables, %d bytes, round trip %s", r.windows, r.tables, r.iniSize, r.roundTrip ? "OK" : "FAILED");
+    ImGui::Text("Save: full %.3f ms, incremental %.3f ms. Load: %.3f ms", r.saveFullMs, r.saveIncrementalMs, r.loadMs);
+    ImGui::Text("NewFrame: %.3f ms, with auto-save %.3f ms, threaded %.3f ms", r.newFrameMs, r.autoSaveMs, r.autoSaveThreadedMs);
+  }
+  ImGui::End();
+}
+
+} // namespace Workload
@@ -0,0 +1,108 @@
+// Workload benchmark
+// ------------------
+// Runs the scenarios from Workload.hpp headless (no window, no GL) and prints JSON for regression tracking.
+//
+// Usage: WorkloadBench [--list] [--scenario Name]... [--frames-scale F] [--warmup N] [--no-coalesce] [--tiered-allocator] [--settings Windows] [--check-query] [--output file.json]
+// With --settings or --check-query and no --scenario, only the .ini settings benchmark or the query check runs.
+// --check-query compares ImGuiTableQuery results with std::sort() and fails on any difference.
+// --no-coalesce queues every mouse move/wheel event (io.ConfigInputCoalesceMouseEvents = false).
+// --tiered-allocator installs ImTieredAllocator for the whole run, instead of ImGui's default malloc()/free() wrappers.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Workload.hpp"
+
+int main(int argc, char** argv) {
+  // Must be installed before anything allocates through ImGui::MemAlloc(), ImVector<> included
+  for (int n = 1; n < argc; n++)
+    if (strcmp(argv[n], "--tiered-allocator") == 0) {
+      static ImTieredAllocator allocator;
+      ImGui::SetAllocatorFunctions(ImTieredAllocator::AllocFunc, ImTieredAllocator::FreeFunc, &allocator);
+      break;
+    }
+
+  Workload::Options options;
+  ImVector<const Workload::Scenario*> scenarios;
+  const char* outputFilename = NULL;
+  int settingsWindows = 0;
+  bool checkQuery = false;
+  int count;
+  const Workload::Scenario* allScenarios = Workload::getScenarios(&count);
+  for (int n = 1; n < argc; n++) {
+    const bool hasValue = (n + 1 < argc);
+    if (strcmp(argv[n], "--list") == 0) {
+      for (int i = 0; i < count; i++)
+        printf("%-12s %s (%d frames)\n", allScenarios[i].name, allScenarios[i].description, allScenarios[i].frames);
+      return 0;
+    } else if (strcmp(argv[n], "--scenario") == 0 && hasValue) {
+      const Workload::Scenario* scenario = Workload::findScenario(argv[++n]);
+      if (scenario == NULL) {
+        fprintf(stderr, "Error: unknown scenario '%s', see --list\n", argv[n]);
+        return 1;
+      }
+      scenarios.push_back(scenario);
+    } else if (strcmp(argv[n], "--frames-scale") == 0 && hasValue) {
+      options.frameScale = (float)atof(argv[++n]);
+    } else if (strcmp(argv[n], "--warmup") == 0 && hasValue) {
+      options.warmupFrames = atoi(argv[++n]);
+    } else if (strcmp(argv[n], "--no-coalesce") == 0) {
+      options.coalesceInput = false;
+    } else if (strcmp(argv[n], "--tiered-allocator") == 0) {
+      // Installed above
+    } else if (strcmp(argv[n], "--settings") == 0 && hasValue) {
+      settingsWindows = atoi(argv[++n]);
+    } else if (strcmp(argv[n], "--check-query") == 0) {
+      checkQuery = true;
+    } else if (strcmp(argv[n], "--output") == 0 && hasValue) {
+      outputFilename = argv[++n];
+    } else {
+      fprintf(stderr, "Usage: %s [--list] [--scenario Name]... [--frames-scale F] [--warmup N] [--no-coalesce] [--tiered-allocator] [--settings Windows] [--check-query] [--output file.json]\n", argv[0]);
+      return 1;
+    }
+  }
+  if (scenarios.empty() && settingsWindows <= 0 && !checkQuery)
+    for (int n = 0; n < count; n++)
+      scenarios.push_back(&allScenarios[n]);
+
+  IMGUI_CHECKVERSION();
+  ImVector<Workload::Result> results;
+  int scenarioErrors = 0;
+  for (const Workload::Scenario* scenario : scenarios) {
+    results.push_back(Workload::runScenario(*scenario, options));
+    fprintf(stderr, "%-12s %8.3f ms/frame, %6.2f heap allocs/frame, %5d during warm-up\n", scenario->name, results.back().frameMs.mean, results.back().heapAllocs.mean, results.back().warmupHeapAllocs);
+    if (results.back().errors > 0)
+      fprintf(stderr, "Error: %s failed %d checks\n", scenario->name, results.back().errors);
+    scenarioErrors += results.back().errors;
+  }
+  Workload::SettingsResult settings;
+  if (settingsWindows > 0) {
+    settings = Workload::runSettings(settingsWindows);
+    fprintf(stderr, "Settings     %d windows: save %.3f ms, incremental %.3f ms, load %.3f ms\n", settings.windows, settings.saveFullMs, settings.saveIncrementalMs, settings.loadMs);
+  }
+  int queryFailures = 0;
+  if (checkQuery) {
+    int checksCount = 0;
+    const double t0 = Workload::now();
+    queryFailures = Workload::runQueryCheck(stderr, &checksCount);
+    fprintf(stderr, "Query check  %d checks, %d failed (%.0f ms)\n", checksCount, queryFailures, (Workload::now() - t0) * 1000.0);
+  }
+  Workload::shutdown();
+
+  FILE* f = outputFilename ? fopen(outputFilename, "w") : stdout;
+  if (f == NULL) {
+    fprintf(stderr, "Error: can't open '%s'\n", outputFilename);
+    return 1;
+  }
+  Workload::writeJson(f, results, settingsWindows > 0 ? &settings : NULL);
+  if (f != stdout)
+    fclose(f);
+  if (settingsWindows > 0 && !settings.roundTrip) {
+    fprintf(stderr, "Error: .ini data changed after a load/save round trip\n");
+    return 1;
+  }
+  if (queryFailures > 0 || scenarioErrors > 0)
+    return 1;
+  return 0;
+}